@@ -0,0 +1,91 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_ACCUMULATOR_TYPE_H)
+#define CNL_IMPL_ACCUMULATOR_TYPE_H
+
+#include "../config.h"
+#include "../exact_accumulator.h"
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief type of the sum of up to \c MaxTerms values of type \c T
+    ///
+    /// \c T is widened by `ceil(log2(MaxTerms))` digits,
+    /// e.g. `accumulate_t<elastic_integer<24>, 1000>` is `elastic_integer<34>`.
+    /// Where the widest fundamental integer is too narrow, the result is composed of a \ref wide_integer.
+    ///
+    /// \headerfile cnl/accumulator.h
+    /// \sa cnl::accumulator
+    template<typename T, uintmax MaxTerms>
+    using accumulate_t = _impl::exact_sum_t<T, _impl::sum_headroom(MaxTerms)>;
+
+    /// \brief running sum of up to \c MaxTerms values of type \c T
+    ///
+    /// \tparam T type of each term
+    /// \tparam MaxTerms greatest number of terms which are added or subtracted
+    ///
+    /// The sum is stored as \ref accumulate_t, whose width is fixed by \c MaxTerms.
+    /// Unlike a chain of `+` operations, which widens an \ref elastic_integer by one digit per term,
+    /// \ref operator+= converts each term to the stored type and then assigns the sum back to it,
+    /// so that a sum which fits in a native integer is computed in one.
+    /// Both steps use the operators of the stored type, so that any overflow or rounding behavior of \c T applies,
+    /// e.g. more than \c MaxTerms terms saturate a sum of \ref overflow_integer with \ref saturated_overflow_tag.
+    ///
+    /// \headerfile cnl/accumulator.h
+    /// \sa cnl::accumulate_t, cnl::elastic_integer
+    template<typename T, uintmax MaxTerms>
+    class accumulator {
+        static_assert(MaxTerms>0, "accumulator must have room for at least one term");
+    public:
+        using value_type = accumulate_t<T, MaxTerms>;
+
+        constexpr accumulator()
+                : _value{0}
+        {
+        }
+
+        /// initializes the sum with \c value, which counts as one term
+        explicit constexpr accumulator(value_type const& value)
+                : _value{value}
+        {
+        }
+
+        /// returns the sum
+        CNL_NODISCARD constexpr value_type const& value() const
+        {
+            return _value;
+        }
+
+        /// converts the sum to \c S following the conversion rules of \ref value_type, e.g. \ref elastic_tag
+        template<typename S>
+        CNL_NODISCARD explicit constexpr operator S() const
+        {
+            return static_cast<S>(_value);
+        }
+
+        /// adds \c term, first converting it to \ref value_type
+        template<typename Term>
+        accumulator& operator+=(Term const& term)
+        {
+            _value += static_cast<value_type>(term);
+            return *this;
+        }
+
+        /// subtracts \c term, first converting it to \ref value_type
+        template<typename Term>
+        accumulator& operator-=(Term const& term)
+        {
+            _value -= static_cast<value_type>(term);
+            return *this;
+        }
+
+    private:
+        value_type _value;
+    };
+}
+
+#endif  // CNL_IMPL_ACCUMULATOR_TYPE_H
@@ -0,0 +1,135 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_BEST_FORMAT_TYPE_H)
+#define CNL_IMPL_BEST_FORMAT_TYPE_H
+
+#include "../../cstdint.h"
+#include "../../limits.h"
+#include "../../numeric.h"
+#include "../common.h"
+#include "../config.h"
+#include "../num_traits/digits.h"
+#include "../num_traits/set_digits.h"
+#include "../scaled/power.h"
+#include "../scaled_integer/declaration.h"
+
+#include <ratio>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::best_format_exponent
+
+        // greatest exponent, e, such that 2^e is no greater than numerator/denominator, where both are positive
+        CNL_NODISCARD constexpr int best_format_exponent(intmax numerator, intmax denominator)
+        {
+            return (numerator>=denominator)
+                   ? cnl::used_digits(numerator/denominator)-1
+                   : -cnl::used_digits((denominator-1)/numerator);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::best_format_bound
+
+        CNL_NODISCARD constexpr intmax best_format_floor(intmax numerator, intmax denominator)
+        {
+            return (numerator<0 && numerator%denominator) ? numerator/denominator-1 : numerator/denominator;
+        }
+
+        CNL_NODISCARD constexpr intmax best_format_ceil(intmax numerator, intmax denominator)
+        {
+            return (numerator>0 && numerator%denominator) ? numerator/denominator+1 : numerator/denominator;
+        }
+
+        // true iff best_format_bound can scale numerator by 2^exponent in an intmax;
+        // if not, the bound requires more digits than the widest fundamental integer
+        CNL_NODISCARD constexpr bool best_format_bound_fits(intmax numerator, int exponent)
+        {
+            return exponent>=0
+                   || (-exponent<digits<intmax>::value
+                           && numerator<=(numeric_limits<intmax>::max() >> -exponent)
+                           && numerator>=-(numeric_limits<intmax>::max() >> -exponent));
+        }
+
+        // numerator/denominator in units of 2^exponent, rounded outward: down if lower is true, otherwise up;
+        // for a positive exponent, the quotient is rounded before it is scaled so that the divisor cannot overflow
+        CNL_NODISCARD constexpr intmax best_format_bound(
+                intmax numerator, intmax denominator, int exponent, bool lower)
+        {
+            return (exponent<0)
+                   ? lower
+                     ? best_format_floor(numerator*(intmax{1} << -exponent), denominator)
+                     : best_format_ceil(numerator*(intmax{1} << -exponent), denominator)
+                   : lower
+                     ? best_format_floor(best_format_floor(numerator, denominator), intmax{1} << exponent)
+                     : best_format_ceil(best_format_ceil(numerator, denominator), intmax{1} << exponent);
+        }
+    }
+
+    /// \brief the narrowest \ref cnl::scaled_integer which represents a range of values to a given resolution
+    ///
+    /// \tparam MinValue \c std::ratio which is the least value the type must represent
+    /// \tparam MaxValue \c std::ratio which is the greatest value the type must represent
+    /// \tparam Resolution \c std::ratio which is the greatest permitted difference between adjacent values
+    ///
+    /// The exponent is the greatest power of two which is no coarser than \c Resolution.
+    /// The rep is the narrowest fundamental integer which holds both bounds at that exponent
+    /// and is unsigned unless \c MinValue is negative.
+    ///
+    /// \note Bounds and a resolution which require more digits than the widest fundamental integer fail to compile.
+    ///
+    /// \headerfile cnl/best_format.h
+    /// \sa cnl::best_format_t
+    template<class MinValue, class MaxValue, class Resolution>
+    struct best_format {
+        static_assert(Resolution::num>0, "resolution must be positive");
+        static_assert(std::ratio_less_equal<MinValue, MaxValue>::value, "minimum value must not exceed maximum value");
+
+        /// exponent of the chosen type
+        static constexpr int exponent = _impl::best_format_exponent(Resolution::num, Resolution::den);
+
+        static_assert(
+                _impl::best_format_bound_fits(MinValue::num, exponent)
+                        && _impl::best_format_bound_fits(MaxValue::num, exponent),
+                "bounds and resolution require more digits than the widest fundamental integer");
+
+        /// the bounds in units of 2^exponent
+        static constexpr intmax min_rep = _impl::best_format_bound(MinValue::num, MinValue::den, exponent, true);
+        static constexpr intmax max_rep = _impl::best_format_bound(MaxValue::num, MaxValue::den, exponent, false);
+
+        static constexpr bool is_signed = min_rep<0;
+
+        /// number of digits of the chosen rep which are necessary, excluding any sign bit
+        static constexpr int digits = _impl::max(_impl::max(used_digits(min_rep), used_digits(max_rep)), 1);
+
+        using rep = set_digits_t<typename std::conditional<is_signed, int, unsigned>::type, digits>;
+        using type = scaled_integer<rep, power<exponent>>;
+    };
+
+    template<class MinValue, class MaxValue, class Resolution>
+    constexpr int best_format<MinValue, MaxValue, Resolution>::exponent;
+
+    template<class MinValue, class MaxValue, class Resolution>
+    constexpr intmax best_format<MinValue, MaxValue, Resolution>::min_rep;
+
+    template<class MinValue, class MaxValue, class Resolution>
+    constexpr intmax best_format<MinValue, MaxValue, Resolution>::max_rep;
+
+    template<class MinValue, class MaxValue, class Resolution>
+    constexpr bool best_format<MinValue, MaxValue, Resolution>::is_signed;
+
+    template<class MinValue, class MaxValue, class Resolution>
+    constexpr int best_format<MinValue, MaxValue, Resolution>::digits;
+
+    /// \brief helper alias of \ref cnl::best_format
+    /// \headerfile cnl/best_format.h
+    template<class MinValue, class MaxValue, class Resolution>
+    using best_format_t = typename best_format<MinValue, MaxValue, Resolution>::type;
+}
+
+#endif  // CNL_IMPL_BEST_FORMAT_TYPE_H
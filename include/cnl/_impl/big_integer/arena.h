@@ -0,0 +1,172 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_BIG_INTEGER_ARENA_H)
+#define CNL_IMPL_BIG_INTEGER_ARENA_H
+
+#include "../config.h"
+#include "limbs.h"
+
+#include <cstddef>
+#include <memory>
+#include <new>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief monotonic buffer from which \ref cnl::big_integer_arena_allocator allocates limbs
+    ///
+    /// Allocation advances a pointer through a single buffer and deallocation does nothing,
+    /// which suits bulk computations that create many temporary values.
+    /// Requests which do not fit in the remaining buffer are passed to the heap.
+    /// The memory is reclaimed by \ref release or on destruction,
+    /// and so no value which uses the arena may outlive either.
+    ///
+    /// A \ref scope makes an arena the one from which default-constructed allocators on the same thread allocate.
+    ///
+    /// \headerfile cnl/big_integer.h
+    /// \sa cnl::big_integer_arena_allocator, cnl::arena_big_integer
+    class big_integer_arena {
+    public:
+        /// creates an arena with room for the given number of limbs
+        explicit big_integer_arena(std::size_t capacity)
+                : _buffer(new _impl::big_limb[capacity]), _capacity(capacity), _used(0)
+        {
+        }
+
+        big_integer_arena(big_integer_arena const&) = delete;
+
+        big_integer_arena& operator=(big_integer_arena const&) = delete;
+
+        /// returns a pointer to room for size limbs, or nullptr if the arena is exhausted
+        CNL_NODISCARD _impl::big_limb* allocate(std::size_t size) noexcept
+        {
+            if (size>_capacity-_used) {
+                return nullptr;
+            }
+            auto* const limbs = _buffer.get()+_used;
+            _used += size;
+            return limbs;
+        }
+
+        /// returns true iff limbs were allocated from this arena
+        CNL_NODISCARD bool owns(_impl::big_limb const* limbs) const noexcept
+        {
+            return limbs>=_buffer.get() && limbs<_buffer.get()+_capacity;
+        }
+
+        /// makes all of the arena available for allocation
+        void release() noexcept
+        {
+            _used = 0;
+        }
+
+        CNL_NODISCARD std::size_t capacity() const noexcept
+        {
+            return _capacity;
+        }
+
+        /// returns the number of limbs allocated since construction or the last call to \ref release
+        CNL_NODISCARD std::size_t used() const noexcept
+        {
+            return _used;
+        }
+
+        /// returns the arena of the innermost \ref scope on this thread or nullptr if there is none
+        CNL_NODISCARD static big_integer_arena* current() noexcept
+        {
+            return _current();
+        }
+
+        /// \brief makes an arena current on this thread for the lifetime of the scope
+        class scope {
+        public:
+            explicit scope(big_integer_arena& arena) noexcept
+                    : _previous(_current())
+            {
+                _current() = &arena;
+            }
+
+            scope(scope const&) = delete;
+
+            scope& operator=(scope const&) = delete;
+
+            ~scope()
+            {
+                _current() = _previous;
+            }
+
+        private:
+            big_integer_arena* _previous;
+        };
+
+    private:
+        static big_integer_arena*& _current() noexcept
+        {
+            static thread_local big_integer_arena* arena = nullptr;
+            return arena;
+        }
+
+        std::unique_ptr<_impl::big_limb[]> _buffer;
+        std::size_t _capacity;
+        std::size_t _used;
+    };
+
+    /// \brief allocator of limbs which draws upon a \ref big_integer_arena and falls back to the heap
+    ///
+    /// A default-constructed allocator uses the current arena of the thread on which it is constructed, if any.
+    ///
+    /// \headerfile cnl/big_integer.h
+    /// \sa cnl::big_integer_arena, cnl::arena_big_integer
+    class big_integer_arena_allocator {
+    public:
+        using value_type = _impl::big_limb;
+
+        big_integer_arena_allocator() noexcept
+                : _arena(big_integer_arena::current())
+        {
+        }
+
+        explicit big_integer_arena_allocator(big_integer_arena& arena) noexcept
+                : _arena(&arena)
+        {
+        }
+
+        CNL_NODISCARD value_type* allocate(std::size_t size)
+        {
+            auto* const limbs = _arena ? _arena->allocate(size) : nullptr;
+            return limbs ? limbs : std::allocator<value_type>{}.allocate(size);
+        }
+
+        void deallocate(value_type* limbs, std::size_t size) noexcept
+        {
+            if (!_arena || !_arena->owns(limbs)) {
+                std::allocator<value_type>{}.deallocate(limbs, size);
+            }
+        }
+
+        CNL_NODISCARD big_integer_arena* arena() const noexcept
+        {
+            return _arena;
+        }
+
+        CNL_NODISCARD friend bool operator==(
+                big_integer_arena_allocator const& lhs, big_integer_arena_allocator const& rhs) noexcept
+        {
+            return lhs._arena==rhs._arena;
+        }
+
+        CNL_NODISCARD friend bool operator!=(
+                big_integer_arena_allocator const& lhs, big_integer_arena_allocator const& rhs) noexcept
+        {
+            return lhs._arena!=rhs._arena;
+        }
+
+    private:
+        big_integer_arena* _arena;
+    };
+}
+
+#endif  // CNL_IMPL_BIG_INTEGER_ARENA_H
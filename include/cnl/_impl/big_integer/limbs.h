@@ -0,0 +1,278 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_BIG_INTEGER_LIMBS_H)
+#define CNL_IMPL_BIG_INTEGER_LIMBS_H
+
+#include "../../bit.h"
+#include "../config.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::big_limb
+
+        // unit of storage of big_integer; products and sums of two limbs are calculated in big_double_limb
+        using big_limb = std::uint32_t;
+        using big_double_limb = std::uint64_t;
+
+        constexpr int big_limb_digits = 32;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // limb kernels
+        //
+        // Each function operates upon magnitudes stored as arrays of limbs, least significant first.
+        // Sizes are in limbs and a normalized magnitude has no most significant zero limbs.
+        // Unless stated otherwise, the output may alias an input.
+
+        // returns the size of the magnitude once its most significant zero limbs are removed
+        inline std::size_t big_limbs_normalize(big_limb const* limbs, std::size_t size)
+        {
+            while (size && !limbs[size-1]) {
+                --size;
+            }
+            return size;
+        }
+
+        // returns -1, 0 or 1 as lhs is less than, equal to or greater than rhs; both must be normalized
+        inline int big_limbs_compare(
+                big_limb const* lhs, std::size_t lhs_size, big_limb const* rhs, std::size_t rhs_size)
+        {
+            if (lhs_size!=rhs_size) {
+                return (lhs_size<rhs_size) ? -1 : 1;
+            }
+            for (auto index = lhs_size; index; --index) {
+                if (lhs[index-1]!=rhs[index-1]) {
+                    return (lhs[index-1]<rhs[index-1]) ? -1 : 1;
+                }
+            }
+            return 0;
+        }
+
+        // out = lhs+rhs; out has room for one more limb than the larger operand; returns the size of out
+        inline std::size_t big_limbs_add(
+                big_limb* out,
+                big_limb const* lhs, std::size_t lhs_size, big_limb const* rhs, std::size_t rhs_size)
+        {
+            auto const size = (lhs_size>rhs_size) ? lhs_size : rhs_size;
+            big_double_limb carry = 0;
+            for (std::size_t index = 0; index!=size; ++index) {
+                carry += (index<lhs_size) ? lhs[index] : big_limb{0};
+                carry += (index<rhs_size) ? rhs[index] : big_limb{0};
+                out[index] = static_cast<big_limb>(carry);
+                carry >>= big_limb_digits;
+            }
+            out[size] = static_cast<big_limb>(carry);
+            return size+static_cast<std::size_t>(carry);
+        }
+
+        // out = lhs-rhs where lhs is no less than rhs; returns the normalized size of out
+        inline std::size_t big_limbs_subtract(
+                big_limb* out,
+                big_limb const* lhs, std::size_t lhs_size, big_limb const* rhs, std::size_t rhs_size)
+        {
+            big_limb borrow = 0;
+            for (std::size_t index = 0; index!=lhs_size; ++index) {
+                auto const subtrahend = big_double_limb{(index<rhs_size) ? rhs[index] : big_limb{0}}+borrow;
+                auto const minuend = big_double_limb{lhs[index]};
+                out[index] = static_cast<big_limb>(minuend-subtrahend);
+                borrow = big_limb{minuend<subtrahend};
+            }
+            return big_limbs_normalize(out, lhs_size);
+        }
+
+        // out = lhs*rhs; out has room for lhs_size+rhs_size limbs and may alias lhs but not rhs;
+        // returns the normalized size of out
+        inline std::size_t big_limbs_multiply(
+                big_limb* out,
+                big_limb const* lhs, std::size_t lhs_size, big_limb const* rhs, std::size_t rhs_size)
+        {
+            for (auto index = lhs_size; index!=lhs_size+rhs_size; ++index) {
+                out[index] = 0;
+            }
+
+            // from the most significant limb of lhs, so that each is read before its place in out is written
+            for (auto lhs_index = lhs_size; lhs_index; --lhs_index) {
+                auto const offset = lhs_index-1;
+                auto const factor = big_double_limb{lhs[offset]};
+                out[offset] = 0;
+                big_double_limb carry = 0;
+                for (std::size_t rhs_index = 0; rhs_index!=rhs_size; ++rhs_index) {
+                    carry += factor*rhs[rhs_index]+out[offset+rhs_index];
+                    out[offset+rhs_index] = static_cast<big_limb>(carry);
+                    carry >>= big_limb_digits;
+                }
+                for (auto index = offset+rhs_size; carry; ++index) {
+                    carry += out[index];
+                    out[index] = static_cast<big_limb>(carry);
+                    carry >>= big_limb_digits;
+                }
+            }
+            return big_limbs_normalize(out, lhs_size+rhs_size);
+        }
+
+        // quotient = lhs/divisor where divisor is non-zero; returns the remainder
+        inline big_limb big_limbs_divide_limb(
+                big_limb* quotient, big_limb const* lhs, std::size_t lhs_size, big_limb divisor)
+        {
+            big_double_limb remainder = 0;
+            for (auto index = lhs_size; index; --index) {
+                auto const dividend = (remainder << big_limb_digits) | lhs[index-1];
+                quotient[index-1] = static_cast<big_limb>(dividend/divisor);
+                remainder = dividend%divisor;
+            }
+            return static_cast<big_limb>(remainder);
+        }
+
+        // out = in << shift; out has room for size+shift/big_limb_digits+1 limbs; returns the size of out
+        inline std::size_t big_limbs_shift_left(big_limb* out, big_limb const* in, std::size_t size, int shift)
+        {
+            if (!size) {
+                return 0;
+            }
+            auto const limb_shift = static_cast<std::size_t>(shift/big_limb_digits);
+            auto const bit_shift = shift%big_limb_digits;
+            out[size+limb_shift] = bit_shift ? static_cast<big_limb>(in[size-1] >> (big_limb_digits-bit_shift)) : 0;
+            for (auto index = size-1; index; --index) {
+                out[index+limb_shift] = bit_shift
+                        ? static_cast<big_limb>((in[index] << bit_shift) | (in[index-1] >> (big_limb_digits-bit_shift)))
+                        : in[index];
+            }
+            out[limb_shift] = static_cast<big_limb>(in[0] << bit_shift);
+            for (std::size_t index = 0; index!=limb_shift; ++index) {
+                out[index] = 0;
+            }
+            return big_limbs_normalize(out, size+limb_shift+1);
+        }
+
+        // out = in >> shift; returns the normalized size of out
+        inline std::size_t big_limbs_shift_right(big_limb* out, big_limb const* in, std::size_t size, int shift)
+        {
+            auto const limb_shift = static_cast<std::size_t>(shift/big_limb_digits);
+            auto const bit_shift = shift%big_limb_digits;
+            if (limb_shift>=size) {
+                return 0;
+            }
+            auto const out_size = size-limb_shift;
+            for (std::size_t index = 0; index!=out_size-1; ++index) {
+                out[index] = bit_shift
+                        ? static_cast<big_limb>(
+                                (in[index+limb_shift] >> bit_shift)
+                                | (in[index+limb_shift+1] << (big_limb_digits-bit_shift)))
+                        : in[index+limb_shift];
+            }
+            out[out_size-1] = static_cast<big_limb>(in[size-1] >> bit_shift);
+            return big_limbs_normalize(out, out_size);
+        }
+
+        // returns true iff any of the bits shifted out by big_limbs_shift_right are set
+        inline bool big_limbs_any_below(big_limb const* in, std::size_t size, int shift)
+        {
+            auto const limb_shift = static_cast<std::size_t>(shift/big_limb_digits);
+            for (std::size_t index = 0; index!=limb_shift && index!=size; ++index) {
+                if (in[index]) {
+                    return true;
+                }
+            }
+            return limb_shift<size && (in[limb_shift] & ((big_limb{1} << (shift%big_limb_digits))-1u));
+        }
+
+        // divides the normalized magnitude, dividend, of dividend_size limbs by the normalized magnitude, divisor,
+        // of divisor_size limbs, where 2<=divisor_size<=dividend_size, using Knuth's Algorithm D;
+        // quotient has room for dividend_size-divisor_size+1 limbs and remainder for divisor_size limbs;
+        // scratch has room for dividend_size+divisor_size+1 limbs; no argument may alias another
+        inline void big_limbs_divide(
+                big_limb* quotient, big_limb* remainder, big_limb* scratch,
+                big_limb const* dividend, std::size_t dividend_size,
+                big_limb const* divisor, std::size_t divisor_size)
+        {
+            // normalize so that the most significant bit of the divisor is set
+            auto const shift = countl_zero(divisor[divisor_size-1]);
+            auto* const normal_divisor = scratch;
+            auto* const normal_dividend = scratch+divisor_size;
+            for (auto index = divisor_size-1; index; --index) {
+                normal_divisor[index] = shift
+                        ? static_cast<big_limb>(
+                                (divisor[index] << shift) | (divisor[index-1] >> (big_limb_digits-shift)))
+                        : divisor[index];
+            }
+            normal_divisor[0] = static_cast<big_limb>(divisor[0] << shift);
+            normal_dividend[dividend_size] = shift
+                    ? static_cast<big_limb>(dividend[dividend_size-1] >> (big_limb_digits-shift))
+                    : big_limb{0};
+            for (auto index = dividend_size-1; index; --index) {
+                normal_dividend[index] = shift
+                        ? static_cast<big_limb>(
+                                (dividend[index] << shift) | (dividend[index-1] >> (big_limb_digits-shift)))
+                        : dividend[index];
+            }
+            normal_dividend[0] = static_cast<big_limb>(dividend[0] << shift);
+
+            auto const base = big_double_limb{1} << big_limb_digits;
+            auto const top = big_double_limb{normal_divisor[divisor_size-1]};
+            auto const next = big_double_limb{normal_divisor[divisor_size-2]};
+            for (auto index = dividend_size-divisor_size+1; index; --index) {
+                auto const j = index-1;
+
+                // estimate the quotient limb from the top two limbs of the remaining dividend
+                auto const numerator =
+                        (big_double_limb{normal_dividend[j+divisor_size]} << big_limb_digits)
+                        | normal_dividend[j+divisor_size-1];
+                auto estimate = numerator/top;
+                auto estimate_remainder = numerator%top;
+                while (estimate>=base
+                        || estimate*next
+                                >((estimate_remainder << big_limb_digits) | normal_dividend[j+divisor_size-2])) {
+                    --estimate;
+                    estimate_remainder += top;
+                    if (estimate_remainder>=base) {
+                        break;
+                    }
+                }
+
+                // subtract estimate*divisor from the remaining dividend
+                std::int64_t borrow = 0;
+                for (std::size_t i = 0; i!=divisor_size; ++i) {
+                    auto const product = estimate*normal_divisor[i];
+                    auto const difference = static_cast<std::int64_t>(normal_dividend[i+j])-borrow
+                            -static_cast<std::int64_t>(product & (base-1));
+                    normal_dividend[i+j] = static_cast<big_limb>(difference);
+                    borrow = static_cast<std::int64_t>(product >> big_limb_digits)-(difference >> big_limb_digits);
+                }
+                auto const difference = static_cast<std::int64_t>(normal_dividend[j+divisor_size])-borrow;
+                normal_dividend[j+divisor_size] = static_cast<big_limb>(difference);
+
+                // the estimate was one too great; add the divisor back
+                if (difference<0) {
+                    --estimate;
+                    big_double_limb carry = 0;
+                    for (std::size_t i = 0; i!=divisor_size; ++i) {
+                        carry += big_double_limb{normal_dividend[i+j]}+normal_divisor[i];
+                        normal_dividend[i+j] = static_cast<big_limb>(carry);
+                        carry >>= big_limb_digits;
+                    }
+                    normal_dividend[j+divisor_size] = static_cast<big_limb>(normal_dividend[j+divisor_size]+carry);
+                }
+                quotient[j] = static_cast<big_limb>(estimate);
+            }
+
+            // undo normalization of the remainder
+            for (std::size_t index = 0; index!=divisor_size; ++index) {
+                remainder[index] = shift
+                        ? static_cast<big_limb>(
+                                (normal_dividend[index] >> shift)
+                                | (normal_dividend[index+1] << (big_limb_digits-shift)))
+                        : normal_dividend[index];
+            }
+        }
+    }
+}
+
+#endif  // CNL_IMPL_BIG_INTEGER_LIMBS_H
@@ -0,0 +1,197 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_BIG_INTEGER_NUM_TRAITS_H)
+#define CNL_IMPL_BIG_INTEGER_NUM_TRAITS_H
+
+#include "../../limits.h"
+#include "../../rounding.h"
+#include "../config.h"
+#include "../num_traits/digits.h"
+#include "../num_traits/from_value.h"
+#include "../num_traits/rounding.h"
+#include "../num_traits/scale.h"
+#include "../num_traits/set_digits.h"
+#include "../type_traits/add_signedness.h"
+#include "../type_traits/enable_if.h"
+#include "../type_traits/is_integral.h"
+#include "../type_traits/is_signed.h"
+#include "../type_traits/remove_signedness.h"
+#include "../type_traits/type_identity.h"
+#include "operators.h"
+#include "type.h"
+
+#include <climits>
+#include <limits>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        template<typename T>
+        struct is_big_integer : std::false_type {
+        };
+
+        template<class Allocator>
+        struct is_big_integer<basic_big_integer<Allocator>> : std::true_type {
+        };
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // type traits of cnl::basic_big_integer
+    //
+    // The type has no fixed width, so it is its own signed, unsigned and widened type.
+
+    template<class Allocator>
+    struct is_signed<basic_big_integer<Allocator>> : std::true_type {
+    };
+
+    template<class Allocator>
+    struct add_signedness<basic_big_integer<Allocator>>
+            : _impl::type_identity<basic_big_integer<Allocator>> {
+    };
+
+    template<class Allocator>
+    struct remove_signedness<basic_big_integer<Allocator>>
+            : _impl::type_identity<basic_big_integer<Allocator>> {
+    };
+
+    template<class Allocator>
+    struct digits<basic_big_integer<Allocator>>
+            : std::integral_constant<int, numeric_limits<basic_big_integer<Allocator>>::digits> {
+    };
+
+    template<class Allocator, int MinNumDigits>
+    struct set_digits<basic_big_integer<Allocator>, MinNumDigits>
+            : _impl::type_identity<basic_big_integer<Allocator>> {
+    };
+
+    template<class Allocator>
+    struct rounding<basic_big_integer<Allocator>>
+            : _impl::type_identity<native_rounding_tag> {
+    };
+
+    template<class Allocator, class Value>
+    struct from_value<
+            basic_big_integer<Allocator>, Value,
+            _impl::enable_if_t<_impl::is_integral<Value>::value || _impl::is_big_integer<Value>::value>> {
+        CNL_NODISCARD basic_big_integer<Allocator> operator()(Value const& value) const
+        {
+            return basic_big_integer<Allocator>(value);
+        }
+    };
+
+    // multiplication and division by powers of two are shifts
+    template<int Digits, class Allocator>
+    struct scale<Digits, 2, basic_big_integer<Allocator>> {
+        CNL_NODISCARD basic_big_integer<Allocator> operator()(basic_big_integer<Allocator> const& s) const
+        {
+            return (*this)(basic_big_integer<Allocator>(s));
+        }
+
+        CNL_NODISCARD basic_big_integer<Allocator> operator()(basic_big_integer<Allocator>&& s) const
+        {
+            // as with the division of fundamental integers, scaling down truncates toward zero
+            return std::move((Digits>=0) ? (s <<= Digits) : s.shift_right_truncate(-Digits));
+        }
+    };
+
+    template<int Digits, int Radix, class Allocator>
+    struct scale<Digits, Radix, basic_big_integer<Allocator>, _impl::enable_if_t<Radix!=2>>
+            : _impl::default_scale<Digits, Radix, basic_big_integer<Allocator>> {
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // cnl::numeric_limits<cnl::basic_big_integer>
+
+    template<class Allocator>
+    struct numeric_limits<basic_big_integer<Allocator>> {
+        using _value_type = basic_big_integer<Allocator>;
+
+        static constexpr bool is_specialized = true;
+        static constexpr bool is_signed = true;
+        static constexpr bool is_integer = true;
+        static constexpr bool is_exact = true;
+        static constexpr bool has_infinity = false;
+        static constexpr bool has_quiet_NaN = false;
+        static constexpr bool has_signaling_NaN = false;
+        static constexpr std::float_denorm_style has_denorm = std::denorm_absent;
+        static constexpr bool has_denorm_loss = false;
+        static constexpr std::float_round_style round_style = std::round_toward_zero;
+        static constexpr bool is_iec559 = false;
+        static constexpr bool is_bounded = false;
+        static constexpr bool is_modulo = false;
+
+        // unbounded; as great as can be represented without risk of overflow in arithmetic upon digits
+        static constexpr int digits = INT_MAX/4;
+        static constexpr int digits10 = digits/4;
+        static constexpr int max_digits10 = 0;
+        static constexpr int radix = 2;
+        static constexpr int min_exponent = 0;
+        static constexpr int min_exponent10 = 0;
+        static constexpr int max_exponent = 0;
+        static constexpr int max_exponent10 = 0;
+        static constexpr bool traps = true;
+        static constexpr bool tinyness_before = false;
+
+        CNL_NODISCARD static _value_type min() noexcept
+        {
+            return _value_type();
+        }
+
+        CNL_NODISCARD static _value_type max() noexcept
+        {
+            return _value_type();
+        }
+
+        CNL_NODISCARD static _value_type lowest() noexcept
+        {
+            return _value_type();
+        }
+
+        CNL_NODISCARD static _value_type epsilon() noexcept
+        {
+            return _value_type();
+        }
+
+        CNL_NODISCARD static _value_type round_error() noexcept
+        {
+            return _value_type();
+        }
+
+        CNL_NODISCARD static _value_type infinity() noexcept
+        {
+            return _value_type();
+        }
+
+        CNL_NODISCARD static _value_type quiet_NaN() noexcept
+        {
+            return _value_type();
+        }
+
+        CNL_NODISCARD static _value_type signaling_NaN() noexcept
+        {
+            return _value_type();
+        }
+
+        CNL_NODISCARD static _value_type denorm_min() noexcept
+        {
+            return _value_type();
+        }
+    };
+
+    template<class Allocator>
+    constexpr int numeric_limits<basic_big_integer<Allocator>>::digits;
+}
+
+namespace std {
+    template<class Allocator>
+    struct numeric_limits<cnl::basic_big_integer<Allocator>>
+            : cnl::numeric_limits<cnl::basic_big_integer<Allocator>> {
+    };
+}
+
+#endif  // CNL_IMPL_BIG_INTEGER_NUM_TRAITS_H
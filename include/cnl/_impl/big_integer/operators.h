@@ -0,0 +1,196 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_BIG_INTEGER_OPERATORS_H)
+#define CNL_IMPL_BIG_INTEGER_OPERATORS_H
+
+#include "../config.h"
+#include "../type_traits/enable_if.h"
+#include "../type_traits/is_integral.h"
+#include "type.h"
+
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    ////////////////////////////////////////////////////////////////////////////////
+    // unary operators
+
+    template<class Allocator>
+    CNL_NODISCARD basic_big_integer<Allocator> operator+(basic_big_integer<Allocator> const& operand)
+    {
+        return operand;
+    }
+
+    template<class Allocator>
+    CNL_NODISCARD basic_big_integer<Allocator> operator-(basic_big_integer<Allocator> const& operand)
+    {
+        auto result = operand;
+        result.negate();
+        return result;
+    }
+
+    template<class Allocator>
+    CNL_NODISCARD basic_big_integer<Allocator> operator-(basic_big_integer<Allocator>&& operand)
+    {
+        operand.negate();
+        return std::move(operand);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // binary arithmetic operators
+
+    // the result of an operation with an rvalue left-hand operand is calculated in that operand's storage
+#define CNL_IMPL_BIG_INTEGER_ARITHMETIC_OPERATOR(OP, COMPOUND_OP) \
+    template<class Allocator> \
+    CNL_NODISCARD basic_big_integer<Allocator> operator OP( \
+            basic_big_integer<Allocator> const& lhs, basic_big_integer<Allocator> const& rhs) \
+    { \
+        auto result = lhs; \
+        result COMPOUND_OP rhs; \
+        return result; \
+    } \
+    \
+    template<class Allocator> \
+    CNL_NODISCARD basic_big_integer<Allocator> operator OP( \
+            basic_big_integer<Allocator>&& lhs, basic_big_integer<Allocator> const& rhs) \
+    { \
+        lhs COMPOUND_OP rhs; \
+        return std::move(lhs); \
+    } \
+    \
+    template<class Allocator, typename Integer, _impl::enable_if_t<_impl::is_integral<Integer>::value, int> = 0> \
+    CNL_NODISCARD basic_big_integer<Allocator> operator OP( \
+            basic_big_integer<Allocator> const& lhs, Integer const& rhs) \
+    { \
+        return lhs OP basic_big_integer<Allocator>(rhs, lhs.get_allocator()); \
+    } \
+    \
+    template<class Allocator, typename Integer, _impl::enable_if_t<_impl::is_integral<Integer>::value, int> = 0> \
+    CNL_NODISCARD basic_big_integer<Allocator> operator OP( \
+            basic_big_integer<Allocator>&& lhs, Integer const& rhs) \
+    { \
+        lhs COMPOUND_OP basic_big_integer<Allocator>(rhs, lhs.get_allocator()); \
+        return std::move(lhs); \
+    } \
+    \
+    template<class Allocator, typename Integer, _impl::enable_if_t<_impl::is_integral<Integer>::value, int> = 0> \
+    CNL_NODISCARD basic_big_integer<Allocator> operator OP( \
+            Integer const& lhs, basic_big_integer<Allocator> const& rhs) \
+    { \
+        return basic_big_integer<Allocator>(lhs, rhs.get_allocator()) OP rhs; \
+    }
+
+    CNL_IMPL_BIG_INTEGER_ARITHMETIC_OPERATOR(+, +=)
+
+    CNL_IMPL_BIG_INTEGER_ARITHMETIC_OPERATOR(-, -=)
+
+    CNL_IMPL_BIG_INTEGER_ARITHMETIC_OPERATOR(*, *=)
+
+    CNL_IMPL_BIG_INTEGER_ARITHMETIC_OPERATOR(/, /=)
+
+    CNL_IMPL_BIG_INTEGER_ARITHMETIC_OPERATOR(%, %=)
+
+#undef CNL_IMPL_BIG_INTEGER_ARITHMETIC_OPERATOR
+
+    // addition and multiplication commute, so the storage of an rvalue right-hand operand is reused too
+#define CNL_IMPL_BIG_INTEGER_COMMUTATIVE_OPERATOR(OP, COMPOUND_OP) \
+    template<class Allocator> \
+    CNL_NODISCARD basic_big_integer<Allocator> operator OP( \
+            basic_big_integer<Allocator> const& lhs, basic_big_integer<Allocator>&& rhs) \
+    { \
+        rhs COMPOUND_OP lhs; \
+        return std::move(rhs); \
+    } \
+    \
+    template<class Allocator> \
+    CNL_NODISCARD basic_big_integer<Allocator> operator OP( \
+            basic_big_integer<Allocator>&& lhs, basic_big_integer<Allocator>&& rhs) \
+    { \
+        lhs COMPOUND_OP rhs; \
+        return std::move(lhs); \
+    } \
+    \
+    template<class Allocator, typename Integer, _impl::enable_if_t<_impl::is_integral<Integer>::value, int> = 0> \
+    CNL_NODISCARD basic_big_integer<Allocator> operator OP( \
+            Integer const& lhs, basic_big_integer<Allocator>&& rhs) \
+    { \
+        rhs COMPOUND_OP basic_big_integer<Allocator>(lhs, rhs.get_allocator()); \
+        return std::move(rhs); \
+    }
+
+    CNL_IMPL_BIG_INTEGER_COMMUTATIVE_OPERATOR(+, +=)
+
+    CNL_IMPL_BIG_INTEGER_COMMUTATIVE_OPERATOR(*, *=)
+
+#undef CNL_IMPL_BIG_INTEGER_COMMUTATIVE_OPERATOR
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // shift operators
+
+#define CNL_IMPL_BIG_INTEGER_SHIFT_OPERATOR(OP, COMPOUND_OP) \
+    template<class Allocator, typename Integer, _impl::enable_if_t<_impl::is_integral<Integer>::value, int> = 0> \
+    CNL_NODISCARD basic_big_integer<Allocator> operator OP( \
+            basic_big_integer<Allocator> const& lhs, Integer const& rhs) \
+    { \
+        auto result = lhs; \
+        result COMPOUND_OP static_cast<int>(rhs); \
+        return result; \
+    } \
+    \
+    template<class Allocator, typename Integer, _impl::enable_if_t<_impl::is_integral<Integer>::value, int> = 0> \
+    CNL_NODISCARD basic_big_integer<Allocator> operator OP( \
+            basic_big_integer<Allocator>&& lhs, Integer const& rhs) \
+    { \
+        lhs COMPOUND_OP static_cast<int>(rhs); \
+        return std::move(lhs); \
+    }
+
+    CNL_IMPL_BIG_INTEGER_SHIFT_OPERATOR(<<, <<=)
+
+    CNL_IMPL_BIG_INTEGER_SHIFT_OPERATOR(>>, >>=)
+
+#undef CNL_IMPL_BIG_INTEGER_SHIFT_OPERATOR
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // comparison operators
+
+#define CNL_IMPL_BIG_INTEGER_COMPARISON_OPERATOR(OP) \
+    template<class Allocator> \
+    CNL_NODISCARD bool operator OP( \
+            basic_big_integer<Allocator> const& lhs, basic_big_integer<Allocator> const& rhs) \
+    { \
+        return compare(lhs, rhs) OP 0; \
+    } \
+    \
+    template<class Allocator, typename Integer, _impl::enable_if_t<_impl::is_integral<Integer>::value, int> = 0> \
+    CNL_NODISCARD bool operator OP(basic_big_integer<Allocator> const& lhs, Integer const& rhs) \
+    { \
+        return compare(lhs, basic_big_integer<Allocator>(rhs, lhs.get_allocator())) OP 0; \
+    } \
+    \
+    template<class Allocator, typename Integer, _impl::enable_if_t<_impl::is_integral<Integer>::value, int> = 0> \
+    CNL_NODISCARD bool operator OP(Integer const& lhs, basic_big_integer<Allocator> const& rhs) \
+    { \
+        return compare(basic_big_integer<Allocator>(lhs, rhs.get_allocator()), rhs) OP 0; \
+    }
+
+    CNL_IMPL_BIG_INTEGER_COMPARISON_OPERATOR(==)
+
+    CNL_IMPL_BIG_INTEGER_COMPARISON_OPERATOR(!=)
+
+    CNL_IMPL_BIG_INTEGER_COMPARISON_OPERATOR(<)
+
+    CNL_IMPL_BIG_INTEGER_COMPARISON_OPERATOR(>)
+
+    CNL_IMPL_BIG_INTEGER_COMPARISON_OPERATOR(<=)
+
+    CNL_IMPL_BIG_INTEGER_COMPARISON_OPERATOR(>=)
+
+#undef CNL_IMPL_BIG_INTEGER_COMPARISON_OPERATOR
+}
+
+#endif  // CNL_IMPL_BIG_INTEGER_OPERATORS_H
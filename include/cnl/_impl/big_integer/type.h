@@ -0,0 +1,462 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_BIG_INTEGER_TYPE_H)
+#define CNL_IMPL_BIG_INTEGER_TYPE_H
+
+#include "../common.h"
+#include "../config.h"
+#include "../num_traits/set_digits.h"
+#include "../type_traits/enable_if.h"
+#include "../type_traits/is_integral.h"
+#include "../type_traits/is_signed.h"
+#include "../type_traits/remove_signedness.h"
+#include "arena.h"
+#include "limbs.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::big_integer_is_negative / big_integer_magnitude
+
+        template<typename Integer>
+        CNL_NODISCARD constexpr bool big_integer_is_negative(Integer const& value)
+        {
+            return is_signed<Integer>::value && value<Integer{0};
+        }
+
+        // absolute value as an unsigned integer
+        template<typename Integer>
+        CNL_NODISCARD constexpr remove_signedness_t<Integer> big_integer_magnitude(Integer const& value)
+        {
+            return big_integer_is_negative(value)
+                   ? static_cast<remove_signedness_t<Integer>>(
+                            remove_signedness_t<Integer>{0}-static_cast<remove_signedness_t<Integer>>(value))
+                   : static_cast<remove_signedness_t<Integer>>(value);
+        }
+    }
+
+    /// \brief arbitrary-precision signed integer
+    ///
+    /// \tparam Allocator allocator of the limbs of values too great to be stored inline
+    ///
+    /// The magnitude is stored as 32-bit limbs alongside a sign.
+    /// Up to \ref inline_limbs limbs are stored within the object and only greater values allocate.
+    /// Allocated storage grows geometrically and is never released until destruction,
+    /// so a value which is repeatedly modified in place reallocates rarely.
+    ///
+    /// Arithmetic follows the rules of fundamental signed integers except that it never overflows:
+    /// division truncates toward zero, the remainder takes the sign of the dividend and
+    /// right shift rounds toward negative infinity.
+    /// Binary operators which take an rvalue operand reuse its storage for the result,
+    /// so a chain of operations such as `a+b-c` allocates no more than a single value.
+    ///
+    /// \note The type is suitable as the \c Rep of \ref cnl::scaled_integer.
+    ///
+    /// \headerfile cnl/big_integer.h
+    /// \sa cnl::big_integer, cnl::arena_big_integer
+    template<class Allocator = std::allocator<_impl::big_limb>>
+    class basic_big_integer {
+        using _allocator_traits = std::allocator_traits<Allocator>;
+    public:
+        using limb_type = _impl::big_limb;
+        using allocator_type = Allocator;
+        using size_type = std::size_t;
+
+        /// number of limbs which are stored without allocation
+        static constexpr size_type inline_limbs = 4;
+
+        /// initializes the value to zero
+        basic_big_integer() noexcept(noexcept(Allocator()))
+                : basic_big_integer(Allocator())
+        {
+        }
+
+        /// initializes the value to zero
+        explicit basic_big_integer(Allocator const& allocator) noexcept
+                : _allocator(allocator), _limbs(_inline), _size(0), _capacity(inline_limbs), _negative(false)
+        {
+        }
+
+        basic_big_integer(basic_big_integer const& other)
+                : basic_big_integer(other, _allocator_traits::select_on_container_copy_construction(other._allocator))
+        {
+        }
+
+        basic_big_integer(basic_big_integer const& other, Allocator const& allocator)
+                : basic_big_integer(allocator)
+        {
+            _assign(other._limbs, other._size, other._negative);
+        }
+
+        /// takes the storage of other, leaving it zero
+        basic_big_integer(basic_big_integer&& other) noexcept
+                : basic_big_integer(other._allocator)
+        {
+            _take(other);
+        }
+
+        /// initializes the value from an integer
+        template<typename S, _impl::enable_if_t<_impl::is_integral<S>::value, int> = 0>
+        // NOLINTNEXTLINE(hicpp-explicit-conversions)
+        basic_big_integer(S const& value, Allocator const& allocator = Allocator())
+                : basic_big_integer(allocator)
+        {
+            auto magnitude = _impl::big_integer_magnitude(value);
+            while (magnitude) {
+                _limbs[_size++] = static_cast<limb_type>(magnitude);
+                magnitude = static_cast<decltype(magnitude)>((magnitude >> (_impl::big_limb_digits/2))
+                        >> (_impl::big_limb_digits/2));
+            }
+            _negative = _impl::big_integer_is_negative(value);
+        }
+
+        /// initializes the value from a finite floating-point value, truncating toward zero
+        template<typename S, _impl::enable_if_t<std::is_floating_point<S>::value, int> = 0>
+        explicit basic_big_integer(S const& value, Allocator const& allocator = Allocator())
+                : basic_big_integer(allocator)
+        {
+            int exponent;
+            auto const fraction = std::frexp(std::fabs(value), &exponent);
+            if (exponent<=0) {
+                return;
+            }
+            constexpr auto fraction_digits = std::numeric_limits<S>::digits;
+            using fraction_type = set_digits_t<unsigned, fraction_digits>;
+            *this = basic_big_integer(static_cast<fraction_type>(std::ldexp(fraction, fraction_digits)), allocator);
+            if (exponent<fraction_digits) {
+                *this >>= fraction_digits-exponent;
+            }
+            else {
+                *this <<= exponent-fraction_digits;
+            }
+            _negative = _size && value<S{0};
+        }
+
+        ~basic_big_integer()
+        {
+            _deallocate();
+        }
+
+        basic_big_integer& operator=(basic_big_integer const& other)
+        {
+            if (this!=&other) {
+                _assign(other._limbs, other._size, other._negative);
+            }
+            return *this;
+        }
+
+        /// takes the storage of other if both allocators are equal, otherwise copies its value
+        basic_big_integer& operator=(basic_big_integer&& other)
+        {
+            if (this!=&other) {
+                if (_allocator==other._allocator) {
+                    _deallocate();
+                    _take(other);
+                }
+                else {
+                    _assign(other._limbs, other._size, other._negative);
+                }
+            }
+            return *this;
+        }
+
+        /// converts to an integer, keeping the low-order bits as conversion between fundamental integers does
+        template<typename S, _impl::enable_if_t<_impl::is_integral<S>::value, int> = 0>
+        CNL_NODISCARD explicit operator S() const
+        {
+            using unsigned_type = remove_signedness_t<S>;
+            unsigned_type magnitude{0};
+            for (auto index = _size; index; --index) {
+                magnitude = static_cast<unsigned_type>(
+                        ((magnitude << (_impl::big_limb_digits/2)) << (_impl::big_limb_digits/2))
+                        | _limbs[index-1]);
+            }
+            return static_cast<S>(_negative ? static_cast<unsigned_type>(unsigned_type{0}-magnitude) : magnitude);
+        }
+
+        /// converts to a floating-point value
+        template<typename S, _impl::enable_if_t<std::is_floating_point<S>::value, int> = 0>
+        CNL_NODISCARD explicit operator S() const
+        {
+            S magnitude{0};
+            for (auto index = _size; index; --index) {
+                magnitude = std::ldexp(magnitude, _impl::big_limb_digits)+static_cast<S>(_limbs[index-1]);
+            }
+            return _negative ? -magnitude : magnitude;
+        }
+
+        CNL_NODISCARD explicit operator bool() const noexcept
+        {
+            return _size!=0;
+        }
+
+        CNL_NODISCARD bool negative() const noexcept
+        {
+            return _negative;
+        }
+
+        /// returns the least significant limb of the magnitude
+        CNL_NODISCARD limb_type const* data() const noexcept
+        {
+            return _limbs;
+        }
+
+        /// returns the number of limbs in the magnitude; zero has no limbs
+        CNL_NODISCARD size_type size() const noexcept
+        {
+            return _size;
+        }
+
+        /// returns the number of limbs the magnitude can reach without allocation
+        CNL_NODISCARD size_type capacity() const noexcept
+        {
+            return _capacity;
+        }
+
+        CNL_NODISCARD allocator_type get_allocator() const noexcept
+        {
+            return _allocator;
+        }
+
+        /// ensures that the magnitude can reach the given number of limbs without allocation
+        void reserve(size_type capacity)
+        {
+            if (capacity<=_capacity) {
+                return;
+            }
+            auto const new_capacity = _impl::max(capacity, _capacity*2);
+            auto* const limbs = _allocator_traits::allocate(_allocator, new_capacity);
+            std::copy(_limbs, _limbs+_size, limbs);
+            _deallocate();
+            _limbs = limbs;
+            _capacity = new_capacity;
+        }
+
+        void negate() noexcept
+        {
+            _negative = _size && !_negative;
+        }
+
+        basic_big_integer& operator+=(basic_big_integer const& rhs)
+        {
+            if (this==&rhs) {
+                return *this <<= 1;
+            }
+            _add(rhs._limbs, rhs._size, rhs._negative);
+            return *this;
+        }
+
+        basic_big_integer& operator-=(basic_big_integer const& rhs)
+        {
+            if (this==&rhs) {
+                _size = 0;
+                _negative = false;
+                return *this;
+            }
+            _add(rhs._limbs, rhs._size, !rhs._negative);
+            return *this;
+        }
+
+        basic_big_integer& operator*=(basic_big_integer const& rhs)
+        {
+            if (this==&rhs) {
+                return *this *= basic_big_integer(rhs);
+            }
+            reserve(_size+rhs._size);
+            _size = _impl::big_limbs_multiply(_limbs, _limbs, _size, rhs._limbs, rhs._size);
+            _negative = (_negative!=rhs._negative) && _size;
+            return *this;
+        }
+
+        /// divides, truncating toward zero; the divisor must not be zero
+        basic_big_integer& operator/=(basic_big_integer const& rhs)
+        {
+            _divide(rhs, true);
+            return *this;
+        }
+
+        /// replaces the value with the remainder of division, which takes the sign of the dividend
+        basic_big_integer& operator%=(basic_big_integer const& rhs)
+        {
+            _divide(rhs, false);
+            return *this;
+        }
+
+        /// multiplies by two to the power of shift, which must not be negative
+        basic_big_integer& operator<<=(int shift)
+        {
+            if (_size) {
+                reserve(_size+static_cast<size_type>(shift/_impl::big_limb_digits)+1);
+                _size = _impl::big_limbs_shift_left(_limbs, _limbs, _size, shift);
+            }
+            return *this;
+        }
+
+        /// divides by two to the power of shift, which must not be negative, rounding toward negative infinity
+        basic_big_integer& operator>>=(int shift)
+        {
+            auto const round_away = _negative && _impl::big_limbs_any_below(_limbs, _size, shift);
+            _size = _impl::big_limbs_shift_right(_limbs, _limbs, _size, shift);
+            if (round_away) {
+                limb_type const one = 1;
+                _add(&one, 1, true);
+            }
+            _negative = _negative && _size;
+            return *this;
+        }
+
+        /// divides by two to the power of shift, which must not be negative, truncating toward zero
+        basic_big_integer& shift_right_truncate(int shift) noexcept
+        {
+            _size = _impl::big_limbs_shift_right(_limbs, _limbs, _size, shift);
+            _negative = _negative && _size;
+            return *this;
+        }
+
+        /// returns -1, 0 or 1 as lhs is less than, equal to or greater than rhs
+        CNL_NODISCARD friend int compare(basic_big_integer const& lhs, basic_big_integer const& rhs) noexcept
+        {
+            if (lhs._negative!=rhs._negative) {
+                return lhs._negative ? -1 : 1;
+            }
+            auto const magnitude = _impl::big_limbs_compare(lhs._limbs, lhs._size, rhs._limbs, rhs._size);
+            return lhs._negative ? -magnitude : magnitude;
+        }
+
+    private:
+        void _deallocate() noexcept
+        {
+            if (_limbs!=_inline) {
+                _allocator_traits::deallocate(_allocator, _limbs, _capacity);
+            }
+        }
+
+        // takes the storage of other and leaves it zero; this must hold no allocation
+        void _take(basic_big_integer& other) noexcept
+        {
+            if (other._limbs==other._inline) {
+                std::copy(other._limbs, other._limbs+other._size, _inline);
+                _limbs = _inline;
+                _capacity = inline_limbs;
+            }
+            else {
+                _limbs = other._limbs;
+                _capacity = other._capacity;
+                other._limbs = other._inline;
+                other._capacity = inline_limbs;
+            }
+            _size = other._size;
+            _negative = other._negative;
+            other._size = 0;
+            other._negative = false;
+        }
+
+        // limbs must not alias the storage of this object
+        void _assign(limb_type const* limbs, size_type size, bool negative)
+        {
+            reserve(size);
+            std::copy(limbs, limbs+size, _limbs);
+            _size = size;
+            _negative = negative && size;
+        }
+
+        // adds the value with the given magnitude and sign; limbs must not alias the storage of this object
+        void _add(limb_type const* limbs, size_type size, bool negative)
+        {
+            if (!size) {
+                return;
+            }
+            if (_negative==negative || !_size) {
+                reserve(_impl::max(_size, size)+1);
+                _size = _impl::big_limbs_add(_limbs, _limbs, _size, limbs, size);
+                _negative = negative;
+            }
+            else if (_impl::big_limbs_compare(_limbs, _size, limbs, size)>=0) {
+                _size = _impl::big_limbs_subtract(_limbs, _limbs, _size, limbs, size);
+                _negative = _negative && _size;
+            }
+            else {
+                reserve(size);
+                _size = _impl::big_limbs_subtract(_limbs, limbs, size, _limbs, _size);
+                _negative = negative;
+            }
+        }
+
+        // replaces the value with the quotient or the remainder of division by divisor
+        void _divide(basic_big_integer const& divisor, bool want_quotient)
+        {
+            if (_impl::big_limbs_compare(_limbs, _size, divisor._limbs, divisor._size)<0) {
+                if (want_quotient) {
+                    _size = 0;
+                    _negative = false;
+                }
+                return;
+            }
+            auto const quotient_negative = _negative!=divisor._negative;
+            if (divisor._size==1) {
+                auto const remainder = _impl::big_limbs_divide_limb(_limbs, _limbs, _size, divisor._limbs[0]);
+                if (want_quotient) {
+                    _size = _impl::big_limbs_normalize(_limbs, _size);
+                    _negative = quotient_negative && _size;
+                }
+                else {
+                    _limbs[0] = remainder;
+                    _size = remainder ? 1 : 0;
+                    _negative = _negative && _size;
+                }
+                return;
+            }
+
+            // quotient, remainder and scratch share one buffer
+            auto const quotient_size = _size-divisor._size+1;
+            basic_big_integer buffer(_allocator);
+            buffer.reserve(quotient_size+divisor._size+_size+divisor._size+1);
+            auto* const quotient = buffer._limbs;
+            auto* const remainder = quotient+quotient_size;
+            _impl::big_limbs_divide(
+                    quotient, remainder, remainder+divisor._size,
+                    _limbs, _size, divisor._limbs, divisor._size);
+            if (want_quotient) {
+                _assign(quotient, _impl::big_limbs_normalize(quotient, quotient_size), quotient_negative);
+            }
+            else {
+                _assign(remainder, _impl::big_limbs_normalize(remainder, divisor._size), _negative);
+            }
+        }
+
+        Allocator _allocator;
+        limb_type* _limbs;
+        size_type _size;
+        size_type _capacity;
+        bool _negative;
+        limb_type _inline[inline_limbs];
+    };
+
+    template<class Allocator>
+    constexpr typename basic_big_integer<Allocator>::size_type basic_big_integer<Allocator>::inline_limbs;
+
+    /// \brief arbitrary-precision signed integer which allocates from the heap
+    /// \headerfile cnl/big_integer.h
+    /// \sa cnl::basic_big_integer
+    using big_integer = basic_big_integer<>;
+
+    /// \brief arbitrary-precision signed integer which allocates from the current \ref cnl::big_integer_arena
+    /// \headerfile cnl/big_integer.h
+    /// \sa cnl::basic_big_integer, cnl::big_integer_arena::scope
+    using arena_big_integer = basic_big_integer<big_integer_arena_allocator>;
+}
+
+#endif  // CNL_IMPL_BIG_INTEGER_TYPE_H
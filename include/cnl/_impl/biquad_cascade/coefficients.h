@@ -0,0 +1,29 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_BIQUAD_CASCADE_COEFFICIENTS_H)
+#define CNL_IMPL_BIQUAD_CASCADE_COEFFICIENTS_H
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief coefficients of one section of a \ref cnl::biquad_cascade
+    ///
+    /// The section computes `y[n] = b0*x[n] + b1*x[n-1] + b2*x[n-2] - a1*y[n-1] - a2*y[n-2]`,
+    /// i.e. `a0` is normalized to one. As `a1` lies in the range (-2, 2) in a stable section,
+    /// \c Coeff typically has one more integer digit than the samples.
+    ///
+    /// \headerfile cnl/biquad_cascade.h
+    template<typename Coeff>
+    struct biquad_coefficients {
+        Coeff b0;
+        Coeff b1;
+        Coeff b2;
+        Coeff a1;
+        Coeff a2;
+    };
+}
+
+#endif  // CNL_IMPL_BIQUAD_CASCADE_COEFFICIENTS_H
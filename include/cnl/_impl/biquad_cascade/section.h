@@ -0,0 +1,137 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_BIQUAD_CASCADE_SECTION_H)
+#define CNL_IMPL_BIQUAD_CASCADE_SECTION_H
+
+#include "../config.h"
+#include "../exact_accumulator.h"
+#include "../num_traits/rep.h"
+#include "../num_traits/set_rep.h"
+#include "../operators/native_tag.h"
+#include "../operators/tagged.h"
+#include "coefficients.h"
+#include "tags.h"
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::biquad_quantizer
+
+        // rounds a sum of products to the precision of Sample and then saturates it to the range of Sample
+        template<typename Sample, typename Coeff, class RoundingTag, class OverflowTag>
+        struct biquad_quantizer {
+            // wide enough for the five products of a section and the fed-back rounding error
+            using accumulator = exact_product_sum_t<Sample, Coeff, sum_headroom(6)>;
+
+            // an accumulator with the precision of Sample
+            using rounded = set_rep_t<Sample, rep_t<accumulator>>;
+
+            CNL_NODISCARD static rounded round(accumulator const& sum)
+            {
+                return convert<RoundingTag, native_tag, rounded>(sum);
+            }
+
+            CNL_NODISCARD static Sample saturate(rounded const& sum)
+            {
+                return convert<OverflowTag, native_tag, Sample>(sum);
+            }
+
+            template<typename Lhs, typename Rhs>
+            CNL_NODISCARD static accumulator product(Lhs const& lhs, Rhs const& rhs)
+            {
+                return static_cast<accumulator>(exact_multiply(lhs, rhs));
+            }
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::biquad_section
+
+        // the state and update of a single section
+        template<class Form, typename Sample, typename Coeff, class RoundingTag, class OverflowTag>
+        struct biquad_section;
+
+        template<typename Sample, typename Coeff, class RoundingTag, class OverflowTag>
+        struct biquad_section<direct_form_1_tag, Sample, Coeff, RoundingTag, OverflowTag> {
+            using quantizer = biquad_quantizer<Sample, Coeff, RoundingTag, OverflowTag>;
+            using accumulator = typename quantizer::accumulator;
+
+            Sample operator()(biquad_coefficients<Coeff> const& c, Sample const& x)
+            {
+                auto const sum = static_cast<accumulator>(
+                        quantizer::product(x, c.b0)+quantizer::product(x1, c.b1)+quantizer::product(x2, c.b2)
+                                -quantizer::product(y1, c.a1)-quantizer::product(y2, c.a2));
+                auto const y = quantizer::saturate(quantizer::round(sum));
+
+                x2 = x1;
+                x1 = x;
+                y2 = y1;
+                y1 = y;
+                return y;
+            }
+
+            Sample x1;
+            Sample x2;
+            Sample y1;
+            Sample y2;
+        };
+
+        template<typename Sample, typename Coeff, class RoundingTag, class OverflowTag>
+        struct biquad_section<direct_form_1_error_feedback_tag, Sample, Coeff, RoundingTag, OverflowTag> {
+            using quantizer = biquad_quantizer<Sample, Coeff, RoundingTag, OverflowTag>;
+            using accumulator = typename quantizer::accumulator;
+
+            Sample operator()(biquad_coefficients<Coeff> const& c, Sample const& x)
+            {
+                auto const sum = static_cast<accumulator>(
+                        quantizer::product(x, c.b0)+quantizer::product(x1, c.b1)+quantizer::product(x2, c.b2)
+                                -quantizer::product(y1, c.a1)-quantizer::product(y2, c.a2)+error);
+                auto const rounded = quantizer::round(sum);
+                auto const y = quantizer::saturate(rounded);
+
+                error = static_cast<accumulator>(sum-static_cast<accumulator>(rounded));
+                x2 = x1;
+                x1 = x;
+                y2 = y1;
+                y1 = y;
+                return y;
+            }
+
+            Sample x1;
+            Sample x2;
+            Sample y1;
+            Sample y2;
+            accumulator error;
+        };
+
+        template<typename Sample, typename Coeff, class RoundingTag, class OverflowTag>
+        struct biquad_section<transposed_direct_form_2_tag, Sample, Coeff, RoundingTag, OverflowTag> {
+            using quantizer = biquad_quantizer<Sample, Coeff, RoundingTag, OverflowTag>;
+            using accumulator = typename quantizer::accumulator;
+
+            // full-precision product with room for the sum of two products and a state
+            using state = exact_product_sum_t<Sample, Coeff, 2>;
+
+            Sample operator()(biquad_coefficients<Coeff> const& c, Sample const& x)
+            {
+                auto const y = quantizer::saturate(quantizer::round(
+                        static_cast<accumulator>(quantizer::product(x, c.b0)+static_cast<accumulator>(s1))));
+
+                s1 = convert<OverflowTag, native_tag, state>(static_cast<accumulator>(
+                        quantizer::product(x, c.b1)-quantizer::product(y, c.a1)+static_cast<accumulator>(s2)));
+                s2 = convert<OverflowTag, native_tag, state>(static_cast<accumulator>(
+                        quantizer::product(x, c.b2)-quantizer::product(y, c.a2)));
+                return y;
+            }
+
+            state s1;
+            state s2;
+        };
+    }
+}
+
+#endif  // CNL_IMPL_BIQUAD_CASCADE_SECTION_H
@@ -0,0 +1,44 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_BIQUAD_CASCADE_TAGS_H)
+#define CNL_IMPL_BIQUAD_CASCADE_TAGS_H
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief tag to specify that each section of a \ref cnl::biquad_cascade is implemented in Direct Form I
+    ///
+    /// Past inputs and outputs are stored as samples and the output is rounded once per sample.
+    ///
+    /// \headerfile cnl/biquad_cascade.h
+    /// \sa cnl::direct_form_1_error_feedback_tag, cnl::transposed_direct_form_2_tag
+    struct direct_form_1_tag {
+    };
+
+    /// \brief tag to specify that each section of a \ref cnl::biquad_cascade is implemented in Direct Form I
+    /// with first-order error feedback
+    ///
+    /// The error introduced by rounding each output is added to the following sum of products,
+    /// which moves rounding noise away from low frequencies.
+    ///
+    /// \headerfile cnl/biquad_cascade.h
+    /// \sa cnl::direct_form_1_tag, cnl::transposed_direct_form_2_tag
+    struct direct_form_1_error_feedback_tag {
+    };
+
+    /// \brief tag to specify that each section of a \ref cnl::biquad_cascade is implemented
+    /// in transposed Direct Form II
+    ///
+    /// The two state variables are stored with the full precision of a product and saturate
+    /// rather than wrap; only the output is rounded.
+    ///
+    /// \headerfile cnl/biquad_cascade.h
+    /// \sa cnl::direct_form_1_tag, cnl::direct_form_1_error_feedback_tag
+    struct transposed_direct_form_2_tag {
+    };
+}
+
+#endif  // CNL_IMPL_BIQUAD_CASCADE_TAGS_H
@@ -0,0 +1,126 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_BIQUAD_CASCADE_TYPE_H)
+#define CNL_IMPL_BIQUAD_CASCADE_TYPE_H
+
+#include "../common.h"
+#include "../config.h"
+#include "../fixed_array/type.h"
+#include "../overflow/saturated.h"
+#include "../rounding/convert_operator.h"
+#include "../rounding/nearest_rounding_tag.h"
+#include "coefficients.h"
+#include "section.h"
+#include "tags.h"
+
+#include <cstddef>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief cascade of second-order IIR filter sections
+    ///
+    /// \tparam Sample the type of input and output samples and of the state between sections,
+    /// e.g. `scaled_integer<int16_t, power<-15>>`
+    /// \tparam Sections the number of second-order sections
+    /// \tparam Form the structure of each section, e.g. \ref cnl::direct_form_1_tag
+    /// \tparam Coeff the type of the coefficients, e.g. `scaled_integer<int16_t, power<-14>>`
+    /// \tparam RoundingTag the rounding applied when a sum of products is converted to \c Sample,
+    /// e.g. \ref cnl::nearest_rounding_tag or \ref cnl::native_rounding_tag
+    /// \tparam OverflowTag the overflow handling applied to outputs and state, e.g. \ref cnl::saturated_overflow_tag
+    ///
+    /// Within a section, products are summed without overflow and rounded once.
+    /// The output of each section then saturates (by default) rather than wrapping.
+    ///
+    /// \headerfile cnl/biquad_cascade.h
+    /// \sa cnl::biquad_coefficients, cnl::fir_filter
+    template<
+            typename Sample, std::size_t Sections,
+            class Form = direct_form_1_tag,
+            typename Coeff = Sample,
+            class RoundingTag = nearest_rounding_tag,
+            class OverflowTag = saturated_overflow_tag>
+    class biquad_cascade {
+        static_assert(Sections>0, "biquad_cascade must have at least one section");
+        using section_type = _impl::biquad_section<Form, Sample, Coeff, RoundingTag, OverflowTag>;
+    public:
+        using sample_type = Sample;
+        using coefficients_type = biquad_coefficients<Coeff>;
+
+        /// returns the number of second-order sections
+        CNL_NODISCARD static constexpr std::size_t sections() noexcept
+        {
+            return Sections;
+        }
+
+        /// creates a filter with the given coefficients and a state of zeros
+        explicit biquad_cascade(fixed_array<coefficients_type, Sections> const& coefficients)
+                : _coefficients(coefficients), _sections()
+        {
+        }
+
+        /// sets the state of every section to zero
+        void reset()
+        {
+            _sections = fixed_array<section_type, Sections>{};
+        }
+
+        /// consumes one input and returns the corresponding output
+        Sample operator()(Sample const& input)
+        {
+            auto sample = input;
+            for (std::size_t section = 0; section!=Sections; ++section) {
+                sample = _sections[section](_coefficients[section], sample);
+            }
+            return sample;
+        }
+
+        /// consumes \c size inputs and writes the corresponding outputs
+        ///
+        /// Sections are interleaved: at each step, section \c s processes the sample that entered the
+        /// cascade \c s steps earlier, so the updates of different sections within a step are independent.
+        /// The outputs are identical to those of calling \ref operator()() for each input in turn.
+        void process(Sample const* input, Sample* output, std::size_t size)
+        {
+            if (size==0) {
+                return;
+            }
+
+            // the output of each section that is waiting for the following section
+            auto pending = fixed_array<Sample, Sections>{};
+            for (std::size_t step = 0; step!=size+Sections-1; ++step) {
+                auto const first_section = (step<size) ? std::size_t{0} : step-size+1;
+                auto const last_section = _impl::min(step, Sections-1);
+
+                // the last section is updated first so it consumes the previous step's output of its predecessor
+                for (auto section = last_section+1; section--!=first_section;) {
+                    auto const& section_input = (section==0) ? input[step] : pending[section-1];
+                    auto const section_output = _sections[section](_coefficients[section], section_input);
+                    if (section==Sections-1) {
+                        output[step-section] = section_output;
+                    }
+                    else {
+                        pending[section] = section_output;
+                    }
+                }
+            }
+        }
+
+        /// consumes a block of inputs and returns the corresponding outputs
+        CNL_NODISCARD fixed_vector<Sample> process(fixed_vector<Sample> const& block)
+        {
+            auto output = fixed_vector<Sample>(block.size());
+            process(block.data(), output.data(), block.size());
+            return output;
+        }
+
+    private:
+        fixed_array<coefficients_type, Sections> _coefficients;
+        fixed_array<section_type, Sections> _sections;
+    };
+}
+
+#endif  // CNL_IMPL_BIQUAD_CASCADE_TYPE_H
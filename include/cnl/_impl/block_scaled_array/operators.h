@@ -0,0 +1,158 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_BLOCK_SCALED_ARRAY_OPERATORS_H)
+#define CNL_IMPL_BLOCK_SCALED_ARRAY_OPERATORS_H
+
+#include "../common.h"
+#include "../config.h"
+#include "../exact_accumulator.h"
+#include "../fixed_array/type.h"
+#include "../num_traits/digits.h"
+#include "../num_traits/set_digits.h"
+#include "type.h"
+
+#include <cstddef>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::block_narrow
+
+        // shifts the wide results of an element-wise operation right just enough that they fit in Rep;
+        // the shift is determined once from the fold of the whole block
+        template<typename Rep, std::size_t N, typename Wide>
+        CNL_NODISCARD block_scaled_array<Rep, N> block_narrow(fixed_array<Wide, N> const& wide, int exponent)
+        {
+            auto const shift = block_narrowing_shift<Rep>(block_fold(wide.data(), N));
+
+            auto mantissas = fixed_array<Rep, N>{};
+            for (std::size_t index = 0; index!=N; ++index) {
+                mantissas[index] = static_cast<Rep>(block_scale(wide[index], -shift));
+            }
+            return block_scaled_array<Rep, N>(mantissas, exponent+shift);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::block_sum_t
+
+        // type which holds the sum or difference of two values of type Rep
+        // after one is shifted left by up to the digits of Rep
+        template<typename Rep>
+        using block_sum_t = set_digits_t<Rep, digits<Rep>::value*2+1>;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::block_additive_operator
+
+        // aligns both operands to a common exponent once, then adds or subtracts element-wise;
+        // the common exponent is the lesser of the two unless the greater exceeds it by more than the digits of Rep
+        template<class Operator, typename Rep, std::size_t N>
+        CNL_NODISCARD block_scaled_array<Rep, N> block_additive_operator(
+                block_scaled_array<Rep, N> const& lhs, block_scaled_array<Rep, N> const& rhs)
+        {
+            using wide = block_sum_t<Rep>;
+
+            auto const exponent = _impl::max(
+                    _impl::min(lhs.exponent(), rhs.exponent()),
+                    _impl::max(lhs.exponent(), rhs.exponent())-digits<Rep>::value);
+            auto const lhs_shift = lhs.exponent()-exponent;
+            auto const rhs_shift = rhs.exponent()-exponent;
+
+            auto sums = fixed_array<wide, N>{};
+            for (std::size_t index = 0; index!=N; ++index) {
+                sums[index] = static_cast<wide>(Operator{}(
+                        block_scale(static_cast<wide>(lhs[index]), lhs_shift),
+                        block_scale(static_cast<wide>(rhs[index]), rhs_shift)));
+            }
+            return block_narrow<Rep>(sums, exponent);
+        }
+
+        struct block_add {
+            template<typename Lhs, typename Rhs>
+            CNL_NODISCARD constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const -> decltype(lhs+rhs)
+            {
+                return lhs+rhs;
+            }
+        };
+
+        struct block_subtract {
+            template<typename Lhs, typename Rhs>
+            CNL_NODISCARD constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const -> decltype(lhs-rhs)
+            {
+                return lhs-rhs;
+            }
+        };
+    }
+
+    /// \brief returns the element-wise negation of \c rhs
+    /// \headerfile cnl/block_scaled_array.h
+    template<typename Rep, std::size_t N>
+    CNL_NODISCARD block_scaled_array<Rep, N> operator-(block_scaled_array<Rep, N> const& rhs)
+    {
+        using wide = _impl::block_sum_t<Rep>;
+
+        auto negatives = fixed_array<wide, N>{};
+        for (std::size_t index = 0; index!=N; ++index) {
+            negatives[index] = static_cast<wide>(-static_cast<wide>(rhs[index]));
+        }
+        return _impl::block_narrow<Rep>(negatives, rhs.exponent());
+    }
+
+    /// \brief returns the element-wise sum of \c lhs and \c rhs
+    /// \headerfile cnl/block_scaled_array.h
+    template<typename Rep, std::size_t N>
+    CNL_NODISCARD block_scaled_array<Rep, N> operator+(
+            block_scaled_array<Rep, N> const& lhs, block_scaled_array<Rep, N> const& rhs)
+    {
+        return _impl::block_additive_operator<_impl::block_add>(lhs, rhs);
+    }
+
+    /// \brief returns the element-wise difference between \c lhs and \c rhs
+    /// \headerfile cnl/block_scaled_array.h
+    template<typename Rep, std::size_t N>
+    CNL_NODISCARD block_scaled_array<Rep, N> operator-(
+            block_scaled_array<Rep, N> const& lhs, block_scaled_array<Rep, N> const& rhs)
+    {
+        return _impl::block_additive_operator<_impl::block_subtract>(lhs, rhs);
+    }
+
+    /// \brief returns the element-wise product of \c lhs and \c rhs
+    ///
+    /// Products are computed exactly and then narrowed once for the whole block.
+    ///
+    /// \headerfile cnl/block_scaled_array.h
+    template<typename Rep, std::size_t N>
+    CNL_NODISCARD block_scaled_array<Rep, N> operator*(
+            block_scaled_array<Rep, N> const& lhs, block_scaled_array<Rep, N> const& rhs)
+    {
+        using wide = _impl::exact_product_t<Rep, Rep>;
+
+        auto products = fixed_array<wide, N>{};
+        for (std::size_t index = 0; index!=N; ++index) {
+            products[index] = _impl::exact_multiply(lhs[index], rhs[index]);
+        }
+        return _impl::block_narrow<Rep>(products, lhs.exponent()+rhs.exponent());
+    }
+
+    /// \brief returns \c lhs multiplied by two to the power of \c rhs; only the exponent changes
+    /// \headerfile cnl/block_scaled_array.h
+    template<typename Rep, std::size_t N>
+    CNL_NODISCARD block_scaled_array<Rep, N> operator<<(block_scaled_array<Rep, N> const& lhs, int rhs)
+    {
+        return block_scaled_array<Rep, N>(lhs.mantissas(), lhs.exponent()+rhs);
+    }
+
+    /// \brief returns \c lhs divided by two to the power of \c rhs; only the exponent changes
+    /// \headerfile cnl/block_scaled_array.h
+    template<typename Rep, std::size_t N>
+    CNL_NODISCARD block_scaled_array<Rep, N> operator>>(block_scaled_array<Rep, N> const& lhs, int rhs)
+    {
+        return block_scaled_array<Rep, N>(lhs.mantissas(), lhs.exponent()-rhs);
+    }
+}
+
+#endif  // CNL_IMPL_BLOCK_SCALED_ARRAY_OPERATORS_H
@@ -0,0 +1,187 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_BLOCK_SCALED_ARRAY_TYPE_H)
+#define CNL_IMPL_BLOCK_SCALED_ARRAY_TYPE_H
+
+#include "../../numeric.h"
+#include "../common.h"
+#include "../config.h"
+#include "../fixed_array/type.h"
+#include "../num_traits/digits.h"
+#include "../num_traits/from_rep.h"
+#include "../num_traits/to_rep.h"
+#include "../scaled/power.h"
+#include "../scaled_integer/type.h"
+#include "../type_traits/remove_signedness.h"
+
+#include <cstddef>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::block_fold
+
+        // a non-negative value with the same number of leading bits as integer;
+        // the bitwise OR of the folds of several values has the fewest leading bits among them
+        template<typename Integer>
+        CNL_NODISCARD constexpr Integer block_fold(Integer const& integer)
+        {
+            return static_cast<Integer>(integer ^ ((integer >> (digits<Integer>::value-1)) >> 1));
+        }
+
+        template<typename Integer>
+        CNL_NODISCARD Integer block_fold(Integer const* integers, std::size_t size)
+        {
+            auto folded = Integer{0};
+            for (std::size_t index = 0; index!=size; ++index) {
+                folded = static_cast<Integer>(folded | block_fold(integers[index]));
+            }
+            return folded;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::block_scale
+
+        // multiplies integer by two to the power of shift, rounding toward negative infinity;
+        // a shift by the width of Integer or more produces zero or minus one
+        // and, as with native integers, a left shift which overflows is not handled;
+        // as in block_fold, the final bit is shifted separately so that no shift reaches the width of Integer
+        template<typename Integer>
+        CNL_NODISCARD constexpr Integer block_scale(Integer const& integer, int shift)
+        {
+            return (shift>=0)
+                   ? static_cast<Integer>(
+                           (static_cast<remove_signedness_t<Integer>>(integer)
+                                   << _impl::min(shift, digits<remove_signedness_t<Integer>>::value-1))
+                                   << int{shift>=digits<remove_signedness_t<Integer>>::value})
+                   : static_cast<Integer>(
+                           (integer >> _impl::min(-shift, digits<Integer>::value-1))
+                                   >> int{-shift>=digits<Integer>::value});
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::block_narrowing_shift
+
+        // number of bits by which values of type Wide with the given fold must be shifted right to fit in Rep
+        template<typename Rep, typename Wide>
+        CNL_NODISCARD constexpr int block_narrowing_shift(Wide const& folded)
+        {
+            return _impl::max(0, digits<Wide>::value-cnl::leading_bits(folded)-digits<Rep>::value);
+        }
+    }
+
+    /// \brief array of integer mantissas which share a single exponent determined at run time
+    ///
+    /// \tparam Rep the integer type of each mantissa
+    /// \tparam N the number of elements
+    ///
+    /// The value of each element is its mantissa multiplied by two to the power of \ref exponent.
+    /// Arithmetic operators act element-wise and align the exponents of their operands once per block.
+    /// Results are narrowed just enough that every mantissa fits in \c Rep, discarding low bits.
+    /// \ref normalize increases precision by shifting every mantissa left as far as the block allows.
+    ///
+    /// \headerfile cnl/block_scaled_array.h
+    /// \sa cnl::fixed_array, cnl::scaled_integer
+    template<typename Rep, std::size_t N>
+    class block_scaled_array {
+        static_assert(N>0, "block_scaled_array must have at least one element");
+    public:
+        using mantissa_type = Rep;
+
+        block_scaled_array()
+                : _mantissas{}, _exponent{0}
+        {
+        }
+
+        /// initializes each element with the value, `mantissas[i]*2^exponent`
+        block_scaled_array(fixed_array<Rep, N> const& mantissas, int exponent)
+                : _mantissas(mantissas), _exponent(exponent)
+        {
+        }
+
+        /// initializes each element with the value of the corresponding element of \c elements;
+        /// if the mantissas of \c elements are too wide for \c Rep, they are shifted right just enough to fit
+        template<typename ElementRep, int ElementExponent>
+        explicit block_scaled_array(fixed_array<scaled_integer<ElementRep, power<ElementExponent>>, N> const& elements)
+                : _mantissas{}, _exponent{ElementExponent}
+        {
+            auto reps = fixed_array<ElementRep, N>{};
+            for (std::size_t index = 0; index!=N; ++index) {
+                reps[index] = _impl::to_rep(elements[index]);
+            }
+            auto const shift = _impl::block_narrowing_shift<Rep>(_impl::block_fold(reps.data(), N));
+            for (std::size_t index = 0; index!=N; ++index) {
+                _mantissas[index] = static_cast<Rep>(_impl::block_scale(reps[index], -shift));
+            }
+            _exponent += shift;
+        }
+
+        /// converts each element to \c scaled_integer with the given exponent, rounding toward negative infinity
+        template<typename ElementRep, int ElementExponent>
+        explicit operator fixed_array<scaled_integer<ElementRep, power<ElementExponent>>, N>() const
+        {
+            using element_type = scaled_integer<ElementRep, power<ElementExponent>>;
+            using common_rep = typename std::common_type<Rep, ElementRep>::type;
+
+            auto elements = fixed_array<element_type, N>{};
+            for (std::size_t index = 0; index!=N; ++index) {
+                elements[index] = _impl::from_rep<element_type>(static_cast<ElementRep>(_impl::block_scale(
+                        static_cast<common_rep>(_mantissas[index]), _exponent-ElementExponent)));
+            }
+            return elements;
+        }
+
+        /// returns the number of elements
+        CNL_NODISCARD static constexpr std::size_t size() noexcept
+        {
+            return N;
+        }
+
+        /// returns the power of two by which every mantissa is multiplied
+        CNL_NODISCARD int exponent() const noexcept
+        {
+            return _exponent;
+        }
+
+        CNL_NODISCARD fixed_array<Rep, N> const& mantissas() const noexcept
+        {
+            return _mantissas;
+        }
+
+        /// returns the mantissa of the given element
+        CNL_NODISCARD Rep const& operator[](std::size_t index) const
+        {
+            return _mantissas[index];
+        }
+
+        /// shifts every mantissa left by the fewest leading bits among them and adjusts the exponent to match,
+        /// so that the element of greatest magnitude uses every digit of \c Rep; has no effect if every mantissa is zero
+        void normalize()
+        {
+            auto is_zero = true;
+            for (auto const& mantissa : _mantissas) {
+                is_zero &= !mantissa;
+            }
+            if (is_zero) {
+                return;
+            }
+            auto const shift = cnl::leading_bits(_impl::block_fold(_mantissas.data(), N));
+            for (auto& mantissa : _mantissas) {
+                mantissa = _impl::block_scale(mantissa, shift);
+            }
+            _exponent -= shift;
+        }
+
+    private:
+        fixed_array<Rep, N> _mantissas;
+        int _exponent;
+    };
+}
+
+#endif  // CNL_IMPL_BLOCK_SCALED_ARRAY_TYPE_H
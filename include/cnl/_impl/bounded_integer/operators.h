@@ -0,0 +1,230 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_BOUNDED_INTEGER_OPERATORS_H)
+#define CNL_IMPL_BOUNDED_INTEGER_OPERATORS_H
+
+#include "../../constant.h"
+#include "../common.h"
+#include "../config.h"
+#include "../num_traits/from_rep.h"
+#include "../num_traits/to_rep.h"
+#include "../operators/operators.h"
+#include "type.h"
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::bounded_hull_t
+
+        // rep of a bounded_integer which holds every value of two ranges
+        template<intmax Lowest1, intmax Max1, intmax Lowest2, intmax Max2>
+        using bounded_hull_t = bounded_rep_t<min(Lowest1, Lowest2), max(Max1, Max2)>;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::bounded_min4 / bounded_max4
+
+        CNL_NODISCARD constexpr intmax bounded_min4(intmax a, intmax b, intmax c, intmax d)
+        {
+            return min(min(a, b), min(c, d));
+        }
+
+        CNL_NODISCARD constexpr intmax bounded_max4(intmax a, intmax b, intmax c, intmax d)
+        {
+            return max(max(a, b), max(c, d));
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::bounded_range
+
+        // range of the result of applying Operator to values in [LhsLowest, LhsMax] and [RhsLowest, RhsMax]
+        template<class Operator, intmax LhsLowest, intmax LhsMax, intmax RhsLowest, intmax RhsMax>
+        struct bounded_range;
+
+        template<intmax LhsLowest, intmax LhsMax, intmax RhsLowest, intmax RhsMax>
+        struct bounded_range<add_op, LhsLowest, LhsMax, RhsLowest, RhsMax> {
+            static constexpr intmax lowest = LhsLowest+RhsLowest;
+            static constexpr intmax max = LhsMax+RhsMax;
+        };
+
+        template<intmax LhsLowest, intmax LhsMax, intmax RhsLowest, intmax RhsMax>
+        struct bounded_range<subtract_op, LhsLowest, LhsMax, RhsLowest, RhsMax> {
+            static constexpr intmax lowest = LhsLowest-RhsMax;
+            static constexpr intmax max = LhsMax-RhsLowest;
+        };
+
+        template<intmax LhsLowest, intmax LhsMax, intmax RhsLowest, intmax RhsMax>
+        struct bounded_range<multiply_op, LhsLowest, LhsMax, RhsLowest, RhsMax> {
+            static constexpr intmax lowest = bounded_min4(
+                    LhsLowest*RhsLowest, LhsLowest*RhsMax, LhsMax*RhsLowest, LhsMax*RhsMax);
+            static constexpr intmax max = bounded_max4(
+                    LhsLowest*RhsLowest, LhsLowest*RhsMax, LhsMax*RhsLowest, LhsMax*RhsMax);
+        };
+
+        // the divisor range, [RhsLowest, RhsMax], must exclude zero so that no division is undefined;
+        // a divisor whose range includes zero is first converted to a range which excludes it, which is checked;
+        // truncated quotients are then monotonic in each operand and so their extremes lie at the corners
+        template<intmax LhsLowest, intmax LhsMax, intmax RhsLowest, intmax RhsMax>
+        struct bounded_range<divide_op, LhsLowest, LhsMax, RhsLowest, RhsMax> {
+            static_assert(RhsLowest>0 || RhsMax<0, "bounded_integer divisor range includes zero");
+
+            static constexpr intmax lowest = bounded_min4(
+                    LhsLowest/RhsLowest, LhsLowest/RhsMax, LhsMax/RhsLowest, LhsMax/RhsMax);
+            static constexpr intmax max = bounded_max4(
+                    LhsLowest/RhsLowest, LhsLowest/RhsMax, LhsMax/RhsLowest, LhsMax/RhsMax);
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::bounded_binary_operator
+
+        // applies Operator to the reps of two bounded_integers in a type which holds the operands and the result;
+        // the range of the result is exact and so the result is not checked
+        template<class Operator, intmax LhsLowest, intmax LhsMax, intmax RhsLowest, intmax RhsMax, class OverflowTag>
+        struct bounded_binary_operator {
+            using range = bounded_range<Operator, LhsLowest, LhsMax, RhsLowest, RhsMax>;
+            using result_type = bounded_integer<range::lowest, range::max, OverflowTag>;
+            using wide = bounded_hull_t<
+                    range::lowest, range::max,
+                    _impl::min(LhsLowest, RhsLowest), _impl::max(LhsMax, RhsMax)>;
+
+            CNL_NODISCARD constexpr result_type operator()(
+                    bounded_integer<LhsLowest, LhsMax, OverflowTag> const& lhs,
+                    bounded_integer<RhsLowest, RhsMax, OverflowTag> const& rhs) const
+            {
+                return _impl::from_rep<result_type>(Operator{}(
+                        static_cast<wide>(_impl::to_rep(lhs)), static_cast<wide>(_impl::to_rep(rhs))));
+            }
+        };
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // unary operators
+
+    template<intmax Lowest, intmax Max, class OverflowTag>
+    CNL_NODISCARD constexpr bounded_integer<Lowest, Max, OverflowTag> operator+(
+            bounded_integer<Lowest, Max, OverflowTag> const& operand)
+    {
+        return operand;
+    }
+
+    template<intmax Lowest, intmax Max, class OverflowTag>
+    CNL_NODISCARD constexpr bounded_integer<-Max, -Lowest, OverflowTag> operator-(
+            bounded_integer<Lowest, Max, OverflowTag> const& operand)
+    {
+        return _impl::from_rep<bounded_integer<-Max, -Lowest, OverflowTag>>(
+                -static_cast<_impl::bounded_hull_t<Lowest, Max, -Max, -Lowest>>(_impl::to_rep(operand)));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // binary arithmetic operators
+
+#define CNL_IMPL_BOUNDED_INTEGER_BINARY_OPERATOR(OP, NAME) \
+    template<intmax LhsLowest, intmax LhsMax, intmax RhsLowest, intmax RhsMax, class OverflowTag> \
+    CNL_NODISCARD constexpr auto operator OP( \
+            bounded_integer<LhsLowest, LhsMax, OverflowTag> const& lhs, \
+            bounded_integer<RhsLowest, RhsMax, OverflowTag> const& rhs) \
+    -> typename _impl::bounded_binary_operator< \
+            _impl::NAME, LhsLowest, LhsMax, RhsLowest, RhsMax, OverflowTag>::result_type \
+    { \
+        return _impl::bounded_binary_operator< \
+                _impl::NAME, LhsLowest, LhsMax, RhsLowest, RhsMax, OverflowTag>{}(lhs, rhs); \
+    } \
+    \
+    template<intmax LhsLowest, intmax LhsMax, class OverflowTag, CNL_IMPL_CONSTANT_VALUE_TYPE Value> \
+    CNL_NODISCARD constexpr auto operator OP( \
+            bounded_integer<LhsLowest, LhsMax, OverflowTag> const& lhs, constant<Value> rhs) \
+    -> decltype(lhs OP bounded_integer<Value, Value, OverflowTag>(rhs)) \
+    { \
+        return lhs OP bounded_integer<Value, Value, OverflowTag>(rhs); \
+    } \
+    \
+    template<CNL_IMPL_CONSTANT_VALUE_TYPE Value, intmax RhsLowest, intmax RhsMax, class OverflowTag> \
+    CNL_NODISCARD constexpr auto operator OP( \
+            constant<Value> lhs, bounded_integer<RhsLowest, RhsMax, OverflowTag> const& rhs) \
+    -> decltype(bounded_integer<Value, Value, OverflowTag>(lhs) OP rhs) \
+    { \
+        return bounded_integer<Value, Value, OverflowTag>(lhs) OP rhs; \
+    }
+
+    CNL_IMPL_BOUNDED_INTEGER_BINARY_OPERATOR(+, add_op)
+
+    CNL_IMPL_BOUNDED_INTEGER_BINARY_OPERATOR(-, subtract_op)
+
+    CNL_IMPL_BOUNDED_INTEGER_BINARY_OPERATOR(*, multiply_op)
+
+    CNL_IMPL_BOUNDED_INTEGER_BINARY_OPERATOR(/, divide_op)
+
+#undef CNL_IMPL_BOUNDED_INTEGER_BINARY_OPERATOR
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // shift operators
+
+    // equivalent to multiplication by two to the power of Value
+    template<intmax Lowest, intmax Max, class OverflowTag, CNL_IMPL_CONSTANT_VALUE_TYPE Value>
+    CNL_NODISCARD constexpr auto operator<<(
+            bounded_integer<Lowest, Max, OverflowTag> const& lhs, constant<Value>)
+    -> decltype(lhs*constant<(intmax{1} << Value)>{})
+    {
+        static_assert(Value>=0, "bounded_integer shifted by a negative amount");
+        return lhs*constant<(intmax{1} << Value)>{};
+    }
+
+    // rounds toward negative infinity as does the right shift of a native integer
+    template<intmax Lowest, intmax Max, class OverflowTag, CNL_IMPL_CONSTANT_VALUE_TYPE Value>
+    CNL_NODISCARD constexpr auto operator>>(
+            bounded_integer<Lowest, Max, OverflowTag> const& lhs, constant<Value>)
+    -> bounded_integer<(Lowest >> Value), (Max >> Value), OverflowTag>
+    {
+        static_assert(Value>=0, "bounded_integer shifted by a negative amount");
+        return _impl::from_rep<bounded_integer<(Lowest >> Value), (Max >> Value), OverflowTag>>(
+                _impl::to_rep(lhs) >> Value);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // comparison operators
+
+#define CNL_IMPL_BOUNDED_INTEGER_COMPARISON_OPERATOR(OP) \
+    template<intmax LhsLowest, intmax LhsMax, class LhsOverflowTag, \
+            intmax RhsLowest, intmax RhsMax, class RhsOverflowTag> \
+    CNL_NODISCARD constexpr bool operator OP( \
+            bounded_integer<LhsLowest, LhsMax, LhsOverflowTag> const& lhs, \
+            bounded_integer<RhsLowest, RhsMax, RhsOverflowTag> const& rhs) \
+    { \
+        using wide = _impl::bounded_hull_t<LhsLowest, LhsMax, RhsLowest, RhsMax>; \
+        return static_cast<wide>(_impl::to_rep(lhs)) OP static_cast<wide>(_impl::to_rep(rhs)); \
+    } \
+    \
+    template<intmax LhsLowest, intmax LhsMax, class OverflowTag, CNL_IMPL_CONSTANT_VALUE_TYPE Value> \
+    CNL_NODISCARD constexpr bool operator OP( \
+            bounded_integer<LhsLowest, LhsMax, OverflowTag> const& lhs, constant<Value> rhs) \
+    { \
+        return lhs OP bounded_integer<Value, Value, OverflowTag>(rhs); \
+    } \
+    \
+    template<CNL_IMPL_CONSTANT_VALUE_TYPE Value, intmax RhsLowest, intmax RhsMax, class OverflowTag> \
+    CNL_NODISCARD constexpr bool operator OP( \
+            constant<Value> lhs, bounded_integer<RhsLowest, RhsMax, OverflowTag> const& rhs) \
+    { \
+        return bounded_integer<Value, Value, OverflowTag>(lhs) OP rhs; \
+    }
+
+    CNL_IMPL_BOUNDED_INTEGER_COMPARISON_OPERATOR(==)
+
+    CNL_IMPL_BOUNDED_INTEGER_COMPARISON_OPERATOR(!=)
+
+    CNL_IMPL_BOUNDED_INTEGER_COMPARISON_OPERATOR(<)
+
+    CNL_IMPL_BOUNDED_INTEGER_COMPARISON_OPERATOR(>)
+
+    CNL_IMPL_BOUNDED_INTEGER_COMPARISON_OPERATOR(<=)
+
+    CNL_IMPL_BOUNDED_INTEGER_COMPARISON_OPERATOR(>=)
+
+#undef CNL_IMPL_BOUNDED_INTEGER_COMPARISON_OPERATOR
+}
+
+#endif  // CNL_IMPL_BOUNDED_INTEGER_OPERATORS_H
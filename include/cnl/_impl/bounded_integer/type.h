@@ -0,0 +1,296 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_BOUNDED_INTEGER_TYPE_H)
+#define CNL_IMPL_BOUNDED_INTEGER_TYPE_H
+
+#include "../../constant.h"
+#include "../../limits.h"
+#include "../../overflow.h"
+#include "../common.h"
+#include "../config.h"
+#include "../num_traits/from_rep.h"
+#include "../num_traits/set_digits.h"
+#include "../num_traits/to_rep.h"
+#include "../polarity.h"
+#include "../type_traits/enable_if.h"
+#include "../used_digits.h"
+
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::bounded_from_rep_tag
+
+        // selects the constructor of bounded_integer which does not check its argument
+        struct bounded_from_rep_tag {
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::bounded_rep_t
+
+        // number of digits needed to represent value;
+        // used_digits is not applied to negative values because intmax may not satisfy std::is_signed
+        CNL_NODISCARD constexpr int bounded_digits(intmax value)
+        {
+            return used_digits((value<0) ? -1-value : value);
+        }
+
+        // narrowest fundamental integer which can represent every value in the range [Lowest, Max]
+        template<intmax Lowest, intmax Max>
+        using bounded_rep_t = set_digits_t<
+                typename std::conditional<(Lowest<0), int, unsigned>::type,
+                max(1, max(bounded_digits(Lowest), bounded_digits(Max)))>;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::bounded_greater / bounded_less
+
+        // compare a value of any arithmetic type with a bound without sign conversion
+        template<typename S>
+        CNL_NODISCARD constexpr enable_if_t<numeric_limits<S>::is_signed, bool> bounded_greater(
+                S const& value, intmax bound)
+        {
+            return value>bound;
+        }
+
+        template<typename S>
+        CNL_NODISCARD constexpr enable_if_t<!numeric_limits<S>::is_signed, bool> bounded_greater(
+                S const& value, intmax bound)
+        {
+            return bound<0 || static_cast<uintmax>(value)>static_cast<uintmax>(bound);
+        }
+
+        template<typename S>
+        CNL_NODISCARD constexpr enable_if_t<numeric_limits<S>::is_signed, bool> bounded_less(
+                S const& value, intmax bound)
+        {
+            return value<bound;
+        }
+
+        template<typename S>
+        CNL_NODISCARD constexpr enable_if_t<!numeric_limits<S>::is_signed, bool> bounded_less(
+                S const& value, intmax bound)
+        {
+            return bound>0 && static_cast<uintmax>(value)<static_cast<uintmax>(bound);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::bounded_exceeds_max / bounded_exceeds_lowest
+
+        // true iff some value of integer type, S, lies above Max (or below Lowest);
+        // every value of a non-integer type is assumed to be capable of exceeding a bound
+        template<typename S, intmax Max>
+        struct bounded_exceeds_max : std::integral_constant<bool,
+                !numeric_limits<S>::is_integer || bounded_greater(numeric_limits<S>::max(), Max)> {
+        };
+
+        template<typename S, intmax Lowest>
+        struct bounded_exceeds_lowest : std::integral_constant<bool,
+                !numeric_limits<S>::is_integer || bounded_less(numeric_limits<S>::lowest(), Lowest)> {
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::bounded_max / bounded_lowest
+
+        // the limits of type, S, clamped to the range of intmax;
+        // a non-integer type is treated as though it can represent every intmax value
+        template<typename S>
+        CNL_NODISCARD constexpr enable_if_t<numeric_limits<S>::is_integer, intmax> bounded_max()
+        {
+            return bounded_greater(numeric_limits<S>::max(), numeric_limits<intmax>::max())
+                   ? numeric_limits<intmax>::max()
+                   : static_cast<intmax>(numeric_limits<S>::max());
+        }
+
+        template<typename S>
+        CNL_NODISCARD constexpr enable_if_t<!numeric_limits<S>::is_integer, intmax> bounded_max()
+        {
+            return numeric_limits<intmax>::max();
+        }
+
+        template<typename S>
+        CNL_NODISCARD constexpr enable_if_t<numeric_limits<S>::is_integer, intmax> bounded_lowest()
+        {
+            return static_cast<intmax>(numeric_limits<S>::lowest());
+        }
+
+        template<typename S>
+        CNL_NODISCARD constexpr enable_if_t<!numeric_limits<S>::is_integer, intmax> bounded_lowest()
+        {
+            return numeric_limits<intmax>::lowest();
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::bounded_overflow
+
+        // the nearest value to value in the range [Lowest, Max];
+        // as in bounded_max, a non-integer type is treated as though it lies within any range
+        template<typename Rep, intmax Lowest, intmax Max>
+        CNL_NODISCARD constexpr enable_if_t<numeric_limits<Rep>::is_integer, Rep> bounded_clamp(Rep const& value)
+        {
+            return bounded_greater(value, Max)
+                   ? static_cast<Rep>(Max)
+                   : bounded_less(value, Lowest) ? static_cast<Rep>(Lowest) : value;
+        }
+
+        template<typename Rep, intmax Lowest, intmax Max>
+        CNL_NODISCARD constexpr enable_if_t<!numeric_limits<Rep>::is_integer, Rep> bounded_clamp(Rep const& value)
+        {
+            return value;
+        }
+
+        // handles a value which lies outside the range [Lowest, Max] when converted to a bounded_integer;
+        // any value returned by the overflow handler, e.g. the limit of Rep, is clamped to the range
+        // so that the range remains exact, e.g. saturated_overflow_tag saturates to the bound of the range
+        template<class OverflowTag, polarity Polarity, intmax Lowest, intmax Max>
+        struct bounded_overflow {
+            template<typename Rep, typename S>
+            CNL_NODISCARD constexpr Rep operator()(S const& from) const
+            {
+                return bounded_clamp<Rep, Lowest, Max>(
+                        overflow_operator<convert_op, OverflowTag, Polarity>{}.template operator()<Rep>(from));
+            }
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::bounded_convert
+
+        // converts from to the rep of a bounded_integer with range [Lowest, Max];
+        // each test is made only if the corresponding Check flag indicates that from may be out of range
+        template<intmax Lowest, intmax Max, class OverflowTag, bool CheckLowest, bool CheckMax>
+        struct bounded_convert {
+            template<polarity Polarity>
+            using overflow = bounded_overflow<OverflowTag, Polarity, Lowest, Max>;
+
+            template<typename Rep, typename S>
+            CNL_NODISCARD constexpr Rep operator()(S const& from) const
+            {
+                return (CheckMax && bounded_greater(from, Max))
+                       ? overflow<polarity::positive>{}.template operator()<Rep>(from)
+                       : (CheckLowest && bounded_less(from, Lowest))
+                         ? overflow<polarity::negative>{}.template operator()<Rep>(from)
+                         : static_cast<Rep>(from);
+            }
+        };
+    }
+
+    /// \brief integer whose range, [Lowest, Max], is tracked at compile time
+    ///
+    /// \tparam Lowest the lowest value which the integer can hold
+    /// \tparam Max the greatest value which the integer can hold
+    /// \tparam OverflowTag behavior when a conversion produces a value outside the range;
+    /// any value returned by its handler is clamped to the range,
+    /// e.g. \ref saturated_overflow_tag and \ref sticky_overflow_tag saturate to \c Lowest or \c Max
+    ///
+    /// Arithmetic operators return a bounded_integer whose range is that of every possible result.
+    /// Because the range of each result is exact, arithmetic operations never overflow and are never checked.
+    /// The range of a divisor must exclude zero; a divisor whose range includes zero is first converted,
+    /// with a check, to one which excludes it.
+    /// Conversions are checked only against those bounds which the source type can exceed,
+    /// e.g. a `bounded_integer<-100, 100>` converts to `int8_t` or to `bounded_integer<-200, 200>` without a check.
+    /// The value is stored in the narrowest fundamental integer which represents the range.
+    ///
+    /// \headerfile cnl/bounded_integer.h
+    /// \sa cnl::elastic_integer, cnl::overflow_integer
+    template<intmax Lowest, intmax Max, class OverflowTag = trapping_overflow_tag>
+    class bounded_integer {
+        static_assert(Lowest<=Max, "bounded_integer range is empty");
+        static_assert(!std::is_same<OverflowTag, native_overflow_tag>::value,
+                "bounded_integer cannot wrap a value which lies outside its range");
+    public:
+        using rep = _impl::bounded_rep_t<Lowest, Max>;
+
+        static constexpr intmax lowest = Lowest;
+        static constexpr intmax max = Max;
+
+        bounded_integer() = default;
+
+        /// initializes the value from another \ref bounded_integer, checking only bounds which \c from can exceed
+        template<intmax FromLowest, intmax FromMax, class FromOverflowTag>
+        constexpr bounded_integer(  // NOLINT(hicpp-explicit-conversions)
+                bounded_integer<FromLowest, FromMax, FromOverflowTag> const& from)
+                : _rep(_impl::bounded_convert<Lowest, Max, OverflowTag, (FromLowest<Lowest), (FromMax>Max)>{}
+                        .template operator()<rep>(_impl::to_rep(from)))
+        {
+        }
+
+        /// initializes the value from a constant which must lie in the range
+        template<CNL_IMPL_CONSTANT_VALUE_TYPE Value>
+        constexpr bounded_integer(constant<Value>)  // NOLINT(hicpp-explicit-conversions)
+                : _rep(static_cast<rep>(Value))
+        {
+            static_assert(Value>=Lowest && Value<=Max, "constant lies outside the range of bounded_integer");
+        }
+
+        /// initializes the value from an arithmetic value, checking only bounds which type \c S can exceed
+        template<typename S, _impl::enable_if_t<numeric_limits<S>::is_specialized, int> = 0>
+        constexpr bounded_integer(S const& value)  // NOLINT(hicpp-explicit-conversions)
+                : _rep(_impl::bounded_convert<
+                        Lowest, Max, OverflowTag,
+                        _impl::bounded_exceeds_lowest<S, Lowest>::value,
+                        _impl::bounded_exceeds_max<S, Max>::value>{}.template operator()<rep>(value))
+        {
+        }
+
+        /// converts the value to an arithmetic type, checking only bounds which type \c S cannot represent
+        template<typename S, _impl::enable_if_t<numeric_limits<S>::is_specialized, int> = 0>
+        CNL_NODISCARD explicit constexpr operator S() const
+        {
+            return _impl::bounded_convert<
+                    _impl::bounded_lowest<S>(), _impl::bounded_max<S>(), OverflowTag,
+                    (Lowest<_impl::bounded_lowest<S>()), (Max>_impl::bounded_max<S>())>{}.template operator()<S>(_rep);
+        }
+
+    private:
+        constexpr bounded_integer(_impl::bounded_from_rep_tag, rep const& r)
+                : _rep(r)
+        {
+        }
+
+        template<typename, typename, class>
+        friend struct cnl::from_rep;
+
+        template<typename, class>
+        friend struct cnl::to_rep;
+
+        rep _rep;
+    };
+
+    template<intmax Lowest, intmax Max, class OverflowTag>
+    constexpr intmax bounded_integer<Lowest, Max, OverflowTag>::lowest;
+
+    template<intmax Lowest, intmax Max, class OverflowTag>
+    constexpr intmax bounded_integer<Lowest, Max, OverflowTag>::max;
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // cnl::to_rep<bounded_integer>
+
+    template<intmax Lowest, intmax Max, class OverflowTag>
+    struct to_rep<bounded_integer<Lowest, Max, OverflowTag>> {
+        CNL_NODISCARD constexpr _impl::bounded_rep_t<Lowest, Max> operator()(
+                bounded_integer<Lowest, Max, OverflowTag> const& number) const
+        {
+            return number._rep;
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // cnl::from_rep<bounded_integer>
+
+    // does not check that rep lies in the range
+    template<intmax Lowest, intmax Max, class OverflowTag, typename Rep>
+    struct from_rep<bounded_integer<Lowest, Max, OverflowTag>, Rep> {
+        CNL_NODISCARD constexpr bounded_integer<Lowest, Max, OverflowTag> operator()(Rep const& rep) const
+        {
+            return bounded_integer<Lowest, Max, OverflowTag>(
+                    _impl::bounded_from_rep_tag{}, static_cast<_impl::bounded_rep_t<Lowest, Max>>(rep));
+        }
+    };
+}
+
+#endif  // CNL_IMPL_BOUNDED_INTEGER_TYPE_H
@@ -0,0 +1,77 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_CAPPED_ELASTIC_OPERATORS_H)
+#define CNL_IMPL_CAPPED_ELASTIC_OPERATORS_H
+
+#include "../config.h"
+#include "type.h"
+
+/// compositional numeric library
+namespace cnl {
+    ////////////////////////////////////////////////////////////////////////////////
+    // arithmetic operators
+
+    template<int Digits, int Exponent, class Tag>
+    CNL_NODISCARD constexpr auto operator+(capped_elastic_scaled_integer<Digits, Exponent, Tag> const& operand)
+    -> capped_elastic_scaled_integer<Digits, Exponent, Tag>
+    {
+        return operand;
+    }
+
+    template<int Digits, int Exponent, class Tag>
+    CNL_NODISCARD constexpr auto operator-(capped_elastic_scaled_integer<Digits, Exponent, Tag> const& operand)
+    -> decltype(_impl::capped_elastic_narrow<Tag>(-operand.value()))
+    {
+        return _impl::capped_elastic_narrow<Tag>(-operand.value());
+    }
+
+#define CNL_IMPL_CAPPED_ELASTIC_BINARY_OPERATOR(OP) \
+    template<int LhsDigits, int LhsExponent, int RhsDigits, int RhsExponent, class Tag> \
+    CNL_NODISCARD constexpr auto operator OP( \
+            capped_elastic_scaled_integer<LhsDigits, LhsExponent, Tag> const& lhs, \
+            capped_elastic_scaled_integer<RhsDigits, RhsExponent, Tag> const& rhs) \
+    -> decltype(_impl::capped_elastic_narrow<Tag>(lhs.value() OP rhs.value())) \
+    { \
+        return _impl::capped_elastic_narrow<Tag>(lhs.value() OP rhs.value()); \
+    }
+
+    CNL_IMPL_CAPPED_ELASTIC_BINARY_OPERATOR(+)
+
+    CNL_IMPL_CAPPED_ELASTIC_BINARY_OPERATOR(-)
+
+    CNL_IMPL_CAPPED_ELASTIC_BINARY_OPERATOR(*)
+
+#undef CNL_IMPL_CAPPED_ELASTIC_BINARY_OPERATOR
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // comparison operators
+
+#define CNL_IMPL_CAPPED_ELASTIC_COMPARISON_OPERATOR(OP) \
+    template<int LhsDigits, int LhsExponent, int RhsDigits, int RhsExponent, class Tag> \
+    CNL_NODISCARD constexpr bool operator OP( \
+            capped_elastic_scaled_integer<LhsDigits, LhsExponent, Tag> const& lhs, \
+            capped_elastic_scaled_integer<RhsDigits, RhsExponent, Tag> const& rhs) \
+    { \
+        return lhs.value() OP rhs.value(); \
+    }
+
+    CNL_IMPL_CAPPED_ELASTIC_COMPARISON_OPERATOR(==)
+
+    CNL_IMPL_CAPPED_ELASTIC_COMPARISON_OPERATOR(!=)
+
+    CNL_IMPL_CAPPED_ELASTIC_COMPARISON_OPERATOR(<)
+
+    CNL_IMPL_CAPPED_ELASTIC_COMPARISON_OPERATOR(>)
+
+    CNL_IMPL_CAPPED_ELASTIC_COMPARISON_OPERATOR(<=)
+
+    CNL_IMPL_CAPPED_ELASTIC_COMPARISON_OPERATOR(>=)
+
+#undef CNL_IMPL_CAPPED_ELASTIC_COMPARISON_OPERATOR
+}
+
+#endif  // CNL_IMPL_CAPPED_ELASTIC_OPERATORS_H
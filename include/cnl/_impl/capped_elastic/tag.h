@@ -0,0 +1,34 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_CAPPED_ELASTIC_TAG_H)
+#define CNL_IMPL_CAPPED_ELASTIC_TAG_H
+
+#include "../../cstdint.h"
+#include "../num_traits/digits.h"
+#include "../rounding/nearest_rounding_tag.h"
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief policy of \ref capped_elastic_scaled_integer
+    ///
+    /// \tparam MaxDigits greatest number of digits stored
+    /// \tparam RoundingTag rounding applied to the digits which are dropped from a result wider than \c MaxDigits
+    ///
+    /// The default of 31 digits keeps every value in a 32-bit integer
+    /// and every product and sum in a 64-bit integer until it is narrowed.
+    ///
+    /// \headerfile cnl/capped_elastic_scaled_integer.h
+    template<int MaxDigits = digits<int32>::value, class RoundingTag = nearest_rounding_tag>
+    struct capped_elastic_tag {
+        static_assert(MaxDigits>0, "capped_elastic_tag must allow at least one digit");
+
+        static constexpr int max_digits = MaxDigits;
+        using rounding = RoundingTag;
+    };
+}
+
+#endif  // CNL_IMPL_CAPPED_ELASTIC_TAG_H
@@ -0,0 +1,127 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_CAPPED_ELASTIC_TYPE_H)
+#define CNL_IMPL_CAPPED_ELASTIC_TYPE_H
+
+#include "../../elastic_scaled_integer.h"
+#include "../../static_number.h"
+#include "../common.h"
+#include "../config.h"
+#include "../num_traits/unwrap.h"
+#include "../num_traits/wrap.h"
+#include "tag.h"
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief real number approximation which auto-widens like \ref elastic_scaled_integer
+    /// up to a maximum number of digits and then drops its least significant digits instead
+    ///
+    /// \tparam Digits the number of integer and fractional digits stored; no greater than `Tag::max_digits`
+    /// \tparam Exponent the exponent by which the stored integer is scaled
+    /// \tparam Tag a \ref capped_elastic_tag specifying the maximum number of digits and how to round
+    ///
+    /// Each operation first computes its exact result as \ref elastic_scaled_integer would.
+    /// If that result has more than `Tag::max_digits` digits, its lowest digits are rounded away
+    /// and the exponent is raised to match, so that precision is lost but range is not.
+    /// Because elastic ranges are symmetric, rounding cannot carry a result out of its capped range.
+    ///
+    /// \headerfile cnl/capped_elastic_scaled_integer.h
+    /// \sa cnl::capped_elastic_tag, cnl::elastic_scaled_integer
+    template<int Digits, int Exponent = 0, class Tag = capped_elastic_tag<>>
+    class capped_elastic_scaled_integer {
+        static_assert(Digits<=Tag::max_digits, "capped_elastic_scaled_integer has more digits than its tag allows");
+    public:
+        using value_type = elastic_scaled_integer<Digits, Exponent>;
+
+        capped_elastic_scaled_integer() = default;
+
+        /// initializes the value from another \ref capped_elastic_scaled_integer with the same \c Tag
+        template<int FromDigits, int FromExponent>
+        constexpr capped_elastic_scaled_integer(  // NOLINT(hicpp-explicit-conversions)
+                capped_elastic_scaled_integer<FromDigits, FromExponent, Tag> const& from)
+                : _value(static_cast<value_type>(from.value()))
+        {
+        }
+
+        /// initializes the value as \ref value_type would
+        template<typename S>
+        constexpr capped_elastic_scaled_integer(S const& value)  // NOLINT(hicpp-explicit-conversions)
+                : _value(static_cast<value_type>(value))
+        {
+        }
+
+        /// returns the value as an \ref elastic_scaled_integer
+        CNL_NODISCARD constexpr value_type const& value() const
+        {
+            return _value;
+        }
+
+        /// converts the value as \ref value_type would
+        template<typename S>
+        CNL_NODISCARD explicit constexpr operator S() const
+        {
+            return static_cast<S>(_value);
+        }
+
+    private:
+        value_type _value;
+    };
+
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::capped_elastic_t
+
+        // type which holds a value of elastic_scaled_integer<Digits, Exponent> after it is capped according to Tag
+        template<int Digits, int Exponent, class Tag>
+        using capped_elastic_t = capped_elastic_scaled_integer<
+                _impl::min(Digits, Tag::max_digits),
+                Exponent+_impl::max(0, Digits-Tag::max_digits),
+                Tag>;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::capped_elastic_cap
+
+        // converts an exact result to capped_elastic_t, rounding away any digits beyond Tag::max_digits
+        template<class Tag, bool IsCapped>
+        struct capped_elastic_cap;
+
+        template<class Tag>
+        struct capped_elastic_cap<Tag, false> {
+            template<int Digits, int Exponent, class Narrowest>
+            CNL_NODISCARD constexpr capped_elastic_t<Digits, Exponent, Tag> operator()(
+                    elastic_scaled_integer<Digits, Exponent, Narrowest> const& exact) const
+            {
+                return capped_elastic_t<Digits, Exponent, Tag>(exact);
+            }
+        };
+
+        template<class Tag>
+        struct capped_elastic_cap<Tag, true> {
+            template<int Digits, int Exponent, class Narrowest>
+            CNL_NODISCARD constexpr capped_elastic_t<Digits, Exponent, Tag> operator()(
+                    elastic_scaled_integer<Digits, Exponent, Narrowest> const& exact) const
+            {
+                using result = capped_elastic_t<Digits, Exponent, Tag>;
+                using rounded = static_number<
+                        Tag::max_digits, Exponent+Digits-Tag::max_digits,
+                        typename Tag::rounding>;
+                using rep = remove_cvref_t<decltype(cnl::unwrap(std::declval<typename result::value_type>()))>;
+                return result(cnl::wrap<typename result::value_type>(
+                        static_cast<rep>(cnl::unwrap(static_cast<rounded>(exact)))));
+            }
+        };
+
+        template<class Tag, int Digits, int Exponent, class Narrowest>
+        CNL_NODISCARD constexpr capped_elastic_t<Digits, Exponent, Tag> capped_elastic_narrow(
+                elastic_scaled_integer<Digits, Exponent, Narrowest> const& exact)
+        {
+            return capped_elastic_cap<Tag, (Digits>Tag::max_digits)>{}(exact);
+        }
+    }
+}
+
+#endif  // CNL_IMPL_CAPPED_ELASTIC_TYPE_H
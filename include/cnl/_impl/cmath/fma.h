@@ -0,0 +1,163 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_CMATH_FMA_H)
+#define CNL_IMPL_CMATH_FMA_H
+
+#include "../common.h"
+#include "../config.h"
+#include "../exact_accumulator.h"
+#include "../num_traits/digits.h"
+#include "../scaled/power.h"
+
+#include <tuple>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fused_range
+
+        // exponents of the least and one more than the most significant digits of the sum of Terms
+        template<typename... Terms>
+        struct fused_range;
+
+        template<typename Term>
+        struct fused_range<Term> {
+            static constexpr int bottom = exponent<Term>::value;
+            static constexpr int top = bottom+digits<Term>::value;
+        };
+
+        template<typename Term, typename... Terms>
+        struct fused_range<Term, Terms...> {
+            static constexpr int bottom = _impl::min(fused_range<Term>::bottom, fused_range<Terms...>::bottom);
+            static constexpr int top = _impl::max(fused_range<Term>::top, fused_range<Terms...>::top);
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fused_rescale_t
+
+        // T with the given exponent; only scaled_integer can represent a non-zero exponent
+        template<typename T, int Exponent>
+        struct fused_rescale {
+            static_assert(Exponent==0, "terms of a fused operation cannot be aligned to a common exponent");
+            using type = T;
+        };
+
+        template<typename Rep, int TermExponent, int Exponent>
+        struct fused_rescale<scaled_integer<Rep, power<TermExponent>>, Exponent> {
+            using type = scaled_integer<Rep, power<Exponent>>;
+        };
+
+        template<typename T, int Exponent>
+        using fused_rescale_t = typename fused_rescale<T, Exponent>::type;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fused_accumulator_t
+
+        // type of the first of Terms, aligned to the least significant digit of any of Terms
+        // and with enough digits to hold the sum of every one of Terms
+        template<typename Term, typename... Terms>
+        struct fused_accumulator : exact_widen<
+                fused_rescale_t<Term, fused_range<Term, Terms...>::bottom>,
+                fused_range<Term, Terms...>::top-fused_range<Term, Terms...>::bottom
+                        +sum_headroom(1+sizeof...(Terms))> {
+        };
+
+        template<typename... Terms>
+        using fused_accumulator_t = typename fused_accumulator<Terms...>::type;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fused_product_accumulator_t
+
+        // accumulator of the sum of the products of each pair of Factors
+        template<typename... Factors>
+        struct fused_product_accumulator;
+
+        template<typename Lhs, typename Rhs, typename... Products>
+        struct fused_product_accumulator<std::tuple<Products...>, Lhs, Rhs>
+                : fused_accumulator<Products..., exact_product_t<Lhs, Rhs>> {
+        };
+
+        template<typename Lhs, typename Rhs, typename... Factors, typename... Products>
+        struct fused_product_accumulator<std::tuple<Products...>, Lhs, Rhs, Factors...>
+                : fused_product_accumulator<std::tuple<Products..., exact_product_t<Lhs, Rhs>>, Factors...> {
+        };
+
+        template<typename... Factors>
+        using fused_product_accumulator_t = typename fused_product_accumulator<std::tuple<>, Factors...>::type;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fused_cast
+
+        // converts term to Accumulator, widening it first so that its alignment cannot overflow
+        template<typename Accumulator, typename Term>
+        CNL_NODISCARD constexpr Accumulator fused_cast(Term const& term)
+        {
+            using widened = typename exact_widen<Term, digits<Accumulator>::value>::type;
+            return static_cast<Accumulator>(static_cast<widened>(term));
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fused_sum_of_products
+
+        template<typename Accumulator, typename Lhs, typename Rhs>
+        CNL_NODISCARD constexpr Accumulator fused_sum_of_products(Lhs const& lhs, Rhs const& rhs)
+        {
+            return fused_cast<Accumulator>(exact_multiply(lhs, rhs));
+        }
+
+        template<typename Accumulator, typename Lhs, typename Rhs, typename... Factors>
+        CNL_NODISCARD constexpr Accumulator fused_sum_of_products(
+                Lhs const& lhs, Rhs const& rhs, Factors const&... factors)
+        {
+            return static_cast<Accumulator>(
+                    fused_cast<Accumulator>(exact_multiply(lhs, rhs))
+                    +_impl::fused_sum_of_products<Accumulator>(factors...));
+        }
+    }
+
+    /// \brief returns the exact value of `a*b+c`
+    ///
+    /// The result has the least significant digit of `a*b` or \c c, whichever is lower,
+    /// and enough digits that neither the product nor the sum overflows, e.g. the result of
+    /// `fma(scaled_integer<int16_t, power<-15>>{}, scaled_integer<int16_t, power<-15>>{}, scaled_integer<int16_t, power<-8>>{})`
+    /// is a `scaled_integer<int64_t, power<-30>>`.
+    /// No rounding or overflow handling takes place until the result is converted to a narrower type,
+    /// e.g. with `static_cast<Result>(fma(a, b, c))`, so they are applied exactly once.
+    /// Where the widest fundamental integer is too narrow, the result is composed of a \ref wide_integer.
+    ///
+    /// \headerfile cnl/cmath.h
+    /// \sa cnl::fused_sum_of_products
+    template<typename A, typename B, typename C>
+    CNL_NODISCARD constexpr auto fma(A const& a, B const& b, C const& c)
+    -> _impl::fused_accumulator_t<_impl::exact_product_t<A, B>, C>
+    {
+        using accumulator = _impl::fused_accumulator_t<_impl::exact_product_t<A, B>, C>;
+        return static_cast<accumulator>(
+                _impl::fused_cast<accumulator>(_impl::exact_multiply(a, b))+_impl::fused_cast<accumulator>(c));
+    }
+
+    /// \brief returns the exact value of `factors[0]*factors[1] + factors[2]*factors[3] + ...`
+    ///
+    /// \param factors an even number of values; each consecutive pair is multiplied
+    ///
+    /// As with \ref fma, no intermediate result is rounded or narrowed
+    /// and the result is expected to be converted to the desired type, e.g. with
+    /// `static_cast<scaled_integer<rounding_integer<int16_t>, power<-15>>>(fused_sum_of_products(a, b, c, d))`.
+    ///
+    /// \headerfile cnl/cmath.h
+    /// \sa cnl::fma, cnl::dot
+    template<typename... Factors>
+    CNL_NODISCARD constexpr auto fused_sum_of_products(Factors const&... factors)
+    -> _impl::fused_product_accumulator_t<Factors...>
+    {
+        static_assert(sizeof...(Factors)%2==0, "fused_sum_of_products requires pairs of factors");
+        return _impl::fused_sum_of_products<_impl::fused_product_accumulator_t<Factors...>>(factors...);
+    }
+}
+
+#endif  // CNL_IMPL_CMATH_FMA_H
@@ -124,6 +124,24 @@
 #define CNL_GCC_INTRINSICS_ENABLED
 #endif
 
+////////////////////////////////////////////////////////////////////////////////
+// CNL_VECTOR_EXTENSIONS_ENABLED macro definition
+
+// When enabled, batch operations such as cnl::saturated_add
+// and the lanes of cnl::simd_pack are implemented using GCC vector extensions.
+
+#if defined(CNL_VECTOR_EXTENSIONS_ENABLED)
+#error CNL_VECTOR_EXTENSIONS_ENABLED already defined
+#endif
+
+#if defined(CNL_USE_VECTOR_EXTENSIONS)
+#if CNL_USE_VECTOR_EXTENSIONS
+#define CNL_VECTOR_EXTENSIONS_ENABLED
+#endif
+#elif defined(__clang__) || defined(__GNUG__)
+#define CNL_VECTOR_EXTENSIONS_ENABLED
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // CNL_UNREACHABLE_UB_ENABLED macro definition
 
@@ -0,0 +1,188 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_DECIMAL_DIVIDE_H)
+#define CNL_IMPL_DECIMAL_DIVIDE_H
+
+#include "../cstdint.h"
+#include "config.h"
+#include "type_traits/enable_if.h"
+
+#include <cstdint>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::decimal_power_table
+
+        // powers of ten which are representable in 64 bits
+        template<typename Unused = void>
+        struct decimal_power_table {
+            static constexpr int size = 20;
+
+            static constexpr std::uint64_t values[size] = {
+                    UINT64_C(1),
+                    UINT64_C(10),
+                    UINT64_C(100),
+                    UINT64_C(1000),
+                    UINT64_C(10000),
+                    UINT64_C(100000),
+                    UINT64_C(1000000),
+                    UINT64_C(10000000),
+                    UINT64_C(100000000),
+                    UINT64_C(1000000000),
+                    UINT64_C(10000000000),
+                    UINT64_C(100000000000),
+                    UINT64_C(1000000000000),
+                    UINT64_C(10000000000000),
+                    UINT64_C(100000000000000),
+                    UINT64_C(1000000000000000),
+                    UINT64_C(10000000000000000),
+                    UINT64_C(100000000000000000),
+                    UINT64_C(1000000000000000000),
+                    UINT64_C(10000000000000000000)};
+        };
+
+        template<typename Unused>
+        constexpr int decimal_power_table<Unused>::size;
+
+        template<typename Unused>
+        constexpr std::uint64_t decimal_power_table<Unused>::values[];
+
+        // largest power of ten in the table
+        constexpr int decimal_power_table_max = decimal_power_table<>::size-1;
+
+#if defined(CNL_INT128_ENABLED)
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::decimal_reciprocal
+
+        // number of leading zeros of a non-zero 64-bit value
+        CNL_NODISCARD constexpr int decimal_leading_zeros(std::uint64_t value)
+        {
+            return (value>>63) ? 0 : 1+decimal_leading_zeros(value << 1);
+        }
+
+        // divisor, 10^Exponent, normalized so that its most significant bit is set, and its reciprocal, v,
+        // floor((2^128-1)/normalized)-2^64, as described in
+        // Möller & Granlund, "Improved division by invariant integers", IEEE Trans. Computers, 2011
+        template<int Exponent>
+        struct decimal_reciprocal {
+            static_assert(Exponent>0 && Exponent<=decimal_power_table_max, "power of ten is out of range");
+
+            static constexpr int shift = decimal_leading_zeros(decimal_power_table<>::values[Exponent]);
+            static constexpr std::uint64_t normalized = decimal_power_table<>::values[Exponent] << shift;
+            static constexpr std::uint64_t value = static_cast<std::uint64_t>(~uint128{0}/normalized);
+        };
+
+        template<int Exponent>
+        constexpr int decimal_reciprocal<Exponent>::shift;
+
+        template<int Exponent>
+        constexpr std::uint64_t decimal_reciprocal<Exponent>::normalized;
+
+        template<int Exponent>
+        constexpr std::uint64_t decimal_reciprocal<Exponent>::value;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::decimal_divide_2by1
+        //
+        // divides u1*2^64+u0 by a normalized divisor, d, where u1<d, using its reciprocal, v;
+        // the quotient is returned in the upper 64 bits and the remainder in the lower 64 bits
+
+        CNL_NODISCARD constexpr uint128 decimal_pack(std::uint64_t quotient, std::uint64_t remainder)
+        {
+            return (uint128{quotient} << 64) | remainder;
+        }
+
+        CNL_NODISCARD constexpr uint128 decimal_divide_2by1_adjust(
+                std::uint64_t q1, std::uint64_t r, std::uint64_t d)
+        {
+            return (r>=d) ? decimal_pack(q1+1, r-d) : decimal_pack(q1, r);
+        }
+
+        CNL_NODISCARD constexpr uint128 decimal_divide_2by1_estimate(
+                std::uint64_t q1, std::uint64_t q0, std::uint64_t r, std::uint64_t d)
+        {
+            return (r>q0)
+                   ? decimal_divide_2by1_adjust(q1-1, r+d, d)
+                   : decimal_divide_2by1_adjust(q1, r, d);
+        }
+
+        CNL_NODISCARD constexpr uint128 decimal_divide_2by1_product(
+                uint128 product, std::uint64_t u0, std::uint64_t d)
+        {
+            return decimal_divide_2by1_estimate(
+                    static_cast<std::uint64_t>((product >> 64)+1),
+                    static_cast<std::uint64_t>(product),
+                    u0-static_cast<std::uint64_t>((product >> 64)+1)*d,
+                    d);
+        }
+
+        CNL_NODISCARD constexpr uint128 decimal_divide_2by1(
+                std::uint64_t u1, std::uint64_t u0, std::uint64_t d, std::uint64_t v)
+        {
+            return decimal_divide_2by1_product(uint128{v}*u1+((uint128{u1} << 64) | u0), u0, d);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::decimal_divide
+
+        // the remainder of the high limb and the low limb, shifted left by Shift, form the upper limb of the
+        // normalized 2-by-1 division
+        template<int Shift>
+        CNL_NODISCARD constexpr std::uint64_t decimal_dividend_upper(std::uint64_t remainder, std::uint64_t low)
+        {
+            return static_cast<std::uint64_t>(remainder << Shift)
+                    | (Shift ? static_cast<std::uint64_t>(low >> ((64-Shift)%64)) : std::uint64_t{0});
+        }
+
+        template<int Exponent, class Enable = void>
+        struct decimal_divide_fn {
+            using _reciprocal = decimal_reciprocal<Exponent>;
+            static constexpr std::uint64_t _divisor = decimal_power_table<>::values[Exponent];
+
+            // the high limb is divided as a 64-bit integer, which compilers do by multiplication;
+            // its remainder and the low limb are divided using the reciprocal
+            CNL_NODISCARD constexpr uint128 operator()(uint128 dividend) const
+            {
+                return (dividend >> 64)
+                       ? (uint128{static_cast<std::uint64_t>(dividend >> 64)/_divisor} << 64)
+                               | (decimal_divide_2by1(
+                                       decimal_dividend_upper<_reciprocal::shift>(
+                                               static_cast<std::uint64_t>(dividend >> 64)%_divisor,
+                                               static_cast<std::uint64_t>(dividend)),
+                                       static_cast<std::uint64_t>(static_cast<std::uint64_t>(dividend)
+                                               << _reciprocal::shift),
+                                       _reciprocal::normalized, _reciprocal::value) >> 64)
+                       : uint128{static_cast<std::uint64_t>(dividend)/_divisor};
+            }
+        };
+
+        template<int Exponent, class Enable>
+        constexpr std::uint64_t decimal_divide_fn<Exponent, Enable>::_divisor;
+
+        // powers of ten beyond the table are divided in steps; truncation of each step is exact
+        template<int Exponent>
+        struct decimal_divide_fn<Exponent, enable_if_t<(Exponent>decimal_power_table_max)>> {
+            CNL_NODISCARD constexpr uint128 operator()(uint128 dividend) const
+            {
+                return decimal_divide_fn<Exponent-decimal_power_table_max>{}(
+                        decimal_divide_fn<decimal_power_table_max>{}(dividend));
+            }
+        };
+
+        // returns dividend/10^Exponent, truncated, using only multiplication, addition and shifts
+        template<int Exponent>
+        CNL_NODISCARD constexpr uint128 decimal_divide(uint128 dividend)
+        {
+            return decimal_divide_fn<Exponent>{}(dividend);
+        }
+#endif  // defined(CNL_INT128_ENABLED)
+    }
+}
+
+#endif  // CNL_IMPL_DECIMAL_DIVIDE_H
@@ -21,6 +21,7 @@
 #include "duplex_integer/multiply.h"
 #include "duplex_integer/numeric_limits.h"
 #include "duplex_integer/operators.h"
+#include "duplex_integer/overflow.h"
 #include "duplex_integer/remove_signedness.h"
 #include "duplex_integer/rep.h"
 #include "duplex_integer/rounding.h"
@@ -0,0 +1,192 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_DUPLEX_INTEGER_OVERFLOW_H)
+#define CNL_IMPL_DUPLEX_INTEGER_OVERFLOW_H
+
+#include "../config.h"
+#include "../num_traits/width.h"
+#include "../operators/operators.h"
+#include "../overflow/builtin_overflow.h"
+#include "../type_traits/enable_if.h"
+#include "../type_traits/is_signed.h"
+#include "../type_traits/remove_signedness.h"
+#include "multiply.h"
+#include "operators.h"
+#include "remove_signedness.h"
+#include "type.h"
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::duplex_top_word
+
+        // the most significant fundamental integer of an integer
+        template<typename Integer>
+        struct duplex_top_word {
+            using type = Integer;
+
+            CNL_NODISCARD constexpr type operator()(Integer const& integer) const
+            {
+                return integer;
+            }
+        };
+
+        template<typename Upper, typename Lower>
+        struct duplex_top_word<duplex_integer<Upper, Lower>> {
+            using type = typename duplex_top_word<Upper>::type;
+
+            CNL_NODISCARD constexpr type operator()(duplex_integer<Upper, Lower> const& integer) const
+            {
+                return duplex_top_word<Upper>{}(integer.upper());
+            }
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::duplex_reinterpret
+
+        // converts between signed and unsigned integers of the same width, preserving the bit pattern
+        template<typename Destination, typename Source>
+        struct duplex_reinterpret {
+            CNL_NODISCARD constexpr Destination operator()(Source const& from) const
+            {
+                return static_cast<Destination>(from);
+            }
+        };
+
+        template<typename DestinationUpper, typename SourceUpper, typename Lower>
+        struct duplex_reinterpret<duplex_integer<DestinationUpper, Lower>, duplex_integer<SourceUpper, Lower>> {
+            CNL_NODISCARD constexpr duplex_integer<DestinationUpper, Lower> operator()(
+                    duplex_integer<SourceUpper, Lower> const& from) const
+            {
+                return duplex_integer<DestinationUpper, Lower>(
+                        duplex_reinterpret<DestinationUpper, SourceUpper>{}(from.upper()), from.lower());
+            }
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::is_top_bit_set
+
+        template<typename Word>
+        CNL_NODISCARD constexpr bool is_top_bit_set(Word const& word)
+        {
+            return (static_cast<remove_signedness_t<Word>>(word) >> (width<Word>::value-1))!=0;
+        }
+
+        template<typename Integer>
+        CNL_NODISCARD constexpr bool is_duplex_sign_bit_set(Integer const& integer)
+        {
+            return is_top_bit_set(duplex_top_word<Integer>{}(integer));
+        }
+
+#if defined(CNL_BUILTIN_OVERFLOW_SUPPORTED_BY_LANGUAGE)
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::duplex_overflow_operator
+
+        // Overflow of add_op and subtract_op is determined from the top words of the operands and wrapped result,
+        // i.e. from the carry or borrow out of the most significant word. The result of multiply_op is calculated
+        // at double width and overflow is determined from the high half of the product.
+        template<class Operator, typename Duplex>
+        struct duplex_overflow_operator;
+
+        template<typename Duplex>
+        struct duplex_overflow_operator<add_op, Duplex> {
+            using unsigned_type = remove_signedness_t<Duplex>;
+            using word = remove_signedness_t<typename duplex_top_word<Duplex>::type>;
+
+            CNL_NODISCARD CNL_RELAXED_CONSTEXPR bool operator()(
+                    Duplex const& lhs, Duplex const& rhs, Duplex& result) const
+            {
+                auto const sum = duplex_reinterpret<unsigned_type, Duplex>{}(lhs)
+                        +duplex_reinterpret<unsigned_type, Duplex>{}(rhs);
+                result = duplex_reinterpret<Duplex, unsigned_type>{}(sum);
+
+                auto const l = static_cast<word>(duplex_top_word<Duplex>{}(lhs));
+                auto const r = static_cast<word>(duplex_top_word<Duplex>{}(rhs));
+                auto const s = static_cast<word>(duplex_top_word<unsigned_type>{}(sum));
+                return is_signed<Duplex>::value
+                       ? is_top_bit_set(static_cast<word>((l ^ s) & (r ^ s)))
+                       : is_top_bit_set(static_cast<word>((l & r) | ((l | r) & static_cast<word>(~s))));
+            }
+        };
+
+        template<typename Duplex>
+        struct duplex_overflow_operator<subtract_op, Duplex> {
+            using unsigned_type = remove_signedness_t<Duplex>;
+            using word = remove_signedness_t<typename duplex_top_word<Duplex>::type>;
+
+            CNL_NODISCARD CNL_RELAXED_CONSTEXPR bool operator()(
+                    Duplex const& lhs, Duplex const& rhs, Duplex& result) const
+            {
+                auto const difference = duplex_reinterpret<unsigned_type, Duplex>{}(lhs)
+                        -duplex_reinterpret<unsigned_type, Duplex>{}(rhs);
+                result = duplex_reinterpret<Duplex, unsigned_type>{}(difference);
+
+                auto const l = static_cast<word>(duplex_top_word<Duplex>{}(lhs));
+                auto const r = static_cast<word>(duplex_top_word<Duplex>{}(rhs));
+                auto const d = static_cast<word>(duplex_top_word<unsigned_type>{}(difference));
+                auto const not_l = static_cast<word>(~l);
+                return is_signed<Duplex>::value
+                       ? is_top_bit_set(static_cast<word>((l ^ r) & (l ^ d)))
+                       : is_top_bit_set(static_cast<word>((not_l & r) | ((not_l | r) & d)));
+            }
+        };
+
+        template<typename Duplex>
+        struct duplex_overflow_operator<multiply_op, Duplex> {
+            using unsigned_type = remove_signedness_t<Duplex>;
+
+            CNL_NODISCARD CNL_RELAXED_CONSTEXPR bool operator()(
+                    Duplex const& lhs, Duplex const& rhs, Duplex& result) const
+            {
+                auto const product = long_multiply<unsigned_type>{}(magnitude(lhs), magnitude(rhs));
+                auto const negative = is_signed<Duplex>::value
+                        && (is_duplex_sign_bit_set(lhs)!=is_duplex_sign_bit_set(rhs));
+                auto const low = unsigned_type(product.lower());
+                result = duplex_reinterpret<Duplex, unsigned_type>{}(negative ? -low : low);
+
+                // a signed result must also have the sign of the product, unless the product is zero
+                return static_cast<bool>(product.upper())
+                        || (is_signed<Duplex>::value && static_cast<bool>(low)
+                                && is_duplex_sign_bit_set(result)!=negative);
+            }
+
+        private:
+            CNL_NODISCARD static constexpr unsigned_type magnitude(Duplex const& operand)
+            {
+                return (is_signed<Duplex>::value && is_duplex_sign_bit_set(operand))
+                       ? -duplex_reinterpret<unsigned_type, Duplex>{}(operand)
+                       : duplex_reinterpret<unsigned_type, Duplex>{}(operand);
+            }
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::builtin_overflow_operator<duplex_integer>
+
+        // duplex_integer of balanced width detects overflow of add_op, subtract_op and multiply_op
+        // without resorting to the comparisons performed by is_overflow
+        template<class Operator, typename Upper, typename Lower>
+        struct builtin_overflow_operator<
+                Operator, duplex_integer<Upper, Lower>, duplex_integer<Upper, Lower>,
+                enable_if_t<width<Upper>::value==width<Lower>::value
+                        && (std::is_same<Operator, add_op>::value
+                                || std::is_same<Operator, subtract_op>::value
+                                || std::is_same<Operator, multiply_op>::value)>>
+                : std::true_type {
+            using _duplex_integer = duplex_integer<Upper, Lower>;
+
+            CNL_NODISCARD CNL_RELAXED_CONSTEXPR bool operator()(
+                    _duplex_integer const& lhs, _duplex_integer const& rhs, _duplex_integer& result) const
+            {
+                return duplex_overflow_operator<Operator, _duplex_integer>{}(lhs, rhs, result);
+            }
+        };
+#endif
+    }
+}
+
+#endif  // CNL_IMPL_DUPLEX_INTEGER_OVERFLOW_H
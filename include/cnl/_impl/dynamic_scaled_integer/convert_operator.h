@@ -0,0 +1,37 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_DYNAMIC_SCALED_INTEGER_CONVERT_OPERATOR_H)
+#define CNL_IMPL_DYNAMIC_SCALED_INTEGER_CONVERT_OPERATOR_H
+
+#include "../config.h"
+#include "../operators/generic.h"
+#include "../scaled/power.h"
+#include "type.h"
+
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    ////////////////////////////////////////////////////////////////////////////////
+    // conversion from dynamic_scaled_integer
+
+    // rounds toward negative infinity
+    template<int DestExponent, typename Dest, typename SrcRep>
+    struct convert_operator<
+            power<DestExponent, 2>,
+            power<0, 2>,
+            Dest,
+            dynamic_scaled_integer<SrcRep>> {
+        CNL_NODISCARD constexpr Dest operator()(dynamic_scaled_integer<SrcRep> const& from) const
+        {
+            return static_cast<Dest>(
+                    from.template rescaled_mantissa<typename std::common_type<SrcRep, Dest>::type>(DestExponent));
+        }
+    };
+}
+
+#endif  // CNL_IMPL_DYNAMIC_SCALED_INTEGER_CONVERT_OPERATOR_H
@@ -0,0 +1,216 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_DYNAMIC_SCALED_INTEGER_OPERATORS_H)
+#define CNL_IMPL_DYNAMIC_SCALED_INTEGER_OPERATORS_H
+
+#include "../../numeric.h"
+#include "../block_scaled_array/type.h"
+#include "../common.h"
+#include "../config.h"
+#include "../num_traits/digits.h"
+#include "../operators/operators.h"
+#include "type.h"
+
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::dynamic_result_t
+
+        // type of the mantissa of the result of an operation upon mantissas of type LhsRep and RhsRep
+        template<typename LhsRep, typename RhsRep>
+        using dynamic_result_t = decltype(std::declval<LhsRep>()+std::declval<RhsRep>());
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::dynamic_sign
+
+        // returns 1, 0 or -1 as integer is positive, zero or negative
+        template<typename Integer>
+        CNL_NODISCARD constexpr int dynamic_sign(Integer const& integer)
+        {
+            return (integer>Integer{0}) ? 1 : (integer==Integer{0}) ? 0 : -1;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::dynamic_leading_bit
+
+        // exponent of the bit after the most significant of the value, mantissa*2^exponent;
+        // of two values with the same sign, the one with the greater leading bit has the greater magnitude
+        template<typename Integer>
+        CNL_NODISCARD constexpr int dynamic_leading_bit(Integer const& mantissa, int exponent)
+        {
+            return exponent+cnl::used_digits(mantissa);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::dynamic_compare
+
+        // returns a value with the sign of lhs-rhs, where each operand is mantissa*2^exponent;
+        // values are decided by sign and then by leading bit so that mantissas are only aligned
+        // when their exponents differ by no more than the digits of Integer
+        template<typename Integer>
+        CNL_NODISCARD constexpr int dynamic_compare(
+                Integer const& lhs, int lhs_exponent, Integer const& rhs, int rhs_exponent)
+        {
+            return (dynamic_sign(lhs)!=dynamic_sign(rhs) || dynamic_sign(lhs)==0)
+                   ? dynamic_sign(lhs)-dynamic_sign(rhs)
+                   : (dynamic_leading_bit(lhs, lhs_exponent)!=dynamic_leading_bit(rhs, rhs_exponent))
+                     ? (dynamic_leading_bit(lhs, lhs_exponent)>dynamic_leading_bit(rhs, rhs_exponent))
+                       ? dynamic_sign(lhs)
+                       : -dynamic_sign(lhs)
+                     : dynamic_sign(
+                             block_scale(lhs, lhs_exponent-_impl::min(lhs_exponent, rhs_exponent))
+                             -block_scale(rhs, rhs_exponent-_impl::min(lhs_exponent, rhs_exponent)));
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::dynamic_aligned_exponent
+
+        // exponent to which the operands of addition or subtraction are aligned: the lower of the two exponents
+        // unless an operand would then need more than all but one of the digits of Integer, in which case
+        // the exponent is raised until the greater operand leaves one digit for the carry and the lesser operand
+        // loses its least significant digits; zero operands impose no limit
+        template<typename Integer>
+        CNL_NODISCARD constexpr int dynamic_aligned_exponent(
+                Integer const& lhs, int lhs_exponent, Integer const& rhs, int rhs_exponent)
+        {
+            return _impl::max(
+                    _impl::min(lhs_exponent, rhs_exponent),
+                    _impl::max(
+                            (lhs==Integer{0}) ? _impl::min(lhs_exponent, rhs_exponent)
+                                              : dynamic_leading_bit(lhs, lhs_exponent),
+                            (rhs==Integer{0}) ? _impl::min(lhs_exponent, rhs_exponent)
+                                              : dynamic_leading_bit(rhs, rhs_exponent))
+                    -(digits<Integer>::value-1));
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::dynamic_aligned_operator
+
+        // applies Operator to the mantissas of lhs and rhs after both are rescaled to exponent
+        template<class Operator, typename Result, typename LhsRep, typename RhsRep>
+        CNL_NODISCARD constexpr dynamic_scaled_integer<Result> dynamic_aligned_operator(
+                dynamic_scaled_integer<LhsRep> const& lhs, dynamic_scaled_integer<RhsRep> const& rhs, int exponent)
+        {
+            return dynamic_scaled_integer<Result>(
+                    static_cast<Result>(Operator{}(
+                            lhs.template rescaled_mantissa<Result>(exponent),
+                            rhs.template rescaled_mantissa<Result>(exponent))),
+                    exponent);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // unary operators
+
+    template<typename Rep>
+    CNL_NODISCARD constexpr auto operator+(dynamic_scaled_integer<Rep> const& operand)
+    -> dynamic_scaled_integer<decltype(+operand.mantissa())>
+    {
+        return dynamic_scaled_integer<decltype(+operand.mantissa())>(+operand.mantissa(), operand.exponent());
+    }
+
+    template<typename Rep>
+    CNL_NODISCARD constexpr auto operator-(dynamic_scaled_integer<Rep> const& operand)
+    -> dynamic_scaled_integer<decltype(-operand.mantissa())>
+    {
+        return dynamic_scaled_integer<decltype(-operand.mantissa())>(-operand.mantissa(), operand.exponent());
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // binary arithmetic operators
+
+    // operands are aligned to the lower of their exponents unless the result could then overflow its rep;
+    // the exponent is then raised and the least significant digits of the lesser operand are lost
+#define CNL_IMPL_DYNAMIC_SCALED_INTEGER_ALIGNED_OPERATOR(OP, NAME) \
+    template<typename LhsRep, typename RhsRep> \
+    CNL_NODISCARD constexpr auto operator OP( \
+            dynamic_scaled_integer<LhsRep> const& lhs, dynamic_scaled_integer<RhsRep> const& rhs) \
+    -> dynamic_scaled_integer<_impl::dynamic_result_t<LhsRep, RhsRep>> \
+    { \
+        using result_rep = _impl::dynamic_result_t<LhsRep, RhsRep>; \
+        return _impl::dynamic_aligned_operator<_impl::NAME, result_rep>( \
+                lhs, rhs, _impl::dynamic_aligned_exponent( \
+                        static_cast<result_rep>(lhs.mantissa()), lhs.exponent(), \
+                        static_cast<result_rep>(rhs.mantissa()), rhs.exponent())); \
+    }
+
+    CNL_IMPL_DYNAMIC_SCALED_INTEGER_ALIGNED_OPERATOR(+, add_op)
+
+    CNL_IMPL_DYNAMIC_SCALED_INTEGER_ALIGNED_OPERATOR(-, subtract_op)
+
+#undef CNL_IMPL_DYNAMIC_SCALED_INTEGER_ALIGNED_OPERATOR
+
+    template<typename LhsRep, typename RhsRep>
+    CNL_NODISCARD constexpr auto operator*(
+            dynamic_scaled_integer<LhsRep> const& lhs, dynamic_scaled_integer<RhsRep> const& rhs)
+    -> dynamic_scaled_integer<decltype(lhs.mantissa()*rhs.mantissa())>
+    {
+        return dynamic_scaled_integer<decltype(lhs.mantissa()*rhs.mantissa())>(
+                lhs.mantissa()*rhs.mantissa(), lhs.exponent()+rhs.exponent());
+    }
+
+    // as with scaled_integer, the mantissas are divided as integers
+    template<typename LhsRep, typename RhsRep>
+    CNL_NODISCARD constexpr auto operator/(
+            dynamic_scaled_integer<LhsRep> const& lhs, dynamic_scaled_integer<RhsRep> const& rhs)
+    -> dynamic_scaled_integer<decltype(lhs.mantissa()/rhs.mantissa())>
+    {
+        return dynamic_scaled_integer<decltype(lhs.mantissa()/rhs.mantissa())>(
+                lhs.mantissa()/rhs.mantissa(), lhs.exponent()-rhs.exponent());
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // shift operators
+
+    // multiply or divide by a power of two by changing the exponent; the mantissa is unchanged
+    template<typename Rep>
+    CNL_NODISCARD constexpr dynamic_scaled_integer<Rep> operator<<(
+            dynamic_scaled_integer<Rep> const& lhs, int rhs)
+    {
+        return dynamic_scaled_integer<Rep>(lhs.mantissa(), lhs.exponent()+rhs);
+    }
+
+    template<typename Rep>
+    CNL_NODISCARD constexpr dynamic_scaled_integer<Rep> operator>>(
+            dynamic_scaled_integer<Rep> const& lhs, int rhs)
+    {
+        return dynamic_scaled_integer<Rep>(lhs.mantissa(), lhs.exponent()-rhs);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // comparison operators
+
+#define CNL_IMPL_DYNAMIC_SCALED_INTEGER_COMPARISON_OPERATOR(OP) \
+    template<typename LhsRep, typename RhsRep> \
+    CNL_NODISCARD constexpr bool operator OP( \
+            dynamic_scaled_integer<LhsRep> const& lhs, dynamic_scaled_integer<RhsRep> const& rhs) \
+    { \
+        using common_rep = _impl::dynamic_result_t<LhsRep, RhsRep>; \
+        return _impl::dynamic_compare( \
+                static_cast<common_rep>(lhs.mantissa()), lhs.exponent(), \
+                static_cast<common_rep>(rhs.mantissa()), rhs.exponent()) OP 0; \
+    }
+
+    CNL_IMPL_DYNAMIC_SCALED_INTEGER_COMPARISON_OPERATOR(==)
+
+    CNL_IMPL_DYNAMIC_SCALED_INTEGER_COMPARISON_OPERATOR(!=)
+
+    CNL_IMPL_DYNAMIC_SCALED_INTEGER_COMPARISON_OPERATOR(<)
+
+    CNL_IMPL_DYNAMIC_SCALED_INTEGER_COMPARISON_OPERATOR(>)
+
+    CNL_IMPL_DYNAMIC_SCALED_INTEGER_COMPARISON_OPERATOR(<=)
+
+    CNL_IMPL_DYNAMIC_SCALED_INTEGER_COMPARISON_OPERATOR(>=)
+
+#undef CNL_IMPL_DYNAMIC_SCALED_INTEGER_COMPARISON_OPERATOR
+}
+
+#endif  // CNL_IMPL_DYNAMIC_SCALED_INTEGER_OPERATORS_H
@@ -0,0 +1,100 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_DYNAMIC_SCALED_INTEGER_TYPE_H)
+#define CNL_IMPL_DYNAMIC_SCALED_INTEGER_TYPE_H
+
+#include "../block_scaled_array/type.h"
+#include "../config.h"
+#include "../num_traits/to_rep.h"
+#include "../scaled/power.h"
+#include "../scaled_integer/type.h"
+#include "../type_traits/enable_if.h"
+
+#include <cmath>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief integer mantissa scaled by a power of two which is determined at run time
+    ///
+    /// \tparam Rep the integer type of the mantissa
+    ///
+    /// The value is `mantissa()*2^exponent()`.
+    /// As with \ref scaled_integer, addition and subtraction align their operands to the lower exponent,
+    /// multiplication adds exponents and division subtracts them; the mantissas follow the rules of \c Rep.
+    /// Where aligning to the lower exponent would overflow \c Rep, the exponent of a sum or difference is raised
+    /// and the lesser operand is rounded toward negative infinity.
+    /// Comparisons are exact for any exponents.
+    /// Shift operators change only the exponent and so are exact.
+    /// Conversion to \ref scaled_integer rounds toward negative infinity.
+    /// Use \ref cnl::visit to convert to the \ref scaled_integer instantiation matching the run-time exponent.
+    ///
+    /// \headerfile cnl/dynamic_scaled_integer.h
+    /// \sa cnl::scaled_integer, cnl::block_scaled_array, cnl::visit
+    template<typename Rep = int>
+    class dynamic_scaled_integer {
+    public:
+        using rep = Rep;
+
+        constexpr dynamic_scaled_integer()
+                : _mantissa{0}, _exponent{0}
+        {
+        }
+
+        /// initializes the value, `mantissa*2^exponent`
+        constexpr dynamic_scaled_integer(Rep const& mantissa, int exponent)
+                : _mantissa(mantissa), _exponent(exponent)
+        {
+        }
+
+        /// initializes the value with the mantissa and exponent of \c from
+        template<typename FromRep, int FromExponent>
+        constexpr dynamic_scaled_integer(  // NOLINT(hicpp-explicit-conversions)
+                scaled_integer<FromRep, power<FromExponent>> const& from)
+                : _mantissa(static_cast<Rep>(_impl::to_rep(from))), _exponent(FromExponent)
+        {
+        }
+
+        /// converts to a floating-point type
+        template<typename S, _impl::enable_if_t<std::is_floating_point<S>::value, int> = 0>
+        CNL_NODISCARD explicit operator S() const
+        {
+            return std::ldexp(static_cast<S>(_mantissa), _exponent);
+        }
+
+        CNL_NODISCARD constexpr Rep const& mantissa() const
+        {
+            return _mantissa;
+        }
+
+        /// returns the power of two by which the mantissa is multiplied
+        CNL_NODISCARD constexpr int exponent() const
+        {
+            return _exponent;
+        }
+
+        /// returns the value with the given exponent, rounding toward negative infinity;
+        /// as with a native shift, a left shift which overflows \c Rep is not handled
+        CNL_NODISCARD constexpr dynamic_scaled_integer rescaled(int exponent) const
+        {
+            return dynamic_scaled_integer(rescaled_mantissa<Rep>(exponent), exponent);
+        }
+
+        /// returns the mantissa, converted to Integer, of the value with the given exponent
+        template<typename Integer>
+        CNL_NODISCARD constexpr Integer rescaled_mantissa(int exponent) const
+        {
+            return _impl::block_scale(static_cast<Integer>(_mantissa), _exponent-exponent);
+        }
+
+    private:
+        Rep _mantissa;
+        int _exponent;
+    };
+}
+
+#endif  // CNL_IMPL_DYNAMIC_SCALED_INTEGER_TYPE_H
@@ -0,0 +1,86 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_DYNAMIC_SCALED_INTEGER_VISIT_H)
+#define CNL_IMPL_DYNAMIC_SCALED_INTEGER_VISIT_H
+
+#include "../common.h"
+#include "../config.h"
+#include "../index_sequence.h"
+#include "../num_traits/from_rep.h"
+#include "../scaled/power.h"
+#include "../scaled_integer/type.h"
+#include "type.h"
+
+#include <cstddef>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::dynamic_visit_exponent
+
+        // invokes function with mantissa as a scaled_integer of exponent, Exponent
+        template<typename Rep, int Exponent, typename Result, typename Function>
+        Result dynamic_visit_exponent(Function& function, Rep const& mantissa)
+        {
+            return function(from_rep<scaled_integer<Rep, power<Exponent>>>(mantissa));
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::dynamic_visit_table
+
+        // table of the instantiations of dynamic_visit_exponent from MinExponent up to MinExponent+sizeof...(Index)-1
+        template<typename Rep, int MinExponent, typename Result, typename Function, typename IndexSequence>
+        struct dynamic_visit_table;
+
+        template<typename Rep, int MinExponent, typename Result, typename Function, std::size_t... Index>
+        struct dynamic_visit_table<Rep, MinExponent, Result, Function, index_sequence<Index...>> {
+            using entry = Result (*)(Function&, Rep const&);
+
+            static constexpr entry entries[sizeof...(Index)] = {
+                    &dynamic_visit_exponent<Rep, MinExponent+static_cast<int>(Index), Result, Function>...};
+        };
+
+        template<typename Rep, int MinExponent, typename Result, typename Function, std::size_t... Index>
+        constexpr typename dynamic_visit_table<Rep, MinExponent, Result, Function, index_sequence<Index...>>::entry
+                dynamic_visit_table<Rep, MinExponent, Result, Function, index_sequence<Index...>>::entries[
+                sizeof...(Index)];
+    }
+
+    /// \brief invokes a function with a \ref dynamic_scaled_integer converted to \ref scaled_integer
+    ///
+    /// \tparam MinExponent lowest exponent for which the function is instantiated
+    /// \tparam MaxExponent highest exponent for which the function is instantiated
+    /// \param function function object which accepts `scaled_integer<Rep, power<Exponent>>`
+    /// for each exponent in the range `[MinExponent, MaxExponent]`
+    /// \param value value whose run-time exponent selects the instantiation of function
+    ///
+    /// \return result of invoking function with value as a \ref scaled_integer of the same exponent
+    ///
+    /// The instantiation is selected by indexing a table of function pointers, rather than by testing each exponent.
+    /// A value whose exponent lies outside the range is first rescaled to the nearest exponent in the range:
+    /// a lower exponent is rounded toward negative infinity and a higher exponent is shifted left.
+    ///
+    /// \sa cnl::dynamic_scaled_integer
+    template<int MinExponent, int MaxExponent, typename Function, typename Rep>
+    auto visit(Function&& function, dynamic_scaled_integer<Rep> const& value)
+    -> decltype(function(scaled_integer<Rep, power<MinExponent>>{}))
+    {
+        static_assert(MinExponent<=MaxExponent, "empty range of exponents");
+
+        using result = decltype(function(scaled_integer<Rep, power<MinExponent>>{}));
+        using table = _impl::dynamic_visit_table<
+                Rep, MinExponent, result, typename std::remove_reference<Function>::type,
+                _impl::make_index_sequence<MaxExponent-MinExponent+1>>;
+
+        auto const exponent = _impl::max(MinExponent, _impl::min(MaxExponent, value.exponent()));
+        return table::entries[exponent-MinExponent](function, value.rescaled(exponent).mantissa());
+    }
+}
+
+#endif  // CNL_IMPL_DYNAMIC_SCALED_INTEGER_VISIT_H
@@ -0,0 +1,98 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_ELASTIC_EXPRESSION_OPERATORS_H)
+#define CNL_IMPL_ELASTIC_EXPRESSION_OPERATORS_H
+
+#include "../config.h"
+#include "../operators/operators.h"
+#include "../type_traits/enable_if.h"
+#include "type.h"
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::elastic_operand
+
+        // an operand of an elastic expression; either an expression or a value to become a leaf
+        template<typename Operand, class Enable = void>
+        struct elastic_operand {
+        };
+
+        template<typename Operand>
+        struct elastic_operand<Operand, enable_if_t<is_elastic_expression<Operand>::value>> {
+            using type = Operand;
+
+            CNL_NODISCARD constexpr Operand operator()(Operand const& operand) const
+            {
+                return operand;
+            }
+        };
+
+        template<typename Operand>
+        struct elastic_operand<Operand, enable_if_t<elastic_leaf_range<Operand>::digits!=0>> {
+            using type = elastic_leaf<Operand>;
+
+            CNL_NODISCARD constexpr elastic_leaf<Operand> operator()(Operand const& operand) const
+            {
+                return elastic_leaf<Operand>{operand};
+            }
+        };
+
+        template<typename Operand>
+        using elastic_operand_t = typename elastic_operand<Operand>::type;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::elastic_binary_t
+
+        // node of Operator applied to Lhs and Rhs, where at least one is already an expression
+        template<class Operator, typename Lhs, typename Rhs>
+        using elastic_binary_t = enable_if_t<
+                is_elastic_expression<Lhs>::value || is_elastic_expression<Rhs>::value,
+                elastic_binary<Operator, elastic_operand_t<Lhs>, elastic_operand_t<Rhs>>>;
+
+        template<class Operator, typename Lhs, typename Rhs>
+        CNL_NODISCARD constexpr elastic_binary_t<Operator, Lhs, Rhs> make_elastic_binary(Lhs const& lhs, Rhs const& rhs)
+        {
+            return elastic_binary_t<Operator, Lhs, Rhs>{
+                    elastic_operand<Lhs>{}(lhs), elastic_operand<Rhs>{}(rhs)};
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // elastic expression operators
+
+        template<class Operand>
+        CNL_NODISCARD constexpr auto operator-(Operand const& operand)
+        -> enable_if_t<is_elastic_expression<Operand>::value, elastic_negate<Operand>>
+        {
+            return elastic_negate<Operand>{operand};
+        }
+
+        template<typename Lhs, typename Rhs>
+        CNL_NODISCARD constexpr auto operator+(Lhs const& lhs, Rhs const& rhs)
+        -> elastic_binary_t<add_op, Lhs, Rhs>
+        {
+            return make_elastic_binary<add_op>(lhs, rhs);
+        }
+
+        template<typename Lhs, typename Rhs>
+        CNL_NODISCARD constexpr auto operator-(Lhs const& lhs, Rhs const& rhs)
+        -> elastic_binary_t<subtract_op, Lhs, Rhs>
+        {
+            return make_elastic_binary<subtract_op>(lhs, rhs);
+        }
+
+        template<typename Lhs, typename Rhs>
+        CNL_NODISCARD constexpr auto operator*(Lhs const& lhs, Rhs const& rhs)
+        -> elastic_binary_t<multiply_op, Lhs, Rhs>
+        {
+            return make_elastic_binary<multiply_op>(lhs, rhs);
+        }
+    }
+}
+
+#endif  // CNL_IMPL_ELASTIC_EXPRESSION_OPERATORS_H
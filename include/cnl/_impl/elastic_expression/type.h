@@ -0,0 +1,410 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_ELASTIC_EXPRESSION_TYPE_H)
+#define CNL_IMPL_ELASTIC_EXPRESSION_TYPE_H
+
+#include "../../limits.h"
+#include "../common.h"
+#include "../config.h"
+#include "../elastic_integer/declaration.h"
+#include "../elastic_tag/policy.h"
+#include "../num_traits/rep.h"
+#include "../num_traits/unwrap.h"
+#include "../num_traits/wrap.h"
+#include "../operators/operators.h"
+#include "../scaled/power.h"
+#include "../scaled_integer/declaration.h"
+#include "../type_traits/remove_cvref.h"
+#include "../used_digits.h"
+
+#include <type_traits>
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::elastic_leaf_range
+
+        // digits, exponent and signedness of a value which can be a leaf of an elastic expression
+        template<typename Value>
+        struct elastic_leaf_range;
+
+        template<int Digits, class Narrowest>
+        struct elastic_leaf_range<elastic_integer<Digits, Narrowest>> {
+            static constexpr int digits = Digits;
+            static constexpr int exponent = 0;
+            static constexpr bool is_signed = numeric_limits<Narrowest>::is_signed;
+            static constexpr bool is_scaled = false;
+        };
+
+        template<int Digits, class Narrowest, int Exponent>
+        struct elastic_leaf_range<scaled_integer<elastic_integer<Digits, Narrowest>, power<Exponent>>>
+                : elastic_leaf_range<elastic_integer<Digits, Narrowest>> {
+            static constexpr int exponent = Exponent;
+            static constexpr bool is_scaled = true;
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // expression nodes
+
+        template<typename Value>
+        struct elastic_leaf {
+            Value value;
+        };
+
+        template<class Operand>
+        struct elastic_negate {
+            Operand operand;
+        };
+
+        template<class Operator, class Lhs, class Rhs>
+        struct elastic_binary {
+            Lhs lhs;
+            Rhs rhs;
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::is_elastic_expression
+
+        template<typename T>
+        struct is_elastic_expression : std::false_type {
+        };
+
+        template<typename Value>
+        struct is_elastic_expression<elastic_leaf<Value>> : std::true_type {
+        };
+
+        template<class Operand>
+        struct is_elastic_expression<elastic_negate<Operand>> : std::true_type {
+        };
+
+        template<class Operator, class Lhs, class Rhs>
+        struct is_elastic_expression<elastic_binary<Operator, Lhs, Rhs>> : std::true_type {
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::elastic_alignment
+
+        // shifts which bring the operands of Operator to a common exponent and the exponent of the result;
+        // as with scaled_integer, addition and subtraction align to the lesser exponent
+        template<class Operator, int LhsExponent, int RhsExponent>
+        struct elastic_alignment {
+            static constexpr int exponent = _impl::min(LhsExponent, RhsExponent);
+            static constexpr int lhs_shift = LhsExponent-exponent;
+            static constexpr int rhs_shift = RhsExponent-exponent;
+        };
+
+        template<int LhsExponent, int RhsExponent>
+        struct elastic_alignment<multiply_op, LhsExponent, RhsExponent> {
+            static constexpr int exponent = LhsExponent+RhsExponent;
+            static constexpr int lhs_shift = 0;
+            static constexpr int rhs_shift = 0;
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::elastic_can_add / elastic_can_subtract / elastic_can_multiply / elastic_can_shift
+
+        // true iff the result of the operation is representable in intmax
+        CNL_NODISCARD constexpr bool elastic_can_add(intmax lhs, intmax rhs)
+        {
+            return (rhs<0) ? lhs>=numeric_limits<intmax>::lowest()-rhs : lhs<=numeric_limits<intmax>::max()-rhs;
+        }
+
+        CNL_NODISCARD constexpr bool elastic_can_subtract(intmax lhs, intmax rhs)
+        {
+            return (rhs>0) ? lhs>=numeric_limits<intmax>::lowest()+rhs : lhs<=numeric_limits<intmax>::max()+rhs;
+        }
+
+        CNL_NODISCARD constexpr uintmax elastic_magnitude(intmax value)
+        {
+            return (value<0) ? uintmax{0}-static_cast<uintmax>(value) : static_cast<uintmax>(value);
+        }
+
+        CNL_NODISCARD constexpr bool elastic_can_multiply(intmax lhs, intmax rhs)
+        {
+            return lhs==0
+                   || elastic_magnitude(rhs)<=elastic_magnitude(numeric_limits<intmax>::max())/elastic_magnitude(lhs);
+        }
+
+        CNL_NODISCARD constexpr bool elastic_can_shift(intmax value, int shift)
+        {
+            return shift<numeric_limits<intmax>::digits && elastic_can_multiply(value, intmax{1} << shift);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::elastic_node
+
+        // number of digits needed to represent value;
+        // used_digits is not applied to negative values because intmax may not satisfy std::is_signed
+        CNL_NODISCARD constexpr int elastic_digits(intmax value)
+        {
+            return used_digits((value<0) ? -1-value : value);
+        }
+
+        // range of a node of an elastic expression;
+        // if Exact, every value of the node lies in [Lowest, Max] and the node has the fewest digits which hold them;
+        // otherwise, the range cannot be represented in intmax and the node has the given digits and signedness
+        template<bool Exact, intmax Lowest, intmax Max, int Digits, bool IsSigned>
+        struct elastic_node {
+            static constexpr bool exact = Exact;
+            static constexpr intmax lowest = Lowest;
+            static constexpr intmax max = Max;
+            static constexpr int digits = Exact ? _impl::max(1, _impl::max(elastic_digits(Lowest), elastic_digits(Max)))
+                                                : Digits;
+            static constexpr bool is_signed = Exact ? Lowest<0 : IsSigned;
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::elastic_shifted
+
+        // range of Node multiplied by two to the power of Shift
+        template<class Node, int Shift, bool Exact = Node::exact
+                && elastic_can_shift(Node::lowest, Shift) && elastic_can_shift(Node::max, Shift)>
+        struct elastic_shifted : elastic_node<
+                Exact,
+                Exact ? Node::lowest*(intmax{1} << Shift) : 0,
+                Exact ? Node::max*(intmax{1} << Shift) : 0,
+                Node::digits+Shift, Node::is_signed> {
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::elastic_interval
+
+        // range of the result of applying Operator to values in the ranges of nodes, Lhs and Rhs
+        template<class Operator, class Lhs, class Rhs>
+        struct elastic_interval;
+
+        template<class Lhs, class Rhs>
+        struct elastic_interval<add_op, Lhs, Rhs> {
+            static constexpr bool exact = Lhs::exact && Rhs::exact
+                    && elastic_can_add(Lhs::lowest, Rhs::lowest) && elastic_can_add(Lhs::max, Rhs::max);
+            static constexpr intmax lowest = exact ? Lhs::lowest+Rhs::lowest : 0;
+            static constexpr intmax max = exact ? Lhs::max+Rhs::max : 0;
+        };
+
+        template<class Lhs, class Rhs>
+        struct elastic_interval<subtract_op, Lhs, Rhs> {
+            static constexpr bool exact = Lhs::exact && Rhs::exact
+                    && elastic_can_subtract(Lhs::lowest, Rhs::max) && elastic_can_subtract(Lhs::max, Rhs::lowest);
+            static constexpr intmax lowest = exact ? Lhs::lowest-Rhs::max : 0;
+            static constexpr intmax max = exact ? Lhs::max-Rhs::lowest : 0;
+        };
+
+        template<class Lhs, class Rhs>
+        struct elastic_interval<multiply_op, Lhs, Rhs> {
+            static constexpr bool exact = Lhs::exact && Rhs::exact
+                    && elastic_can_multiply(Lhs::lowest, Rhs::lowest) && elastic_can_multiply(Lhs::lowest, Rhs::max)
+                    && elastic_can_multiply(Lhs::max, Rhs::lowest) && elastic_can_multiply(Lhs::max, Rhs::max);
+            static constexpr intmax lowest = exact ? _impl::min(
+                    _impl::min(Lhs::lowest*Rhs::lowest, Lhs::lowest*Rhs::max),
+                    _impl::min(Lhs::max*Rhs::lowest, Lhs::max*Rhs::max)) : 0;
+            static constexpr intmax max = exact ? _impl::max(
+                    _impl::max(Lhs::lowest*Rhs::lowest, Lhs::lowest*Rhs::max),
+                    _impl::max(Lhs::max*Rhs::lowest, Lhs::max*Rhs::max)) : 0;
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::elastic_range
+
+        // range, exponent and signedness of an expression
+        // and the digits and signedness of an integer which can hold any node within it;
+        // where a range cannot be represented in intmax, digits are determined by the elastic_tag policy
+        template<class Expression>
+        struct elastic_range;
+
+        // as with the numeric_limits of elastic_integer, the range of a signed leaf is symmetrical
+        template<typename Value, class Leaf = elastic_leaf_range<Value>,
+                bool Exact = (Leaf::digits<=numeric_limits<intmax>::digits),
+                intmax Max = (Exact
+                        ? numeric_limits<intmax>::max() >> (numeric_limits<intmax>::digits-Leaf::digits)
+                        : 0)>
+        struct elastic_leaf_node : elastic_node<Exact, Leaf::is_signed ? -Max : 0, Max, Leaf::digits, Leaf::is_signed> {
+        };
+
+        template<typename Value>
+        struct elastic_range<elastic_leaf<Value>> : elastic_leaf_node<Value> {
+            static constexpr int exponent = elastic_leaf_range<Value>::exponent;
+            static constexpr bool is_scaled = elastic_leaf_range<Value>::is_scaled;
+            static constexpr int rep_digits = elastic_leaf_node<Value>::digits;
+            static constexpr bool rep_is_signed = elastic_leaf_node<Value>::is_signed;
+        };
+
+        template<class Operand, class Node = elastic_range<Operand>,
+                bool Exact = Node::exact && Node::lowest!=numeric_limits<intmax>::lowest()>
+        struct elastic_negate_node : elastic_node<
+                Exact, Exact ? -Node::max : 0, Exact ? -Node::lowest : 0, Node::digits, true> {
+        };
+
+        template<class Operand>
+        struct elastic_range<elastic_negate<Operand>> : elastic_negate_node<Operand> {
+            static constexpr int exponent = elastic_range<Operand>::exponent;
+            static constexpr bool is_scaled = elastic_range<Operand>::is_scaled;
+            static constexpr int rep_digits = _impl::max(
+                    elastic_negate_node<Operand>::digits, elastic_range<Operand>::rep_digits);
+            static constexpr bool rep_is_signed = true;
+        };
+
+        template<class Operator, class Lhs, class Rhs>
+        struct elastic_binary_node {
+            using alignment = elastic_alignment<Operator, elastic_range<Lhs>::exponent, elastic_range<Rhs>::exponent>;
+            using lhs_operand = elastic_shifted<elastic_range<Lhs>, alignment::lhs_shift>;
+            using rhs_operand = elastic_shifted<elastic_range<Rhs>, alignment::rhs_shift>;
+            using interval = elastic_interval<Operator, lhs_operand, rhs_operand>;
+            using result = policy<
+                    Operator,
+                    lhs_operand::digits, lhs_operand::is_signed,
+                    rhs_operand::digits, rhs_operand::is_signed>;
+            using type = elastic_node<
+                    interval::exact, interval::lowest, interval::max,
+                    result::digits, result::is_signed>;
+        };
+
+        template<class Operator, class Lhs, class Rhs>
+        struct elastic_range<elastic_binary<Operator, Lhs, Rhs>>
+                : elastic_binary_node<Operator, Lhs, Rhs>::type {
+        private:
+            using node = elastic_binary_node<Operator, Lhs, Rhs>;
+            using lhs_range = elastic_range<Lhs>;
+            using rhs_range = elastic_range<Rhs>;
+        public:
+            static constexpr int exponent = node::alignment::exponent;
+            static constexpr bool is_scaled = lhs_range::is_scaled || rhs_range::is_scaled;
+            static constexpr int rep_digits = _impl::max(
+                    _impl::max(node::type::digits, _impl::max(lhs_range::rep_digits, rhs_range::rep_digits)),
+                    _impl::max(node::lhs_operand::digits, node::rhs_operand::digits));
+            static constexpr bool rep_is_signed = node::type::is_signed
+                    || lhs_range::rep_is_signed || rhs_range::rep_is_signed
+                    || node::lhs_operand::is_signed || node::rhs_operand::is_signed;
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::elastic_expression_result_t
+
+        // elastic type of the value of Expression
+        template<class Expression, bool IsScaled = elastic_range<Expression>::is_scaled>
+        struct elastic_expression_result {
+            using type = elastic_integer<
+                    elastic_range<Expression>::digits,
+                    typename std::conditional<elastic_range<Expression>::is_signed, signed, unsigned>::type>;
+        };
+
+        template<class Expression>
+        struct elastic_expression_result<Expression, true> {
+            using type = scaled_integer<
+                    typename elastic_expression_result<Expression, false>::type,
+                    power<elastic_range<Expression>::exponent>>;
+        };
+
+        template<class Expression>
+        using elastic_expression_result_t = typename elastic_expression_result<Expression>::type;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::elastic_expression_rep_t
+
+        // the single integer type in which every node of Expression is evaluated
+        template<class Expression>
+        using elastic_expression_rep_t = rep_t<elastic_integer<
+                elastic_range<Expression>::rep_digits,
+                typename std::conditional<elastic_range<Expression>::rep_is_signed, signed, unsigned>::type>>;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::elastic_evaluate
+
+        // multiplies value by two to the power of shift
+        template<typename Rep>
+        CNL_NODISCARD constexpr Rep elastic_scale(Rep const& value, int shift)
+        {
+            return shift ? static_cast<Rep>(value*static_cast<Rep>(Rep{1} << shift)) : value;
+        }
+
+        // value of Expression as an integer of type, Rep, to be multiplied by two to the power of its exponent
+        template<typename Rep, class Expression>
+        struct elastic_evaluate;
+
+        template<typename Rep, typename Value>
+        struct elastic_evaluate<Rep, elastic_leaf<Value>> {
+            CNL_NODISCARD constexpr Rep operator()(elastic_leaf<Value> const& leaf) const
+            {
+                return static_cast<Rep>(cnl::unwrap(leaf.value));
+            }
+        };
+
+        template<typename Rep, class Operand>
+        struct elastic_evaluate<Rep, elastic_negate<Operand>> {
+            CNL_NODISCARD constexpr Rep operator()(elastic_negate<Operand> const& negate) const
+            {
+                return static_cast<Rep>(-elastic_evaluate<Rep, Operand>{}(negate.operand));
+            }
+        };
+
+        template<typename Rep, class Operator, class Lhs, class Rhs>
+        struct elastic_evaluate<Rep, elastic_binary<Operator, Lhs, Rhs>> {
+            using alignment = elastic_alignment<Operator, elastic_range<Lhs>::exponent, elastic_range<Rhs>::exponent>;
+
+            CNL_NODISCARD constexpr Rep operator()(elastic_binary<Operator, Lhs, Rhs> const& binary) const
+            {
+                return static_cast<Rep>(Operator{}(
+                        elastic_scale(elastic_evaluate<Rep, Lhs>{}(binary.lhs), alignment::lhs_shift),
+                        elastic_scale(elastic_evaluate<Rep, Rhs>{}(binary.rhs), alignment::rhs_shift)));
+            }
+        };
+    }
+
+    /// \brief begins an expression of elastic values which is evaluated in a single step by \ref evaluate
+    ///
+    /// \param value an \ref elastic_integer or \ref elastic_scaled_integer
+    ///
+    /// Operators `+`, `-` and `*` which have an elastic expression as either operand
+    /// produce a larger expression rather than a value. The expression records its operands
+    /// and computes, at compile time, the exact range of every node from the limits of its operands.
+    /// \ref evaluate then computes every node in the narrowest integer type which holds every node
+    /// instead of producing a temporary of a different type for each operation.
+    /// Because each operator of \ref elastic_tag adds digits for the worst case of its own operands,
+    /// the exact range of a whole expression can require fewer digits than the last of those temporaries.
+    /// Where a range cannot be represented in \c intmax, the digits of that node are those of \ref elastic_tag.
+    ///
+    /// \par Example
+    ///
+    /// \code
+    /// auto const a = elastic_integer<31>{-2147483647};
+    /// auto const expression = make_elastic_expression(a)*a+make_elastic_expression(a)*a-a;
+    /// auto const result = evaluate(expression);  // elastic_integer<63>, calculated using int64_t
+    /// auto const temporaries = a*a+a*a-a;  // elastic_integer<64>, which requires a 128-bit integer
+    /// \endcode
+    ///
+    /// \headerfile cnl/elastic_expression.h
+    /// \sa cnl::evaluate, cnl::elastic_integer, cnl::elastic_scaled_integer
+    template<typename Value>
+    CNL_NODISCARD constexpr auto make_elastic_expression(Value const& value)
+    -> decltype(_impl::elastic_leaf_range<Value>::digits, _impl::elastic_leaf<Value>{value})
+    {
+        return _impl::elastic_leaf<Value>{value};
+    }
+
+    /// \brief returns the value of an expression created using \ref make_elastic_expression
+    ///
+    /// The result has the value and exponent of the equivalent expression of elastic values
+    /// and the fewest digits which hold its range, e.g. `elastic_scaled_integer<Digits, Exponent>`
+    /// or `elastic_integer<Digits>`. It never has more digits than the equivalent expression.
+    ///
+    /// \headerfile cnl/elastic_expression.h
+    /// \sa cnl::make_elastic_expression
+    template<class Expression>
+    CNL_NODISCARD constexpr auto evaluate(Expression const& expression)
+    -> _impl::enable_if_t<
+            _impl::is_elastic_expression<Expression>::value,
+            _impl::elastic_expression_result_t<Expression>>
+    {
+        using result = _impl::elastic_expression_result_t<Expression>;
+        using result_rep = _impl::remove_cvref_t<decltype(cnl::unwrap(std::declval<result>()))>;
+        return cnl::wrap<result>(static_cast<result_rep>(
+                _impl::elastic_evaluate<_impl::elastic_expression_rep_t<Expression>, Expression>{}(expression)));
+    }
+}
+
+#endif  // CNL_IMPL_ELASTIC_EXPRESSION_TYPE_H
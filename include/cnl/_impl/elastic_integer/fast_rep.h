@@ -0,0 +1,75 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_ELASTIC_INTEGER_FAST_REP_H)
+#define CNL_IMPL_ELASTIC_INTEGER_FAST_REP_H
+
+#include "../num_traits/digits.h"
+#include "../num_traits/set_digits.h"
+#include "../type_traits/is_signed.h"
+#include "definition.h"
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief \c Narrowest parameter of \ref elastic_integer for values held in registers
+    ///
+    /// \tparam Integer fundamental integer type whose signedness and width are the minimum required
+    ///
+    /// The result has the signedness of \c Integer and is at least as wide as \c int, the natural width of the
+    /// target architecture. Arithmetic upon narrower types can incur sign- or zero-extension and partial-register
+    /// stalls.
+    ///
+    /// \headerfile cnl/elastic_integer.h
+    /// \sa cnl::storage_rep, cnl::to_fast_rep
+    template<typename Integer = int>
+    struct fast_rep : set_digits<
+            Integer,
+            _impl::max(digits<Integer>::value, _impl::machine_digits<is_signed<Integer>::value>::value)> {
+    };
+
+    /// \brief helper alias of \ref cnl::fast_rep
+    /// \headerfile cnl/elastic_integer.h
+    template<typename Integer = int>
+    using fast_rep_t = typename fast_rep<Integer>::type;
+
+    /// \brief \c Narrowest parameter of \ref elastic_integer for values held in memory
+    ///
+    /// \tparam Integer fundamental integer type whose signedness is required
+    ///
+    /// The result is the narrowest fundamental integer with the signedness of \c Integer,
+    /// so that an \ref elastic_integer occupies no more bytes than its digits require.
+    ///
+    /// \headerfile cnl/elastic_integer.h
+    /// \sa cnl::fast_rep, cnl::to_storage_rep
+    template<typename Integer = int>
+    struct storage_rep : set_digits<Integer, 1> {
+    };
+
+    /// \brief helper alias of \ref cnl::storage_rep
+    /// \headerfile cnl/elastic_integer.h
+    template<typename Integer = int>
+    using storage_rep_t = typename storage_rep<Integer>::type;
+
+    /// \brief converts an \ref elastic_integer to the same value in a type suited to arithmetic
+    /// \headerfile cnl/elastic_integer.h
+    template<int Digits, class Narrowest>
+    CNL_NODISCARD constexpr auto to_fast_rep(elastic_integer<Digits, Narrowest> const& value)
+    -> elastic_integer<Digits, fast_rep_t<Narrowest>>
+    {
+        return elastic_integer<Digits, fast_rep_t<Narrowest>>{value};
+    }
+
+    /// \brief converts an \ref elastic_integer to the same value in a type of the least width
+    /// \headerfile cnl/elastic_integer.h
+    template<int Digits, class Narrowest>
+    CNL_NODISCARD constexpr auto to_storage_rep(elastic_integer<Digits, Narrowest> const& value)
+    -> elastic_integer<Digits, storage_rep_t<Narrowest>>
+    {
+        return elastic_integer<Digits, storage_rep_t<Narrowest>>{value};
+    }
+}
+
+#endif  // CNL_IMPL_ELASTIC_INTEGER_FAST_REP_H
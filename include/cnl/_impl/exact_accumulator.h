@@ -0,0 +1,161 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief types and loops which sum products without overflow
+
+#if !defined(CNL_IMPL_EXACT_ACCUMULATOR_H)
+#define CNL_IMPL_EXACT_ACCUMULATOR_H
+
+#include "../cstdint.h"
+#include "../wide_integer.h"
+#include "config.h"
+#include "num_traits/digits.h"
+#include "num_traits/is_composite.h"
+#include "num_traits/max_digits.h"
+#include "num_traits/rep.h"
+#include "num_traits/set_digits.h"
+#include "num_traits/set_rep.h"
+#include "num_traits/tag.h"
+#include "type_traits/enable_if.h"
+#include "type_traits/is_integral.h"
+#include "type_traits/is_signed.h"
+#include "type_traits/set_signedness.h"
+#include "type_traits/type_identity.h"
+#include "used_digits.h"
+#include "wide_tag/is_wide_tag.h"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::exact_factor_t
+
+        // Lhs widened so that its product with Rhs cannot overflow
+        template<typename Lhs, typename Rhs>
+        using exact_factor_t = set_digits_t<Lhs, digits<Lhs>::value+digits<Rhs>::value>;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::exact_product_t
+
+        // type of the product of Lhs and Rhs with the digits of both
+        template<typename Lhs, typename Rhs>
+        using exact_product_t = set_digits_t<
+                decltype(std::declval<exact_factor_t<Lhs, Rhs>>()*std::declval<Rhs>()),
+                digits<Lhs>::value+digits<Rhs>::value>;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::exact_sum_t
+
+        // number of digits by which a value must be widened to hold the sum of Terms such values
+        CNL_NODISCARD constexpr int sum_headroom(uintmax terms)
+        {
+            return used_digits(terms-1);
+        }
+
+        // true iff T is, or is composed of, a wide_integer, which has no widest rep
+        template<typename T, class Enable = void>
+        struct has_wide_rep : std::false_type {
+        };
+
+        template<typename T>
+        struct has_wide_rep<T, enable_if_t<is_composite<T>::value>>
+                : std::integral_constant<bool, is_wide_tag<tag_t<T>>::value || has_wide_rep<rep_t<T>>::value> {
+        };
+
+        // T with its fundamental integer replaced by a wide_integer of the same digits and signedness
+        template<typename T, class Enable = void>
+        struct wide_rep_of;
+
+        template<typename T>
+        struct wide_rep_of<T, enable_if_t<is_integral<T>::value>>
+                : type_identity<wide_integer<digits<T>::value, set_signedness_t<int, is_signed<T>::value>>> {
+        };
+
+        template<typename T>
+        struct wide_rep_of<T, enable_if_t<is_composite<T>::value>>
+                : type_identity<set_rep_t<T, typename wide_rep_of<rep_t<T>>::type>> {
+        };
+
+        // true iff T has a widest rep and it has fewer than Digits digits
+        template<typename T, int Digits, bool HasWideRep = has_wide_rep<T>::value>
+        struct exceeds_max_digits : std::integral_constant<bool, (max_digits<T>::value<Digits)> {
+        };
+
+        template<typename T, int Digits>
+        struct exceeds_max_digits<T, Digits, true> : std::false_type {
+        };
+
+        // type of T with Digits digits;
+        // where Digits exceeds the widest fundamental integer, T is composed of a wide_integer instead
+        template<typename T, int Digits, class Enable = void>
+        struct exact_widen : set_digits<T, Digits> {
+        };
+
+        template<typename T, int Digits>
+        struct exact_widen<T, Digits, enable_if_t<exceeds_max_digits<T, Digits>::value>>
+                : set_digits<typename wide_rep_of<T>::type, Digits> {
+        };
+
+        // type of T widened by Headroom digits
+        template<typename T, int Headroom>
+        using exact_sum_t = typename exact_widen<T, digits<T>::value+Headroom>::type;
+
+        // type of the sum of products of Lhs and Rhs widened by Headroom digits
+        template<typename Lhs, typename Rhs, int Headroom>
+        using exact_product_sum_t = typename exact_widen<
+                exact_product_t<Lhs, Rhs>,
+                digits<Lhs>::value+digits<Rhs>::value+Headroom>::type;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::exact_multiply
+
+        // returns the product of lhs and rhs without overflow
+        template<typename Lhs, typename Rhs>
+        CNL_NODISCARD constexpr exact_product_t<Lhs, Rhs> exact_multiply(Lhs const& lhs, Rhs const& rhs)
+        {
+            return static_cast<exact_product_t<Lhs, Rhs>>(static_cast<exact_factor_t<Lhs, Rhs>>(lhs)*rhs);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::exact_dot
+
+        // returns the sum of the products of size corresponding elements of lhs and rhs;
+        // Accumulator is expected to have enough digits to hold the result
+        template<typename Accumulator, typename Lhs, typename Rhs>
+        CNL_NODISCARD Accumulator exact_dot(Lhs const* lhs, Rhs const* rhs, std::size_t size)
+        {
+            auto total = Accumulator{};
+            for (std::size_t index = 0; index!=size; ++index) {
+                auto const term = exact_multiply(lhs[index], rhs[index]);
+                total = static_cast<Accumulator>(total+static_cast<Accumulator>(term));
+            }
+            return total;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::exact_multiply_accumulate
+
+        // adds the product of lhs and each of size elements of rhs to the corresponding element of out
+        template<typename Accumulator, typename Lhs, typename Rhs>
+        void exact_multiply_accumulate(Accumulator* out, Lhs const& lhs, Rhs const* rhs, std::size_t size)
+        {
+            using product = exact_product_t<Lhs, Rhs>;
+
+            auto const factor = static_cast<exact_factor_t<Lhs, Rhs>>(lhs);
+            for (std::size_t index = 0; index!=size; ++index) {
+                auto const term = static_cast<product>(factor*rhs[index]);
+                out[index] = static_cast<Accumulator>(out[index]+static_cast<Accumulator>(term));
+            }
+        }
+    }
+}
+
+#endif  // CNL_IMPL_EXACT_ACCUMULATOR_H
@@ -0,0 +1,218 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_FFT_FFT_H)
+#define CNL_IMPL_FFT_FFT_H
+
+#include "../../numeric.h"
+#include "../config.h"
+#include "../exact_accumulator.h"
+#include "../fixed_array/type.h"
+#include "../num_traits/digits.h"
+#include "../num_traits/from_rep.h"
+#include "../num_traits/rep.h"
+#include "../num_traits/to_rep.h"
+#include "../scaled/power.h"
+#include "../scaled_integer/type.h"
+#include "../type_traits/is_signed.h"
+#include "twiddles.h"
+
+#include <cstddef>
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fft_guard_bits
+
+        // the real or imaginary part of a radix-2 butterfly output is at most 1+sqrt(2) times
+        // the largest part of its inputs, so this many leading bits must be clear before each stage
+        constexpr int fft_guard_bits = 2;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fft_fold
+
+        // a value whose number of leading bits is the same as that of value,
+        // combined with bitwise OR to find the fewest leading bits among several values;
+        // the sign is shifted in two steps so that no shift reaches the width of Rep
+        template<typename Rep>
+        CNL_NODISCARD constexpr Rep fft_fold(Rep const& rep)
+        {
+            return static_cast<Rep>(rep ^ ((rep >> (digits<Rep>::value-1)) >> 1));
+        }
+
+        template<typename Rep, int Exponent>
+        CNL_NODISCARD Rep fft_fold(
+                scaled_integer<Rep, power<Exponent>> const* real, scaled_integer<Rep, power<Exponent>> const* imag,
+                std::size_t size)
+        {
+            auto folded = Rep{0};
+            for (std::size_t index = 0; index!=size; ++index) {
+                folded = static_cast<Rep>(folded | fft_fold(to_rep(real[index])) | fft_fold(to_rep(imag[index])));
+            }
+            return folded;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fft_shift_right
+
+        // shifts integer right by shift bits, rounding ties to even so that rounding errors do not
+        // accumulate a bias in the low-frequency bins; does not overflow
+        template<typename Integer>
+        CNL_NODISCARD constexpr Integer fft_round_quotient(
+                Integer const& quotient, Integer const& remainder, Integer const& half)
+        {
+            return static_cast<Integer>(quotient+((remainder>half) | ((remainder==half) & (quotient & 1))));
+        }
+
+        template<typename Integer>
+        CNL_NODISCARD constexpr Integer fft_shift_right(Integer const& integer, int shift)
+        {
+            return fft_round_quotient<Integer>(
+                    static_cast<Integer>(integer >> shift),
+                    static_cast<Integer>(integer & ((Integer{1} << shift)-1)),
+                    static_cast<Integer>(Integer{1} << (shift-1)));
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fft_ensure_headroom
+
+        // shifts every value right just enough that folded has fft_guard_bits leading bits;
+        // returns the number of bits shifted
+        template<typename Rep, int Exponent>
+        int fft_ensure_headroom(
+                scaled_integer<Rep, power<Exponent>>* real, scaled_integer<Rep, power<Exponent>>* imag,
+                std::size_t size, Rep folded)
+        {
+            using value_type = scaled_integer<Rep, power<Exponent>>;
+
+            auto const shift = fft_guard_bits-cnl::leading_bits(folded);
+            if (shift<=0) {
+                return 0;
+            }
+            for (std::size_t index = 0; index!=size; ++index) {
+                real[index] = from_rep<value_type>(fft_shift_right(to_rep(real[index]), shift));
+                imag[index] = from_rep<value_type>(fft_shift_right(to_rep(imag[index]), shift));
+            }
+            return shift;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fft_bit_reverse
+
+        template<typename T>
+        void fft_bit_reverse(T* real, T* imag, std::size_t size)
+        {
+            for (std::size_t index = 1, reversed = 0; index!=size; ++index) {
+                auto bit = size >> 1;
+                for (; (reversed & bit)!=0; bit >>= 1) {
+                    reversed ^= bit;
+                }
+                reversed ^= bit;
+                if (index<reversed) {
+                    std::swap(real[index], real[reversed]);
+                    std::swap(imag[index], imag[reversed]);
+                }
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fft_round
+
+        // rounds a sum of products of values with the given Exponent to that Exponent;
+        // operates on the rep because nearest_rounding_tag conversion is not available for every format
+        template<typename Rep, int Exponent, typename ProductSum>
+        CNL_NODISCARD constexpr scaled_integer<Rep, power<Exponent>> fft_round(ProductSum const& sum)
+        {
+            return from_rep<scaled_integer<Rep, power<Exponent>>>(static_cast<Rep>(
+                    fft_shift_right(to_rep(sum), -Exponent)));
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fft_stage
+
+        // performs the radix-2 decimation-in-time butterflies of one stage in which
+        // each butterfly combines elements half apart; returns the fold of the outputs
+        template<typename Rep, int Exponent>
+        CNL_NODISCARD Rep fft_stage(
+                scaled_integer<Rep, power<Exponent>>* real, scaled_integer<Rep, power<Exponent>>* imag,
+                std::size_t size, std::size_t half,
+                scaled_integer<Rep, power<Exponent>> const* cosine, scaled_integer<Rep, power<Exponent>> const* sine)
+        {
+            using value_type = scaled_integer<Rep, power<Exponent>>;
+            using product_sum = exact_product_sum_t<value_type, value_type, 1>;
+
+            auto const twiddle_stride = size/(2*half);
+            auto folded = Rep{0};
+            for (std::size_t group = 0; group!=size; group += 2*half) {
+                for (std::size_t offset = 0; offset!=half; ++offset) {
+                    auto const top = group+offset;
+                    auto const bottom = top+half;
+                    auto const c = cosine[offset*twiddle_stride];
+                    auto const s = sine[offset*twiddle_stride];
+
+                    // bottom times the twiddle factor, c - i*s, rounded once
+                    auto const t_real = fft_round<Rep, Exponent>(static_cast<product_sum>(
+                            exact_multiply(real[bottom], c)+exact_multiply(imag[bottom], s)));
+                    auto const t_imag = fft_round<Rep, Exponent>(static_cast<product_sum>(
+                            exact_multiply(imag[bottom], c)-exact_multiply(real[bottom], s)));
+
+                    auto const top_real = real[top];
+                    auto const top_imag = imag[top];
+                    real[top] = static_cast<value_type>(top_real+t_real);
+                    imag[top] = static_cast<value_type>(top_imag+t_imag);
+                    real[bottom] = static_cast<value_type>(top_real-t_real);
+                    imag[bottom] = static_cast<value_type>(top_imag-t_imag);
+
+                    folded = static_cast<Rep>(folded
+                            | fft_fold(to_rep(real[top])) | fft_fold(to_rep(imag[top]))
+                            | fft_fold(to_rep(real[bottom])) | fft_fold(to_rep(imag[bottom])));
+                }
+            }
+            return folded;
+        }
+    }
+
+    /// \brief computes the discrete Fourier transform of a complex sequence in place
+    /// using block floating point
+    ///
+    /// \param real the real parts of the input, replaced by the real parts of the output
+    /// \param imag the imaginary parts of the input, replaced by the imaginary parts of the output
+    /// \return the block exponent, `e`, such that the transform is `(real + i*imag) * 2^e`
+    ///
+    /// Before each stage, the headroom of the whole block is measured with \ref cnl::leading_bits.
+    /// Only if a stage could overflow are all values shifted right by the same amount,
+    /// which is added to the block exponent. The twiddle factors are a table in the format of the data
+    /// which is computed at compile time.
+    ///
+    /// \note The decimation-in-time butterflies are radix-2.
+    /// The inner loop operates on separate arrays of real and imaginary parts.
+    ///
+    /// \headerfile cnl/fft.h
+    template<typename Rep, int Exponent, std::size_t N>
+    int fft(
+            fixed_array<scaled_integer<Rep, power<Exponent>>, N>& real,
+            fixed_array<scaled_integer<Rep, power<Exponent>>, N>& imag)
+    {
+        static_assert(N>=2 && (N & (N-1))==0, "the size of an FFT must be a power of two");
+        static_assert(Exponent<0, "the data must have fractional digits in which to represent twiddle factors");
+        static_assert(is_signed<Rep>::value, "the data of an FFT must be signed");
+        using twiddles = _impl::fft_twiddles<scaled_integer<Rep, power<Exponent>>, N>;
+
+        _impl::fft_bit_reverse(real.data(), imag.data(), N);
+
+        auto block_exponent = 0;
+        auto folded = _impl::fft_fold(real.data(), imag.data(), N);
+        for (std::size_t half = 1; half!=N; half *= 2) {
+            block_exponent += _impl::fft_ensure_headroom(real.data(), imag.data(), N, folded);
+            folded = _impl::fft_stage(real.data(), imag.data(), N, half, twiddles::cosine, twiddles::sine);
+        }
+        return block_exponent;
+    }
+}
+
+#endif  // CNL_IMPL_FFT_FFT_H
@@ -0,0 +1,91 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_FFT_TWIDDLES_H)
+#define CNL_IMPL_FFT_TWIDDLES_H
+
+#include "../../limits.h"
+#include "../config.h"
+#include "../index_sequence.h"
+#include "../power_value.h"
+#include "../scaled/power.h"
+#include "../scaled_integer/from_rep.h"
+#include "../scaled_integer/type.h"
+
+#include <cstddef>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fft_cos
+
+        constexpr long double fft_pi = 3.141592653589793238462643383279502884L;
+
+        // sum of the terms of the Taylor series of cos(x) from the one given;
+        // accurate to long double precision for |x| <= pi
+        CNL_NODISCARD constexpr long double fft_cos_series(long double x_squared, long double term, int n)
+        {
+            return (n>40)
+                   ? term
+                   : term+fft_cos_series(x_squared, -term*x_squared/static_cast<long double>((n+1)*(n+2)), n+2);
+        }
+
+        CNL_NODISCARD constexpr long double fft_cos(long double x)
+        {
+            return fft_cos_series(x*x, 1.L, 0);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fft_quantize
+
+        // rounds the fixed-point representation of value to nearest, saturating at the limits of Rep
+        template<typename Rep>
+        CNL_NODISCARD constexpr Rep fft_quantize_rep(long double scaled)
+        {
+            return (scaled>=static_cast<long double>(numeric_limits<Rep>::max()))
+                   ? numeric_limits<Rep>::max()
+                   : (scaled<=static_cast<long double>(numeric_limits<Rep>::lowest()))
+                     ? numeric_limits<Rep>::lowest()
+                     : static_cast<Rep>(scaled+((scaled<0) ? -.5L : .5L));
+        }
+
+        template<typename Rep, int Exponent>
+        CNL_NODISCARD constexpr scaled_integer<Rep, power<Exponent>> fft_quantize(long double value)
+        {
+            return from_rep<scaled_integer<Rep, power<Exponent>>>(
+                    fft_quantize_rep<Rep>(value*power_value<long double, -Exponent, 2>()));
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fft_twiddles
+
+        // the cosine and sine of 2*pi*k/N for 0 <= k < N/2, in the format of T, evaluated at compile time;
+        // because T typically cannot represent 1, the cosine of zero saturates to the largest value of T
+        template<typename T, std::size_t N, class Indices = make_index_sequence<N/2>>
+        struct fft_twiddles;
+
+        template<typename Rep, int Exponent, std::size_t N, std::size_t ... Indices>
+        struct fft_twiddles<scaled_integer<Rep, power<Exponent>>, N, index_sequence<Indices...>> {
+            using value_type = scaled_integer<Rep, power<Exponent>>;
+
+            static constexpr value_type cosine[N/2] = {  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+                    fft_quantize<Rep, Exponent>(fft_cos(2*fft_pi*Indices/N))...};
+            static constexpr value_type sine[N/2] = {  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+                    fft_quantize<Rep, Exponent>(fft_cos(fft_pi/2-2*fft_pi*Indices/N))...};
+        };
+
+        template<typename Rep, int Exponent, std::size_t N, std::size_t ... Indices>
+        constexpr scaled_integer<Rep, power<Exponent>>
+                fft_twiddles<scaled_integer<Rep, power<Exponent>>, N, index_sequence<Indices...>>::cosine[N/2];
+
+        template<typename Rep, int Exponent, std::size_t N, std::size_t ... Indices>
+        constexpr scaled_integer<Rep, power<Exponent>>
+                fft_twiddles<scaled_integer<Rep, power<Exponent>>, N, index_sequence<Indices...>>::sine[N/2];
+    }
+}
+
+#endif  // CNL_IMPL_FFT_TWIDDLES_H
@@ -0,0 +1,114 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_FIR_FILTER_CONVOLVE_H)
+#define CNL_IMPL_FIR_FILTER_CONVOLVE_H
+
+#include "../common.h"
+#include "../config.h"
+#include "../exact_accumulator.h"
+#include "../fixed_array/type.h"
+
+#include <cstddef>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::convolution_t
+
+        // type of each element of the convolution of Lhs and Rhs
+        // where at most Terms products contribute to an element
+        template<typename Lhs, typename Rhs, std::size_t Terms>
+        using convolution_t = exact_product_sum_t<Lhs, Rhs, sum_headroom(Terms)>;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::convolve_accumulate
+
+        // adds the full convolution of lhs and rhs to the lhs_size+rhs_size-1 elements of out;
+        // the inner loop traverses contiguous elements of rhs and out
+        template<typename Result, typename Lhs, typename Rhs>
+        void convolve_accumulate(
+                Result* out, Lhs const* lhs, std::size_t lhs_size, Rhs const* rhs, std::size_t rhs_size)
+        {
+            for (std::size_t lhs_index = 0; lhs_index!=lhs_size; ++lhs_index) {
+                exact_multiply_accumulate(out+lhs_index, lhs[lhs_index], rhs, rhs_size);
+            }
+        }
+    }
+
+    /// \brief returns the full convolution of \c lhs and \c rhs
+    ///
+    /// The type of each element is wide enough to hold the sum of products without overflow.
+    ///
+    /// \headerfile cnl/fir_filter.h
+    /// \sa cnl::fir_filter
+    template<typename Lhs, std::size_t LhsSize, typename Rhs, std::size_t RhsSize>
+    CNL_NODISCARD fixed_array<_impl::convolution_t<Lhs, Rhs, _impl::min(LhsSize, RhsSize)>, LhsSize+RhsSize-1>
+    convolve(fixed_array<Lhs, LhsSize> const& lhs, fixed_array<Rhs, RhsSize> const& rhs)
+    {
+        using result_type = fixed_array<_impl::convolution_t<Lhs, Rhs, _impl::min(LhsSize, RhsSize)>, LhsSize+RhsSize-1>;
+        auto result = result_type{};
+        _impl::convolve_accumulate(result.data(), lhs.data(), LhsSize, rhs.data(), RhsSize);
+        return result;
+    }
+
+    /// \brief returns the full convolution of \c lhs and \c rhs
+    ///
+    /// The type of each element is wide enough to hold the sum of up to 2^31 products without overflow.
+    /// If either operand is empty, the result is empty.
+    ///
+    /// \headerfile cnl/fir_filter.h
+    template<typename Lhs, typename Rhs>
+    CNL_NODISCARD fixed_vector<_impl::convolution_t<Lhs, Rhs, std::size_t{1} << 31>>
+    convolve(fixed_vector<Lhs> const& lhs, fixed_vector<Rhs> const& rhs)
+    {
+        using result_type = fixed_vector<_impl::convolution_t<Lhs, Rhs, std::size_t{1} << 31>>;
+        if (lhs.empty() || rhs.empty()) {
+            return result_type{};
+        }
+        auto result = result_type(lhs.size()+rhs.size()-1);
+        _impl::convolve_accumulate(result.data(), lhs.data(), lhs.size(), rhs.data(), rhs.size());
+        return result;
+    }
+
+    /// \brief returns the full two-dimensional convolution of \c lhs and \c rhs
+    ///
+    /// Each operand is an array of rows.
+    /// The type of each element is wide enough to hold the sum of products without overflow.
+    ///
+    /// \headerfile cnl/fir_filter.h
+    template<
+            typename Lhs, std::size_t LhsColumns, std::size_t LhsRows,
+            typename Rhs, std::size_t RhsColumns, std::size_t RhsRows>
+    CNL_NODISCARD fixed_array<
+            fixed_array<
+                    _impl::convolution_t<
+                            Lhs, Rhs, _impl::min(LhsRows, RhsRows)*_impl::min(LhsColumns, RhsColumns)>,
+                    LhsColumns+RhsColumns-1>,
+            LhsRows+RhsRows-1>
+    convolve(
+            fixed_array<fixed_array<Lhs, LhsColumns>, LhsRows> const& lhs,
+            fixed_array<fixed_array<Rhs, RhsColumns>, RhsRows> const& rhs)
+    {
+        using element_type = _impl::convolution_t<
+                Lhs, Rhs, _impl::min(LhsRows, RhsRows)*_impl::min(LhsColumns, RhsColumns)>;
+        using row_type = fixed_array<element_type, LhsColumns+RhsColumns-1>;
+        auto result = fixed_array<row_type, LhsRows+RhsRows-1>{};
+
+        for (std::size_t lhs_row = 0; lhs_row!=LhsRows; ++lhs_row) {
+            for (std::size_t rhs_row = 0; rhs_row!=RhsRows; ++rhs_row) {
+                _impl::convolve_accumulate(
+                        result[lhs_row+rhs_row].data(),
+                        lhs[lhs_row].data(), LhsColumns,
+                        rhs[rhs_row].data(), RhsColumns);
+            }
+        }
+        return result;
+    }
+}
+
+#endif  // CNL_IMPL_FIR_FILTER_CONVOLVE_H
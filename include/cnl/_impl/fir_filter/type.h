@@ -0,0 +1,109 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_FIR_FILTER_TYPE_H)
+#define CNL_IMPL_FIR_FILTER_TYPE_H
+
+#include "../config.h"
+#include "../exact_accumulator.h"
+#include "../fixed_array/type.h"
+#include "../operators/native_tag.h"
+#include "../operators/tagged.h"
+#include "../rounding/convert_operator.h"
+#include "../rounding/nearest_rounding_tag.h"
+
+#include <cstddef>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief finite impulse response filter with an accumulator that cannot overflow
+    ///
+    /// \tparam Sample the type of input and output samples, e.g. `scaled_integer<int16_t, power<-15>>`
+    /// \tparam Coeff the type of the filter coefficients
+    /// \tparam Taps the number of coefficients
+    /// \tparam RoundingTag the rounding applied when the sum of products is converted to \c Sample
+    ///
+    /// Each output is the sum of the products of the coefficients and the most recent \c Taps inputs.
+    /// The sum is held in \ref accumulator_type, whose digits are deduced in the same way as
+    /// \ref cnl::elastic_integer, and is rounded only once: when it is converted to the output sample.
+    ///
+    /// Past inputs are kept in a ring buffer in which each sample is written twice,
+    /// so that the most recent \c Taps inputs are always contiguous and the sum of products is a single loop.
+    ///
+    /// \headerfile cnl/fir_filter.h
+    /// \sa cnl::convolve
+    template<typename Sample, typename Coeff, std::size_t Taps, class RoundingTag = nearest_rounding_tag>
+    class fir_filter {
+        static_assert(Taps>0, "fir_filter must have at least one tap");
+    public:
+        using sample_type = Sample;
+        using coeff_type = Coeff;
+        using accumulator_type = _impl::exact_product_sum_t<Sample, Coeff, _impl::sum_headroom(Taps)>;
+
+        /// returns the number of coefficients
+        CNL_NODISCARD static constexpr std::size_t taps() noexcept
+        {
+            return Taps;
+        }
+
+        /// creates a filter with the given coefficients and a history of zeros
+        explicit fir_filter(fixed_array<Coeff, Taps> const& coefficients)
+                : _coefficients(coefficients), _history(), _position(0)
+        {
+        }
+
+        /// sets every past input to zero
+        void reset()
+        {
+            _history = fixed_array<Sample, Taps*2>{};
+            _position = 0;
+        }
+
+        /// consumes one input and returns the corresponding output
+        Sample operator()(Sample const& input)
+        {
+            push(input);
+            return convert<RoundingTag, _impl::native_tag, Sample>(accumulate());
+        }
+
+        /// consumes \c size inputs and writes the corresponding outputs
+        void process(Sample const* input, Sample* output, std::size_t size)
+        {
+            for (std::size_t index = 0; index!=size; ++index) {
+                output[index] = (*this)(input[index]);
+            }
+        }
+
+        /// consumes a block of inputs and returns the corresponding outputs
+        CNL_NODISCARD fixed_vector<Sample> process(fixed_vector<Sample> const& block)
+        {
+            auto output = fixed_vector<Sample>(block.size());
+            process(block.data(), output.data(), block.size());
+            return output;
+        }
+
+        /// returns the sum of the products of the coefficients and the most recent inputs before rounding
+        CNL_NODISCARD accumulator_type accumulate() const
+        {
+            return _impl::exact_dot<accumulator_type>(_history.data()+_position, _coefficients.data(), Taps);
+        }
+
+    private:
+        // after a push, _history[_position+tap] holds the input from tap samples ago
+        void push(Sample const& input)
+        {
+            _position = (_position==0 ? Taps : _position)-1;
+            _history[_position] = input;
+            _history[_position+Taps] = input;
+        }
+
+        fixed_array<Coeff, Taps> _coefficients;
+        fixed_array<Sample, Taps*2> _history;
+        std::size_t _position;
+    };
+}
+
+#endif  // CNL_IMPL_FIR_FILTER_TYPE_H
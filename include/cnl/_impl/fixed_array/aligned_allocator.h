@@ -0,0 +1,102 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_FIXED_ARRAY_ALIGNED_ALLOCATOR_H)
+#define CNL_IMPL_FIXED_ARRAY_ALIGNED_ALLOCATOR_H
+
+#include "../common.h"
+#include "../config.h"
+#include "../terminate.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fixed_array_alignment
+
+        // alignment of the elements of fixed_vector and the greatest alignment of fixed_array;
+        // wide enough for the widest vector registers and for a cache line
+        constexpr std::size_t fixed_array_alignment = 64;
+
+        // alignment of a fixed_array of N elements of type, T: the greatest power of two which divides its size,
+        // so that padding never makes it larger than T[N], up to fixed_array_alignment
+        template<typename T, std::size_t N>
+        CNL_NODISCARD constexpr std::size_t fixed_array_alignment_of()
+        {
+            return _impl::max(
+                    alignof(T),
+                    _impl::min(fixed_array_alignment, (sizeof(T)*N) & (~(sizeof(T)*N)+1)));
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::aligned_allocator
+
+        // allocator whose blocks begin on an Alignment-byte boundary;
+        // over-allocates and stores the address of the underlying block immediately before the aligned block
+        template<typename T, std::size_t Alignment>
+        class aligned_allocator {
+            static_assert(Alignment>=alignof(void*) && (Alignment & (Alignment-1))==0,
+                    "Alignment must be a power of two no smaller than that of a pointer");
+        public:
+            using value_type = T;
+
+            template<typename U>
+            struct rebind {
+                using other = aligned_allocator<U, Alignment>;
+            };
+
+            aligned_allocator() = default;
+
+            template<typename U>
+            aligned_allocator(aligned_allocator<U, Alignment> const&) noexcept  // NOLINT(hicpp-explicit-conversions, google-explicit-constructor)
+            {
+            }
+
+            CNL_NODISCARD T* allocate(std::size_t n) const
+            {
+                if (n>(std::numeric_limits<std::size_t>::max()-Alignment-sizeof(void*))/sizeof(T)) {
+#if defined(CNL_EXCEPTIONS_ENABLED)
+                    throw std::bad_array_new_length();
+#else
+                    return _impl::terminate<T*>("aligned_allocator: allocation size exceeds the address space");
+#endif
+                }
+
+                void* const block = ::operator new(n*sizeof(T)+Alignment+sizeof(void*));
+                auto const address = (reinterpret_cast<std::uintptr_t>(block)+sizeof(void*)+Alignment-1)
+                        & ~std::uintptr_t{Alignment-1};
+                reinterpret_cast<void**>(address)[-1] = block;
+                return reinterpret_cast<T*>(address);
+            }
+
+            void deallocate(T* p, std::size_t) const noexcept
+            {
+                ::operator delete(reinterpret_cast<void**>(p)[-1]);
+            }
+        };
+
+        template<typename T, typename U, std::size_t Alignment>
+        CNL_NODISCARD constexpr bool operator==(
+                aligned_allocator<T, Alignment> const&, aligned_allocator<U, Alignment> const&) noexcept
+        {
+            return true;
+        }
+
+        template<typename T, typename U, std::size_t Alignment>
+        CNL_NODISCARD constexpr bool operator!=(
+                aligned_allocator<T, Alignment> const&, aligned_allocator<U, Alignment> const&) noexcept
+        {
+            return false;
+        }
+    }
+}
+
+#endif  // CNL_IMPL_FIXED_ARRAY_ALIGNED_ALLOCATOR_H
@@ -0,0 +1,21 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_FIXED_ARRAY_FORWARD_DECLARATION_H)
+#define CNL_IMPL_FIXED_ARRAY_FORWARD_DECLARATION_H
+
+#include <cstddef>
+
+/// compositional numeric library
+namespace cnl {
+    template<typename T, std::size_t N>
+    struct fixed_array;
+
+    template<typename T>
+    class fixed_vector;
+}
+
+#endif  // CNL_IMPL_FIXED_ARRAY_FORWARD_DECLARATION_H
@@ -0,0 +1,66 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_FIXED_ARRAY_IS_FIXED_CONTAINER_H)
+#define CNL_IMPL_FIXED_ARRAY_IS_FIXED_CONTAINER_H
+
+#include "../config.h"
+#include "forward_declaration.h"
+
+#include <cstddef>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::is_fixed_container
+
+        template<class T>
+        struct is_fixed_container : std::false_type {
+        };
+
+        template<typename T, std::size_t N>
+        struct is_fixed_container<fixed_array<T, N>> : std::true_type {
+        };
+
+        template<typename T>
+        struct is_fixed_container<fixed_vector<T>> : std::true_type {
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::rebind_fixed_container
+
+        // container of the same kind and size as Container whose elements are of type U
+        template<class Container, typename U>
+        struct rebind_fixed_container;
+
+        template<typename T, std::size_t N, typename U>
+        struct rebind_fixed_container<fixed_array<T, N>, U> {
+            using type = fixed_array<U, N>;
+
+            CNL_NODISCARD static type make(std::size_t)
+            {
+                return type{};
+            }
+        };
+
+        template<typename T, typename U>
+        struct rebind_fixed_container<fixed_vector<T>, U> {
+            using type = fixed_vector<U>;
+
+            CNL_NODISCARD static type make(std::size_t size)
+            {
+                return type(size);
+            }
+        };
+
+        template<class Container, typename U>
+        using rebind_fixed_container_t = typename rebind_fixed_container<Container, U>::type;
+    }
+}
+
+#endif  // CNL_IMPL_FIXED_ARRAY_IS_FIXED_CONTAINER_H
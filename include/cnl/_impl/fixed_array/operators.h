@@ -0,0 +1,254 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_FIXED_ARRAY_OPERATORS_H)
+#define CNL_IMPL_FIXED_ARRAY_OPERATORS_H
+
+#include "../config.h"
+#include "../operators/operators.h"
+#include "../throw_exception.h"
+#include "../type_traits/enable_if.h"
+#include "is_fixed_container.h"
+#include "type.h"
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fixed_operand
+
+        // a scalar operand is broadcast to every element
+        template<class Operand, class Enable = void>
+        struct fixed_operand {
+            using value_type = Operand;
+
+            CNL_NODISCARD static Operand const& element(Operand const& operand, std::size_t)
+            {
+                return operand;
+            }
+
+            CNL_NODISCARD static std::size_t size(Operand const&, std::size_t other_size)
+            {
+                return other_size;
+            }
+        };
+
+        template<class Container>
+        struct fixed_operand<Container, enable_if_t<is_fixed_container<Container>::value>> {
+            using value_type = typename Container::value_type;
+
+            CNL_NODISCARD static value_type const& element(Container const& container, std::size_t index)
+            {
+                return container[index];
+            }
+
+            CNL_NODISCARD static std::size_t size(Container const& container, std::size_t)
+            {
+                return container.size();
+            }
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::are_fixed_operands
+
+        // true iff Lhs and Rhs are containers of the same kind and size
+        template<class Lhs, class Rhs>
+        struct are_same_fixed_containers : std::false_type {
+        };
+
+        template<typename LhsT, typename RhsT, std::size_t N>
+        struct are_same_fixed_containers<fixed_array<LhsT, N>, fixed_array<RhsT, N>> : std::true_type {
+        };
+
+        template<typename LhsT, typename RhsT>
+        struct are_same_fixed_containers<fixed_vector<LhsT>, fixed_vector<RhsT>> : std::true_type {
+        };
+
+        // true iff Lhs and Rhs are containers of the same kind or a container and a scalar
+        template<class Lhs, class Rhs>
+        struct are_fixed_operands : std::integral_constant<bool,
+                are_same_fixed_containers<Lhs, Rhs>::value
+                        || is_fixed_container<Lhs>::value!=is_fixed_container<Rhs>::value> {
+        };
+
+        // number of elements in the result of an operation upon lhs and rhs;
+        // fixed_vector operands of different sizes are an error, even in release builds
+        template<class Lhs, class Rhs>
+        CNL_NODISCARD std::size_t fixed_operands_size(Lhs const& lhs, Rhs const& rhs)
+        {
+            auto const size = fixed_operand<Lhs>::size(lhs, fixed_operand<Rhs>::size(rhs, 0));
+            return (fixed_operand<Rhs>::size(rhs, size)==size)
+                   ? size
+                   : throw_exception<std::size_t, std::length_error>("fixed_vector operands differ in size");
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fixed_unary_operator
+
+        // The operator is defined only where the operation upon the elements is well-formed
+        // so that other operands are a substitution failure of the free operators.
+        template<class Operator, class Container, class Enable = void>
+        struct fixed_unary_operator {
+        };
+
+        template<class Operator, class Container>
+        struct fixed_unary_operator<
+                Operator, Container,
+                enable_if_t<
+                        is_fixed_container<Container>::value,
+                        decltype(void(Operator{}(std::declval<typename Container::value_type>())))>> {
+            using element_type = decltype(Operator{}(std::declval<typename Container::value_type>()));
+            using result_type = rebind_fixed_container_t<Container, element_type>;
+
+            CNL_NODISCARD result_type operator()(Container const& rhs) const
+            {
+                auto const size = rhs.size();
+                auto result = rebind_fixed_container<Container, element_type>::make(size);
+                auto* const out = result.data();
+                auto const* const in = rhs.data();
+                for (std::size_t index = 0; index!=size; ++index) {
+                    out[index] = Operator{}(in[index]);
+                }
+                return result;
+            }
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fixed_binary_operator
+
+        // The type of each element of the result is that of the scalar operation,
+        // e.g. the scale of the sum of two scaled_integer elements is determined at compile time.
+        template<class Operator, class Lhs, class Rhs, class Enable = void>
+        struct fixed_binary_operator {
+        };
+
+        template<class Operator, class Lhs, class Rhs>
+        struct fixed_binary_operator<
+                Operator, Lhs, Rhs,
+                enable_if_t<
+                        are_fixed_operands<Lhs, Rhs>::value,
+                        decltype(void(Operator{}(
+                                std::declval<typename fixed_operand<Lhs>::value_type>(),
+                                std::declval<typename fixed_operand<Rhs>::value_type>())))>> {
+            using container = typename std::conditional<is_fixed_container<Lhs>::value, Lhs, Rhs>::type;
+            using element_type = decltype(Operator{}(
+                    std::declval<typename fixed_operand<Lhs>::value_type>(),
+                    std::declval<typename fixed_operand<Rhs>::value_type>()));
+            using result_type = rebind_fixed_container_t<container, element_type>;
+
+            CNL_NODISCARD result_type operator()(Lhs const& lhs, Rhs const& rhs) const
+            {
+                auto const size = fixed_operands_size(lhs, rhs);
+                auto result = rebind_fixed_container<container, element_type>::make(size);
+                auto* const out = result.data();
+                for (std::size_t index = 0; index!=size; ++index) {
+                    out[index] = Operator{}(
+                            fixed_operand<Lhs>::element(lhs, index),
+                            fixed_operand<Rhs>::element(rhs, index));
+                }
+                return result;
+            }
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fixed_compound_assignment_operator
+
+        template<class Operator, class Lhs, class Rhs, class Enable = void>
+        struct fixed_compound_assignment_operator {
+        };
+
+        template<class Operator, class Lhs, class Rhs>
+        struct fixed_compound_assignment_operator<
+                Operator, Lhs, Rhs,
+                enable_if_t<
+                        is_fixed_container<Lhs>::value && are_fixed_operands<Lhs, Rhs>::value,
+                        decltype(void(Operator{}(
+                                std::declval<typename Lhs::value_type&>(),
+                                std::declval<typename fixed_operand<Rhs>::value_type>())))>> {
+            Lhs& operator()(Lhs& lhs, Rhs const& rhs) const
+            {
+                auto const size = fixed_operands_size(lhs, rhs);
+                auto* const out = lhs.data();
+                for (std::size_t index = 0; index!=size; ++index) {
+                    Operator{}(out[index], fixed_operand<Rhs>::element(rhs, index));
+                }
+                return lhs;
+            }
+        };
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // element-wise operators
+
+    template<class Container, _impl::enable_if_t<_impl::is_fixed_container<Container>::value, int> = 0>
+    CNL_NODISCARD auto operator-(Container const& rhs)
+    -> decltype(_impl::fixed_unary_operator<_impl::minus_op, Container>{}(rhs))
+    {
+        return _impl::fixed_unary_operator<_impl::minus_op, Container>{}(rhs);
+    }
+
+    template<class Container, _impl::enable_if_t<_impl::is_fixed_container<Container>::value, int> = 0>
+    CNL_NODISCARD auto operator+(Container const& rhs)
+    -> decltype(_impl::fixed_unary_operator<_impl::plus_op, Container>{}(rhs))
+    {
+        return _impl::fixed_unary_operator<_impl::plus_op, Container>{}(rhs);
+    }
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define CNL_IMPL_FIXED_ARRAY_BINARY_OPERATOR(OP, NAME) \
+    template<class Lhs, class Rhs, _impl::enable_if_t<_impl::are_fixed_operands<Lhs, Rhs>::value, int> = 0> \
+    CNL_NODISCARD auto operator OP(Lhs const& lhs, Rhs const& rhs) \
+    -> decltype(_impl::fixed_binary_operator<_impl::NAME, Lhs, Rhs>{}(lhs, rhs)) \
+    { \
+        return _impl::fixed_binary_operator<_impl::NAME, Lhs, Rhs>{}(lhs, rhs); \
+    }
+
+    CNL_IMPL_FIXED_ARRAY_BINARY_OPERATOR(+, add_op)
+
+    CNL_IMPL_FIXED_ARRAY_BINARY_OPERATOR(-, subtract_op)
+
+    CNL_IMPL_FIXED_ARRAY_BINARY_OPERATOR(*, multiply_op)
+
+    CNL_IMPL_FIXED_ARRAY_BINARY_OPERATOR(/, divide_op)
+
+    CNL_IMPL_FIXED_ARRAY_BINARY_OPERATOR(<<, shift_left_op)
+
+    CNL_IMPL_FIXED_ARRAY_BINARY_OPERATOR(>>, shift_right_op)
+
+#undef CNL_IMPL_FIXED_ARRAY_BINARY_OPERATOR
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define CNL_IMPL_FIXED_ARRAY_COMPOUND_ASSIGNMENT_OPERATOR(OP, NAME) \
+    template<class Lhs, class Rhs, \
+            _impl::enable_if_t<_impl::is_fixed_container<Lhs>::value && _impl::are_fixed_operands<Lhs, Rhs>::value, \
+                    int> = 0> \
+    auto operator OP(Lhs& lhs, Rhs const& rhs) \
+    -> decltype(_impl::fixed_compound_assignment_operator<_impl::NAME, Lhs, Rhs>{}(lhs, rhs)) \
+    { \
+        return _impl::fixed_compound_assignment_operator<_impl::NAME, Lhs, Rhs>{}(lhs, rhs); \
+    }
+
+    CNL_IMPL_FIXED_ARRAY_COMPOUND_ASSIGNMENT_OPERATOR(+=, assign_add_op)
+
+    CNL_IMPL_FIXED_ARRAY_COMPOUND_ASSIGNMENT_OPERATOR(-=, assign_subtract_op)
+
+    CNL_IMPL_FIXED_ARRAY_COMPOUND_ASSIGNMENT_OPERATOR(*=, assign_multiply_op)
+
+    CNL_IMPL_FIXED_ARRAY_COMPOUND_ASSIGNMENT_OPERATOR(/=, assign_divide_op)
+
+    CNL_IMPL_FIXED_ARRAY_COMPOUND_ASSIGNMENT_OPERATOR(<<=, assign_shift_left_op)
+
+    CNL_IMPL_FIXED_ARRAY_COMPOUND_ASSIGNMENT_OPERATOR(>>=, assign_shift_right_op)
+
+#undef CNL_IMPL_FIXED_ARRAY_COMPOUND_ASSIGNMENT_OPERATOR
+}
+
+#endif  // CNL_IMPL_FIXED_ARRAY_OPERATORS_H
@@ -0,0 +1,97 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_FIXED_ARRAY_REDUCE_H)
+#define CNL_IMPL_FIXED_ARRAY_REDUCE_H
+
+#include "../config.h"
+#include "../exact_accumulator.h"
+#include "../num_traits/digits.h"
+#include "../throw_exception.h"
+#include "../type_traits/enable_if.h"
+#include "is_fixed_container.h"
+#include "type.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fixed_reduction_headroom
+
+        // number of digits by which a value must be widened to hold the sum of every element of Container
+        template<class Container>
+        struct fixed_reduction_headroom;
+
+        template<typename T, std::size_t N>
+        struct fixed_reduction_headroom<fixed_array<T, N>>
+                : std::integral_constant<int, sum_headroom(N)> {
+        };
+
+        // enough for 2^31 elements
+        template<typename T>
+        struct fixed_reduction_headroom<fixed_vector<T>>
+                : std::integral_constant<int, digits<std::int32_t>::value> {
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fixed_accumulator_t
+
+        // type of T widened by the headroom of Container
+        template<typename T, class Container>
+        using fixed_accumulator_t = exact_sum_t<T, fixed_reduction_headroom<Container>::value>;
+    }
+
+    /// \brief returns the sum of every element of \c container
+    ///
+    /// The result is widened so that it does not overflow, e.g. the sum of a
+    /// `fixed_array<scaled_integer<int16_t, power<-8>>, 4>` is a `scaled_integer<int32_t, power<-8>>`.
+    /// Where the widest fundamental integer is too narrow, the result is composed of a \ref wide_integer.
+    ///
+    /// \headerfile cnl/fixed_array.h
+    template<class Container>
+    CNL_NODISCARD auto sum(Container const& container)
+    -> _impl::enable_if_t<
+            _impl::is_fixed_container<Container>::value,
+            _impl::fixed_accumulator_t<typename Container::value_type, Container>>
+    {
+        using accumulator = _impl::fixed_accumulator_t<typename Container::value_type, Container>;
+        auto total = accumulator{};
+        for (auto const& element : container) {
+            total = static_cast<accumulator>(total+static_cast<accumulator>(element));
+        }
+        return total;
+    }
+
+    /// \brief returns the sum of the products of the corresponding elements of \c lhs and \c rhs
+    ///
+    /// The result has the scale of the product of two elements and is widened so that it does not overflow.
+    /// Operands of different sizes throw \c std::length_error.
+    ///
+    /// \headerfile cnl/fixed_array.h
+    template<class Lhs, class Rhs>
+    CNL_NODISCARD auto dot(Lhs const& lhs, Rhs const& rhs)
+    -> _impl::enable_if_t<
+            _impl::is_fixed_container<Lhs>::value && _impl::is_fixed_container<Rhs>::value,
+            _impl::exact_product_sum_t<
+                    typename Lhs::value_type, typename Rhs::value_type,
+                    _impl::fixed_reduction_headroom<Lhs>::value>>
+    {
+        using accumulator = _impl::exact_product_sum_t<
+                typename Lhs::value_type, typename Rhs::value_type,
+                _impl::fixed_reduction_headroom<Lhs>::value>;
+
+        return (lhs.size()==rhs.size())
+               ? _impl::exact_dot<accumulator>(lhs.data(), rhs.data(), lhs.size())
+               : _impl::throw_exception<accumulator, std::length_error>("dot: operands differ in size");
+    }
+}
+
+#endif  // CNL_IMPL_FIXED_ARRAY_REDUCE_H
@@ -0,0 +1,198 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_FIXED_ARRAY_TYPE_H)
+#define CNL_IMPL_FIXED_ARRAY_TYPE_H
+
+#include "../config.h"
+#include "aligned_allocator.h"
+#include "forward_declaration.h"
+
+#include <cstddef>
+#include <initializer_list>
+#include <vector>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief fixed-size, aligned array of numbers which are operated upon element-wise
+    ///
+    /// \tparam T the type of each element, e.g. \ref cnl::scaled_integer
+    /// \tparam N the number of elements
+    ///
+    /// Like `std::array`, `fixed_array` is an aggregate. Unlike `std::array`,
+    /// its elements are aligned for efficient loading into vector registers
+    /// and arithmetic operators apply to corresponding elements.
+    ///
+    /// The alignment is the greatest power of two, up to 64 bytes, which divides the size of the array,
+    /// so a `fixed_array` occupies no more memory than `T[N]`.
+    ///
+    /// \headerfile cnl/fixed_array.h
+    /// \sa cnl::fixed_vector, cnl::sum, cnl::dot
+    template<typename T, std::size_t N>
+    struct alignas(_impl::fixed_array_alignment_of<T, N>()) fixed_array {
+        static_assert(N>0, "fixed_array must have at least one element");
+
+        using value_type = T;
+        using size_type = std::size_t;
+        using iterator = T*;
+        using const_iterator = T const*;
+
+        /// returns the number of elements
+        CNL_NODISCARD static constexpr size_type size() noexcept
+        {
+            return N;
+        }
+
+        CNL_NODISCARD T* data() noexcept
+        {
+            return _elements;
+        }
+
+        CNL_NODISCARD T const* data() const noexcept
+        {
+            return _elements;
+        }
+
+        CNL_NODISCARD iterator begin() noexcept
+        {
+            return _elements;
+        }
+
+        CNL_NODISCARD const_iterator begin() const noexcept
+        {
+            return _elements;
+        }
+
+        CNL_NODISCARD iterator end() noexcept
+        {
+            return _elements+N;
+        }
+
+        CNL_NODISCARD const_iterator end() const noexcept
+        {
+            return _elements+N;
+        }
+
+        CNL_NODISCARD T& operator[](size_type index) noexcept
+        {
+            return _elements[index];
+        }
+
+        CNL_NODISCARD constexpr T const& operator[](size_type index) const noexcept
+        {
+            return _elements[index];
+        }
+
+        // public to allow aggregate initialization
+        T _elements[N];  // NOLINT(cppcoreguidelines-avoid-c-arrays,misc-non-private-member-variables-in-classes)
+    };
+
+    /// \brief variable-size, aligned array of numbers which are operated upon element-wise
+    ///
+    /// \tparam T the type of each element, e.g. \ref cnl::scaled_integer
+    ///
+    /// Elements are stored contiguously in a block aligned for efficient loading into vector registers.
+    /// Arithmetic operators apply to corresponding elements of operands of equal size;
+    /// operands of different sizes throw \c std::length_error.
+    ///
+    /// \headerfile cnl/fixed_array.h
+    /// \sa cnl::fixed_array, cnl::sum, cnl::dot
+    template<typename T>
+    class fixed_vector {
+        using storage_type = std::vector<T, _impl::aligned_allocator<T, _impl::fixed_array_alignment>>;
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using iterator = typename storage_type::iterator;
+        using const_iterator = typename storage_type::const_iterator;
+
+        fixed_vector() = default;
+
+        /// creates \c size value-initialized elements
+        explicit fixed_vector(size_type size)
+                : _elements(size)
+        {
+        }
+
+        /// creates \c size copies of \c value
+        fixed_vector(size_type size, T const& value)
+                : _elements(size, value)
+        {
+        }
+
+        fixed_vector(std::initializer_list<T> init)
+                : _elements(init)
+        {
+        }
+
+        template<class InputIt>
+        fixed_vector(InputIt first, InputIt last)
+                : _elements(first, last)
+        {
+        }
+
+        /// returns the number of elements
+        CNL_NODISCARD size_type size() const noexcept
+        {
+            return _elements.size();
+        }
+
+        CNL_NODISCARD bool empty() const noexcept
+        {
+            return _elements.empty();
+        }
+
+        void resize(size_type size)
+        {
+            _elements.resize(size);
+        }
+
+        CNL_NODISCARD T* data() noexcept
+        {
+            return _elements.data();
+        }
+
+        CNL_NODISCARD T const* data() const noexcept
+        {
+            return _elements.data();
+        }
+
+        CNL_NODISCARD iterator begin() noexcept
+        {
+            return _elements.begin();
+        }
+
+        CNL_NODISCARD const_iterator begin() const noexcept
+        {
+            return _elements.begin();
+        }
+
+        CNL_NODISCARD iterator end() noexcept
+        {
+            return _elements.end();
+        }
+
+        CNL_NODISCARD const_iterator end() const noexcept
+        {
+            return _elements.end();
+        }
+
+        CNL_NODISCARD T& operator[](size_type index) noexcept
+        {
+            return _elements[index];
+        }
+
+        CNL_NODISCARD T const& operator[](size_type index) const noexcept
+        {
+            return _elements[index];
+        }
+
+    private:
+        storage_type _elements;
+    };
+}
+
+#endif  // CNL_IMPL_FIXED_ARRAY_TYPE_H
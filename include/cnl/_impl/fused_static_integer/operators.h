@@ -0,0 +1,322 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_FUSED_STATIC_INTEGER_OPERATORS_H)
+#define CNL_IMPL_FUSED_STATIC_INTEGER_OPERATORS_H
+
+#include "../../constant.h"
+#include "../common.h"
+#include "../config.h"
+#include "../elastic_tag/policy.h"
+#include "../num_traits/from_rep.h"
+#include "../num_traits/to_rep.h"
+#include "../operators/generic.h"
+#include "../operators/operators.h"
+#include "../type_traits/enable_if.h"
+#include "../type_traits/is_integral.h"
+#include "../type_traits/is_signed.h"
+#include "../type_traits/remove_signedness.h"
+#include "../type_traits/set_signedness.h"
+#include "../used_digits.h"
+#include "type.h"
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fused_operand_t
+
+        // the fused_static_integer as which an integer or constant operand is treated, as by static_integer
+        template<typename Operand, class RoundingTag, class OverflowTag, class Narrowest>
+        struct fused_operand {
+            using type = fused_static_integer<numeric_limits<Operand>::digits, RoundingTag, OverflowTag, Narrowest>;
+        };
+
+        template<CNL_IMPL_CONSTANT_VALUE_TYPE Value, class RoundingTag, class OverflowTag, class Narrowest>
+        struct fused_operand<constant<Value>, RoundingTag, OverflowTag, Narrowest> {
+            using type = fused_static_integer<max(1, fused_digits(Value)), RoundingTag, OverflowTag, Narrowest>;
+        };
+
+        template<typename Operand, class RoundingTag, class OverflowTag, class Narrowest>
+        using fused_operand_t = typename fused_operand<Operand, RoundingTag, OverflowTag, Narrowest>::type;
+
+        template<typename Operand>
+        struct is_fused_operand
+                : std::integral_constant<bool, is_integral<Operand>::value || is_constant<Operand>::value> {
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fused_binary_operator
+
+        // applies Operator to the reps of two fused_static_integers in a type which holds both operands
+        // and the result; the result has the digits and signedness given by the elastic policy
+        // and so cannot overflow, e.g. the difference of two unsigned values is signed;
+        // RoundingTag determines the rounding of division
+        template<class Operator, int LhsDigits, int RhsDigits, class RoundingTag, class OverflowTag, class Narrowest>
+        struct fused_binary_operator {
+            using result_policy = policy<
+                    Operator, LhsDigits, is_signed<Narrowest>::value, RhsDigits, is_signed<Narrowest>::value>;
+            static constexpr int digits = result_policy::digits;
+            using result_narrowest = set_signedness_t<Narrowest, result_policy::is_signed>;
+            using result_type = fused_static_integer<digits, RoundingTag, OverflowTag, result_narrowest>;
+            using wide = fused_rep_t<max(digits, max(LhsDigits, RhsDigits)), result_narrowest>;
+
+            CNL_NODISCARD constexpr result_type operator()(
+                    fused_static_integer<LhsDigits, RoundingTag, OverflowTag, Narrowest> const& lhs,
+                    fused_static_integer<RhsDigits, RoundingTag, OverflowTag, Narrowest> const& rhs) const
+            {
+                return _impl::from_rep<result_type>(binary_operator<Operator, RoundingTag, RoundingTag, wide, wide>{}(
+                        static_cast<wide>(_impl::to_rep(lhs)), static_cast<wide>(_impl::to_rep(rhs))));
+            }
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fused_shift_left
+
+        // shifts rep left without the undefined behavior of shifting a negative value
+        template<typename Rep>
+        CNL_NODISCARD constexpr Rep fused_shift_left(Rep const& rep, int amount)
+        {
+            return static_cast<Rep>(static_cast<remove_signedness_t<Rep>>(rep) << amount);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fused_shift_max
+
+        // greatest value of a static_integer with Digits digits which can be shifted left by amount without overflow;
+        // zero if amount is no less than Digits, in which case shifting fused_max right would be undefined
+        template<typename Rep, int Digits>
+        CNL_NODISCARD constexpr Rep fused_shift_max(int amount)
+        {
+            return (amount<Digits) ? static_cast<Rep>(fused_max<Rep, Digits>() >> amount) : Rep{0};
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // unary operators
+
+    template<int Digits, class RoundingTag, class OverflowTag, class Narrowest>
+    CNL_NODISCARD constexpr fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest> operator+(
+            fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest> const& operand)
+    {
+        return operand;
+    }
+
+    // as with elastic_integer, the negative of an unsigned value is signed
+    template<int Digits, class RoundingTag, class OverflowTag, class Narrowest>
+    CNL_NODISCARD constexpr auto operator-(
+            fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest> const& operand)
+    -> fused_static_integer<Digits, RoundingTag, OverflowTag, _impl::set_signedness_t<Narrowest, true>>
+    {
+        using result_type = fused_static_integer<
+                Digits, RoundingTag, OverflowTag, _impl::set_signedness_t<Narrowest, true>>;
+        using result_rep = typename result_type::rep;
+        return _impl::from_rep<result_type>(static_cast<result_rep>(-static_cast<result_rep>(_impl::to_rep(operand))));
+    }
+
+    template<int Digits, class RoundingTag, class OverflowTag, class Narrowest>
+    CNL_NODISCARD constexpr fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest> operator~(
+            fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest> const& operand)
+    {
+        return _impl::from_rep<fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest>>(
+                ~_impl::to_rep(operand));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // binary arithmetic operators
+
+#define CNL_IMPL_FUSED_STATIC_INTEGER_BINARY_OPERATOR(OP, NAME) \
+    template<int LhsDigits, int RhsDigits, class RoundingTag, class OverflowTag, class Narrowest> \
+    CNL_NODISCARD constexpr auto operator OP( \
+            fused_static_integer<LhsDigits, RoundingTag, OverflowTag, Narrowest> const& lhs, \
+            fused_static_integer<RhsDigits, RoundingTag, OverflowTag, Narrowest> const& rhs) \
+    -> typename _impl::fused_binary_operator< \
+            _impl::NAME, LhsDigits, RhsDigits, RoundingTag, OverflowTag, Narrowest>::result_type \
+    { \
+        return _impl::fused_binary_operator< \
+                _impl::NAME, LhsDigits, RhsDigits, RoundingTag, OverflowTag, Narrowest>{}(lhs, rhs); \
+    } \
+    \
+    template<int LhsDigits, class RoundingTag, class OverflowTag, class Narrowest, typename Rhs, \
+            _impl::enable_if_t<_impl::is_fused_operand<Rhs>::value, int> = 0> \
+    CNL_NODISCARD constexpr auto operator OP( \
+            fused_static_integer<LhsDigits, RoundingTag, OverflowTag, Narrowest> const& lhs, Rhs const& rhs) \
+    -> decltype(lhs OP _impl::fused_operand_t<Rhs, RoundingTag, OverflowTag, Narrowest>(rhs)) \
+    { \
+        return lhs OP _impl::fused_operand_t<Rhs, RoundingTag, OverflowTag, Narrowest>(rhs); \
+    } \
+    \
+    template<typename Lhs, int RhsDigits, class RoundingTag, class OverflowTag, class Narrowest, \
+            _impl::enable_if_t<_impl::is_fused_operand<Lhs>::value, int> = 0> \
+    CNL_NODISCARD constexpr auto operator OP( \
+            Lhs const& lhs, fused_static_integer<RhsDigits, RoundingTag, OverflowTag, Narrowest> const& rhs) \
+    -> decltype(_impl::fused_operand_t<Lhs, RoundingTag, OverflowTag, Narrowest>(lhs) OP rhs) \
+    { \
+        return _impl::fused_operand_t<Lhs, RoundingTag, OverflowTag, Narrowest>(lhs) OP rhs; \
+    } \
+    \
+    template<int LhsDigits, class RoundingTag, class OverflowTag, class Narrowest, typename Rhs> \
+    CNL_RELAXED_CONSTEXPR auto operator OP##=( \
+            fused_static_integer<LhsDigits, RoundingTag, OverflowTag, Narrowest>& lhs, Rhs const& rhs) \
+    -> decltype(lhs = lhs OP rhs) \
+    { \
+        return lhs = lhs OP rhs; \
+    }
+
+    CNL_IMPL_FUSED_STATIC_INTEGER_BINARY_OPERATOR(+, add_op)
+
+    CNL_IMPL_FUSED_STATIC_INTEGER_BINARY_OPERATOR(-, subtract_op)
+
+    CNL_IMPL_FUSED_STATIC_INTEGER_BINARY_OPERATOR(*, multiply_op)
+
+    CNL_IMPL_FUSED_STATIC_INTEGER_BINARY_OPERATOR(/, divide_op)
+
+    CNL_IMPL_FUSED_STATIC_INTEGER_BINARY_OPERATOR(%, modulo_op)
+
+    CNL_IMPL_FUSED_STATIC_INTEGER_BINARY_OPERATOR(&, bitwise_and_op)
+
+    CNL_IMPL_FUSED_STATIC_INTEGER_BINARY_OPERATOR(|, bitwise_or_op)
+
+    CNL_IMPL_FUSED_STATIC_INTEGER_BINARY_OPERATOR(^, bitwise_xor_op)
+
+#undef CNL_IMPL_FUSED_STATIC_INTEGER_BINARY_OPERATOR
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // increment and decrement operators
+
+    template<int Digits, class RoundingTag, class OverflowTag, class Narrowest>
+    CNL_RELAXED_CONSTEXPR fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest>& operator++(
+            fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest>& operand)
+    {
+        return operand += constant<1>{};
+    }
+
+    template<int Digits, class RoundingTag, class OverflowTag, class Narrowest>
+    CNL_RELAXED_CONSTEXPR fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest>& operator--(
+            fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest>& operand)
+    {
+        return operand -= constant<1>{};
+    }
+
+    template<int Digits, class RoundingTag, class OverflowTag, class Narrowest>
+    CNL_RELAXED_CONSTEXPR fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest> operator++(
+            fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest>& operand, int)
+    {
+        auto const copy = operand;
+        ++operand;
+        return copy;
+    }
+
+    template<int Digits, class RoundingTag, class OverflowTag, class Narrowest>
+    CNL_RELAXED_CONSTEXPR fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest> operator--(
+            fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest>& operand, int)
+    {
+        auto const copy = operand;
+        --operand;
+        return copy;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // shift operators
+
+    // shifting by a constant changes the number of digits; arithmetic shift right rounds toward negative infinity
+    template<int Digits, class RoundingTag, class OverflowTag, class Narrowest, CNL_IMPL_CONSTANT_VALUE_TYPE Value>
+    CNL_NODISCARD constexpr auto operator<<(
+            fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest> const& lhs, constant<Value>)
+    -> fused_static_integer<Digits+int(Value), RoundingTag, OverflowTag, Narrowest>
+    {
+        using result_type = fused_static_integer<Digits+int(Value), RoundingTag, OverflowTag, Narrowest>;
+        return _impl::from_rep<result_type>(_impl::fused_shift_left(
+                static_cast<typename result_type::rep>(_impl::to_rep(lhs)), int(Value)));
+    }
+
+    template<int Digits, class RoundingTag, class OverflowTag, class Narrowest, CNL_IMPL_CONSTANT_VALUE_TYPE Value>
+    CNL_NODISCARD constexpr auto operator>>(
+            fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest> const& lhs, constant<Value>)
+    -> fused_static_integer<Digits-int(Value), RoundingTag, OverflowTag, Narrowest>
+    {
+        return _impl::from_rep<fused_static_integer<Digits-int(Value), RoundingTag, OverflowTag, Narrowest>>(
+                _impl::to_rep(lhs) >> int(Value));
+    }
+
+    // shifting by a variable preserves the number of digits; shifting left checks for overflow
+    template<int Digits, class RoundingTag, class OverflowTag, class Narrowest, typename Rhs>
+    CNL_NODISCARD constexpr auto operator<<(
+            fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest> const& lhs, Rhs const& rhs)
+    -> _impl::enable_if_t<
+            _impl::is_integral<Rhs>::value,
+            fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest>>
+    {
+        using rep = typename fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest>::rep;
+        return _impl::from_rep<fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest>>(
+                (_impl::to_rep(lhs)>_impl::fused_shift_max<rep, Digits>(int(rhs)))
+                ? _impl::fused_overflow<OverflowTag, _impl::polarity::positive>{}(
+                        _impl::fused_max<rep, Digits>(), _impl::to_rep(lhs))
+                : (numeric_limits<rep>::is_signed
+                        && _impl::to_rep(lhs)<static_cast<rep>(-_impl::fused_shift_max<rep, Digits>(int(rhs))))
+                  ? _impl::fused_overflow<OverflowTag, _impl::polarity::negative>{}(
+                          _impl::fused_lowest<rep, Digits>(), _impl::to_rep(lhs))
+                  : (int(rhs)<Digits)
+                    ? _impl::fused_shift_left(_impl::to_rep(lhs), int(rhs))
+                    : rep{0});
+    }
+
+    template<int Digits, class RoundingTag, class OverflowTag, class Narrowest, typename Rhs>
+    CNL_NODISCARD constexpr auto operator>>(
+            fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest> const& lhs, Rhs const& rhs)
+    -> _impl::enable_if_t<
+            _impl::is_integral<Rhs>::value,
+            fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest>>
+    {
+        return _impl::from_rep<fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest>>(
+                _impl::to_rep(lhs) >> rhs);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // comparison operators
+
+#define CNL_IMPL_FUSED_STATIC_INTEGER_COMPARISON_OPERATOR(OP) \
+    template<int LhsDigits, int RhsDigits, class RoundingTag, class OverflowTag, class Narrowest> \
+    CNL_NODISCARD constexpr bool operator OP( \
+            fused_static_integer<LhsDigits, RoundingTag, OverflowTag, Narrowest> const& lhs, \
+            fused_static_integer<RhsDigits, RoundingTag, OverflowTag, Narrowest> const& rhs) \
+    { \
+        using wide = _impl::fused_rep_t<_impl::max(LhsDigits, RhsDigits), Narrowest>; \
+        return static_cast<wide>(_impl::to_rep(lhs)) OP static_cast<wide>(_impl::to_rep(rhs)); \
+    } \
+    \
+    template<int LhsDigits, class RoundingTag, class OverflowTag, class Narrowest, typename Rhs> \
+    CNL_NODISCARD constexpr auto operator OP( \
+            fused_static_integer<LhsDigits, RoundingTag, OverflowTag, Narrowest> const& lhs, Rhs const& rhs) \
+    -> _impl::enable_if_t<_impl::is_fused_operand<Rhs>::value, bool> \
+    { \
+        return lhs OP _impl::fused_operand_t<Rhs, RoundingTag, OverflowTag, Narrowest>(rhs); \
+    } \
+    \
+    template<typename Lhs, int RhsDigits, class RoundingTag, class OverflowTag, class Narrowest> \
+    CNL_NODISCARD constexpr auto operator OP( \
+            Lhs const& lhs, fused_static_integer<RhsDigits, RoundingTag, OverflowTag, Narrowest> const& rhs) \
+    -> _impl::enable_if_t<_impl::is_fused_operand<Lhs>::value, bool> \
+    { \
+        return _impl::fused_operand_t<Lhs, RoundingTag, OverflowTag, Narrowest>(lhs) OP rhs; \
+    }
+
+    CNL_IMPL_FUSED_STATIC_INTEGER_COMPARISON_OPERATOR(==)
+
+    CNL_IMPL_FUSED_STATIC_INTEGER_COMPARISON_OPERATOR(!=)
+
+    CNL_IMPL_FUSED_STATIC_INTEGER_COMPARISON_OPERATOR(<)
+
+    CNL_IMPL_FUSED_STATIC_INTEGER_COMPARISON_OPERATOR(>)
+
+    CNL_IMPL_FUSED_STATIC_INTEGER_COMPARISON_OPERATOR(<=)
+
+    CNL_IMPL_FUSED_STATIC_INTEGER_COMPARISON_OPERATOR(>=)
+
+#undef CNL_IMPL_FUSED_STATIC_INTEGER_COMPARISON_OPERATOR
+}
+
+#endif  // CNL_IMPL_FUSED_STATIC_INTEGER_OPERATORS_H
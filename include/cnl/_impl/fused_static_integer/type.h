@@ -0,0 +1,243 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_FUSED_STATIC_INTEGER_TYPE_H)
+#define CNL_IMPL_FUSED_STATIC_INTEGER_TYPE_H
+
+#include "../../constant.h"
+#include "../../limits.h"
+#include "../../overflow.h"
+#include "../../rounding.h"
+#include "../../wide_integer.h"
+#include "../common.h"
+#include "../config.h"
+#include "../num_traits/digits.h"
+#include "../num_traits/from_rep.h"
+#include "../num_traits/rep.h"
+#include "../num_traits/to_rep.h"
+#include "../operators/native_tag.h"
+#include "../polarity.h"
+#include "../type_traits/enable_if.h"
+#include "../used_digits.h"
+
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    template<int Digits, class RoundingTag, class OverflowTag, class Narrowest>
+    class fused_static_integer;
+
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fused_from_rep_tag
+
+        // selects the constructor of fused_static_integer which does not check its argument
+        struct fused_from_rep_tag {
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fused_rep_t
+
+        // the type in which static_integer<Digits, ..., Narrowest> ultimately stores its value
+        template<int Digits, class Narrowest>
+        using fused_rep_t = rep_t<wide_integer<max(Digits, digits<Narrowest>::value), Narrowest>>;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fused_digits
+
+        // number of digits needed to represent value, as given by used_digits for a signed type
+        template<typename Integer>
+        CNL_NODISCARD constexpr int fused_digits(Integer const& value)
+        {
+            return used_digits((value<0) ? Integer(-1)-value : value);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fused_max
+
+        // greatest value of a static_integer with Digits digits
+        template<typename Rep, int Digits>
+        CNL_NODISCARD constexpr Rep fused_max()
+        {
+            return static_cast<Rep>((((Rep{1} << (Digits-1))-Rep{1}) << 1)+Rep{1});
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fused_lowest
+
+        // least value of a static_integer with Digits digits: the negative of fused_max if Rep is signed, else zero
+        template<typename Rep, int Digits>
+        CNL_NODISCARD constexpr Rep fused_lowest()
+        {
+            return numeric_limits<Rep>::is_signed ? static_cast<Rep>(-fused_max<Rep, Digits>()) : Rep{0};
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fused_overflow
+
+        // handles a value which lies beyond bound when converted to a fused_static_integer
+        template<class OverflowTag, polarity Polarity>
+        struct fused_overflow {
+            template<typename Rep, typename S>
+            CNL_NODISCARD constexpr Rep operator()(Rep const&, S const& from) const
+            {
+                return overflow_operator<convert_op, OverflowTag, Polarity>{}.template operator()<Rep>(from);
+            }
+        };
+
+        // saturates to the range of Digits rather than to the limits of Rep
+        template<polarity Polarity>
+        struct fused_overflow<saturated_overflow_tag, Polarity> {
+            template<typename Rep, typename S>
+            CNL_NODISCARD constexpr Rep operator()(Rep const& bound, S const&) const
+            {
+                return bound;
+            }
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::fused_convert
+
+        // converts from, a value of type S with FromDigits digits, to Rep, checking for overflow against the range
+        // of Digits and then rounding as RoundingTag; a bound is tested only if from can exceed it
+        template<typename Rep, int Digits, class RoundingTag, class OverflowTag, int FromDigits, typename S>
+        CNL_NODISCARD constexpr Rep fused_convert(S const& from)
+        {
+            return ((!numeric_limits<S>::is_integer || FromDigits>Digits)
+                    && from>static_cast<S>(fused_max<Rep, Digits>()))
+                   ? fused_overflow<OverflowTag, polarity::positive>{}(fused_max<Rep, Digits>(), from)
+                   : ((!numeric_limits<S>::is_integer || (numeric_limits<S>::is_signed
+                           && (FromDigits>Digits || !numeric_limits<Rep>::is_signed)))
+                           && from<static_cast<S>(fused_lowest<Rep, Digits>()))
+                     ? fused_overflow<OverflowTag, polarity::negative>{}(fused_lowest<Rep, Digits>(), from)
+                     : convert_operator<RoundingTag, native_tag, Rep, S>{}(from);
+        }
+    }
+
+    /// \brief single-layer implementation of \ref cnl::static_integer
+    ///
+    /// \tparam Digits number of binary digits
+    /// \tparam RoundingTag behavior exhibited on precision loss
+    /// \tparam OverflowTag behavior exhibited on out-of-range conditions
+    /// \tparam Narrowest narrowest integer with which to represent the value
+    ///
+    /// Where \ref cnl::static_integer nests overflow, elastic, rounding and wide layers,
+    /// each of which dispatches and converts in turn, this type holds the same value in a single member
+    /// and performs width deduction, rounding and overflow handling in a single operator.
+    /// Results have the same value and number of digits as those of the equivalent \ref cnl::static_integer.
+    /// It is provided in order to compare the cost of the composed type against a hand-fused equivalent.
+    ///
+    /// \headerfile cnl/fused_static_integer.h
+    /// \sa cnl::static_integer
+    template<
+            int Digits = digits<int>::value,
+            class RoundingTag = nearest_rounding_tag,
+            class OverflowTag = undefined_overflow_tag,
+            class Narrowest = int>
+    class fused_static_integer {
+        static_assert(Digits>0, "fused_static_integer must have at least one digit");
+    public:
+        using rep = _impl::fused_rep_t<Digits, Narrowest>;
+
+        fused_static_integer() = default;
+
+        /// initializes the value from another \ref fused_static_integer, checking for overflow if it is wider
+        template<int FromDigits, class FromRoundingTag, class FromOverflowTag>
+        constexpr fused_static_integer(  // NOLINT(hicpp-explicit-conversions)
+                fused_static_integer<FromDigits, FromRoundingTag, FromOverflowTag, Narrowest> const& from)
+                : _rep(_impl::fused_convert<rep, Digits, RoundingTag, OverflowTag, FromDigits>(_impl::to_rep(from)))
+        {
+        }
+
+        /// initializes the value from a constant which must lie in range
+        template<CNL_IMPL_CONSTANT_VALUE_TYPE Value>
+        constexpr fused_static_integer(constant<Value>)  // NOLINT(hicpp-explicit-conversions)
+                : _rep(static_cast<rep>(Value))
+        {
+            static_assert(
+                    _impl::fused_digits(Value)<=Digits, "constant lies outside the range of fused_static_integer");
+        }
+
+        /// initializes the value from an arithmetic value, checking for overflow and rounding as required
+        template<typename S, _impl::enable_if_t<std::is_arithmetic<S>::value || _impl::is_integral<S>::value, int> = 0>
+        constexpr fused_static_integer(S const& value)  // NOLINT(hicpp-explicit-conversions)
+                : _rep(_impl::fused_convert<rep, Digits, RoundingTag, OverflowTag, numeric_limits<S>::digits>(value))
+        {
+        }
+
+        /// converts the value to an arithmetic type, checking for overflow if \c S has fewer digits
+        template<typename S, _impl::enable_if_t<std::is_arithmetic<S>::value || _impl::is_integral<S>::value, int> = 0>
+        CNL_NODISCARD explicit constexpr operator S() const
+        {
+            return (numeric_limits<S>::is_integer && numeric_limits<S>::digits<Digits
+                    && _rep>static_cast<rep>(numeric_limits<S>::max()))
+                   ? _impl::overflow_operator<_impl::convert_op, OverflowTag, _impl::polarity::positive>{}
+                           .template operator()<S>(_rep)
+                   : (numeric_limits<S>::is_integer && numeric_limits<rep>::is_signed
+                           && (!numeric_limits<S>::is_signed || numeric_limits<S>::digits<Digits)
+                           && _rep<static_cast<rep>(numeric_limits<S>::lowest()))
+                     ? _impl::overflow_operator<_impl::convert_op, OverflowTag, _impl::polarity::negative>{}
+                             .template operator()<S>(_rep)
+                     : static_cast<S>(_rep);
+        }
+
+        CNL_NODISCARD explicit constexpr operator bool() const
+        {
+            return _rep!=rep{0};
+        }
+
+    private:
+        constexpr fused_static_integer(_impl::fused_from_rep_tag, rep const& r)
+                : _rep(r)
+        {
+        }
+
+        template<typename, typename, class>
+        friend struct cnl::from_rep;
+
+        template<typename, class>
+        friend struct cnl::to_rep;
+
+        rep _rep;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // cnl::digits<fused_static_integer>
+
+    template<int Digits, class RoundingTag, class OverflowTag, class Narrowest>
+    struct digits<fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest>>
+            : std::integral_constant<int, Digits> {
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // cnl::to_rep<fused_static_integer>
+
+    template<int Digits, class RoundingTag, class OverflowTag, class Narrowest>
+    struct to_rep<fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest>> {
+        using _number_type = fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest>;
+
+        CNL_NODISCARD constexpr typename _number_type::rep operator()(_number_type const& number) const
+        {
+            return number._rep;
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // cnl::from_rep<fused_static_integer>
+
+    // does not check that rep lies in the range
+    template<int Digits, class RoundingTag, class OverflowTag, class Narrowest, typename Rep>
+    struct from_rep<fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest>, Rep> {
+        using _number_type = fused_static_integer<Digits, RoundingTag, OverflowTag, Narrowest>;
+
+        CNL_NODISCARD constexpr _number_type operator()(Rep const& rep) const
+        {
+            return _number_type(_impl::fused_from_rep_tag{}, static_cast<typename _number_type::rep>(rep));
+        }
+    };
+}
+
+#endif  // CNL_IMPL_FUSED_STATIC_INTEGER_TYPE_H
@@ -0,0 +1,157 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_GEMM_GEMM_H)
+#define CNL_IMPL_GEMM_GEMM_H
+
+#include "../common.h"
+#include "../fixed_array/type.h"
+#include "../num_traits/from_rep.h"
+#include "../parallel/partition.h"
+#include "kernel.h"
+
+#include <algorithm>
+#include <cstddef>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::gemm_block_sums
+
+        // sums the products of depths [depth_begin, depth_end) of a block of rows and a block of columns;
+        // the caller ensures that no more than gemm_max_depth products are summed
+        template<typename Rep, typename Lhs, typename Rhs>
+        void gemm_block_sums(
+                Rep* sums, Rep* packed_lhs, Rep* packed_rhs,
+                std::size_t row, std::size_t rows, std::size_t column, std::size_t block_columns,
+                std::size_t columns, std::size_t depth, std::size_t depth_begin, std::size_t depth_end,
+                Lhs const* lhs, Rhs const* rhs)
+        {
+            std::fill(sums, sums+gemm_block_rows*gemm_block_columns, Rep{0});
+
+            for (auto k = depth_begin; k<depth_end; k += gemm_block_depth) {
+                auto const depths = std::min(gemm_block_depth, depth_end-k);
+                gemm_pack_lhs(packed_lhs, lhs, depth, row, rows, k, depths);
+                gemm_pack_rhs(packed_rhs, rhs, columns, k, depths, column, block_columns);
+
+                for (std::size_t i = 0; i<rows; i += gemm_tile_rows) {
+                    for (std::size_t j = 0; j<block_columns; j += gemm_tile_columns) {
+                        gemm_kernel<Rep>{}(
+                                sums+i*gemm_block_columns+j, gemm_block_columns,
+                                packed_lhs+i*depths, packed_rhs+j*depths, depths);
+                    }
+                }
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::gemm_rows
+
+        // computes rows [row_begin, row_end) of the product of lhs and rhs;
+        // each invocation owns its packing buffers so that invocations may run concurrently
+        template<typename Result, typename Lhs, typename Rhs>
+        void gemm_rows(
+                std::size_t row_begin, std::size_t row_end, std::size_t columns, std::size_t depth,
+                Lhs const* lhs, Rhs const* rhs, Result* result)
+        {
+            using accumulator = gemm_accumulator_t<Lhs, Rhs>;
+            using accumulator_rep = gemm_rep_t<accumulator>;
+            using total = gemm_total_t<Lhs, Rhs>;
+
+            auto packed_lhs = fixed_vector<accumulator_rep>(gemm_block_rows*gemm_block_depth);
+            auto packed_rhs = fixed_vector<accumulator_rep>(gemm_block_depth*gemm_block_columns);
+            auto sums = fixed_vector<accumulator_rep>(gemm_block_rows*gemm_block_columns);
+
+            // the sums of successive chunks of gemm_max_depth products are added together
+            // only when the depth is too great for the accumulator
+            auto const chunked = depth>gemm_max_depth;
+            auto totals = fixed_vector<total>(chunked ? gemm_block_rows*gemm_block_columns : 0);
+
+            for (auto row = row_begin; row<row_end; row += gemm_block_rows) {
+                auto const rows = std::min(gemm_block_rows, row_end-row);
+
+                for (std::size_t column = 0; column<columns; column += gemm_block_columns) {
+                    auto const block_columns = std::min(gemm_block_columns, columns-column);
+
+                    if (!chunked) {
+                        gemm_block_sums(
+                                sums.data(), packed_lhs.data(), packed_rhs.data(),
+                                row, rows, column, block_columns, columns, depth, 0, depth, lhs, rhs);
+
+                        for (std::size_t i = 0; i!=rows; ++i) {
+                            for (std::size_t j = 0; j!=block_columns; ++j) {
+                                result[(row+i)*columns+column+j] = static_cast<Result>(
+                                        from_rep<accumulator>(sums[i*gemm_block_columns+j]));
+                            }
+                        }
+                        continue;
+                    }
+
+                    std::fill(totals.begin(), totals.end(), total{});
+                    for (std::size_t chunk = 0; chunk<depth; chunk += gemm_max_depth) {
+                        gemm_block_sums(
+                                sums.data(), packed_lhs.data(), packed_rhs.data(),
+                                row, rows, column, block_columns, columns, depth,
+                                chunk, std::min(depth, chunk+gemm_max_depth), lhs, rhs);
+
+                        for (std::size_t i = 0; i!=rows; ++i) {
+                            for (std::size_t j = 0; j!=block_columns; ++j) {
+                                auto& sum = totals[i*gemm_block_columns+j];
+                                sum = static_cast<total>(
+                                        sum+static_cast<total>(from_rep<accumulator>(sums[i*gemm_block_columns+j])));
+                            }
+                        }
+                    }
+
+                    for (std::size_t i = 0; i!=rows; ++i) {
+                        for (std::size_t j = 0; j!=block_columns; ++j) {
+                            result[(row+i)*columns+column+j] = static_cast<Result>(totals[i*gemm_block_columns+j]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /// \brief multiplies row-major matrices, \c lhs and \c rhs, and stores the product in row-major matrix, \c result
+    ///
+    /// \param rows number of rows of \c lhs and \c result
+    /// \param columns number of columns of \c rhs and \c result
+    /// \param depth number of columns of \c lhs and rows of \c rhs
+    /// \param lhs \c rows by \c depth matrix
+    /// \param rhs \c depth by \c columns matrix
+    /// \param result \c rows by \c columns matrix
+    /// \param concurrency greatest number of threads used to compute bands of rows of \c result
+    ///
+    /// Products are summed without overflow in an accumulator which is 32 bits wide for 8-bit operands.
+    /// When \c depth exceeds 65536, the sums of successive chunks of 65536 products are added in a wider type.
+    /// Each sum is then converted to \c Result so that the result type's rounding and overflow behavior apply,
+    /// e.g. a \c Result of `scaled_integer<rounding_integer<overflow_integer<int8_t, saturated_overflow_tag>>>`
+    /// rounds to nearest and saturates.
+    /// Because summation is exact, the result does not depend upon \c concurrency.
+    ///
+    /// \headerfile cnl/gemm.h
+    /// \sa cnl::dot, cnl::convolve
+    template<typename Result, typename Lhs, typename Rhs>
+    void gemm(
+            std::size_t rows, std::size_t columns, std::size_t depth,
+            Lhs const* lhs, Rhs const* rhs, Result* result,
+            unsigned concurrency = _impl::default_concurrency())
+    {
+        auto const bands = (rows+_impl::gemm_block_rows-1)/_impl::gemm_block_rows;
+        _impl::parallel_for(
+                bands, _impl::parallel_parts(bands, concurrency, 1),
+                [&](std::size_t, std::size_t band_begin, std::size_t band_end) {
+                    _impl::gemm_rows(
+                            band_begin*_impl::gemm_block_rows,
+                            std::min(rows, band_end*_impl::gemm_block_rows),
+                            columns, depth, lhs, rhs, result);
+                });
+    }
+}
+
+#endif  // CNL_IMPL_GEMM_GEMM_H
@@ -0,0 +1,197 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_GEMM_KERNEL_H)
+#define CNL_IMPL_GEMM_KERNEL_H
+
+#include "../../limits.h"
+#include "../config.h"
+#include "../common.h"
+#include "../exact_accumulator.h"
+#include "../simd_pack/type.h"
+#include "../num_traits/to_rep.h"
+#include "../type_traits/remove_cvref.h"
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // blocking parameters of cnl::gemm
+
+        // dimensions of the tile of the result which is held in registers by gemm_kernel;
+        // a row of the tile fills one 512-bit or two 256-bit vectors of 32-bit accumulators
+        constexpr std::size_t gemm_tile_rows = 4;
+        constexpr std::size_t gemm_tile_columns = 16;
+
+        // dimensions of the blocks of the operands which are packed so as to remain in cache
+        constexpr std::size_t gemm_block_rows = 64;
+        constexpr std::size_t gemm_block_depth = 256;
+        constexpr std::size_t gemm_block_columns = 256;
+
+        // greatest number of products which are summed in an accumulator;
+        // deeper products are summed in chunks of this depth
+        constexpr std::size_t gemm_max_depth = std::size_t{1} << 16;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::gemm_accumulator_t
+
+        // type which holds the sum of up to gemm_max_depth products of Lhs and Rhs without overflow;
+        // e.g. 32-bit for 8-bit operands
+        template<typename Lhs, typename Rhs>
+        using gemm_accumulator_t = exact_product_sum_t<Lhs, Rhs, sum_headroom(gemm_max_depth)>;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::gemm_total_t
+
+        // type which holds the sum of any number of products of Lhs and Rhs without overflow;
+        // chunks of up to gemm_max_depth products are summed in gemm_accumulator_t and then added to it
+        template<typename Lhs, typename Rhs>
+        using gemm_total_t = exact_product_sum_t<Lhs, Rhs, sum_headroom(numeric_limits<std::size_t>::max())>;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::gemm_rep_t
+
+        // type of the value returned by to_rep; packed operands and sums are stored as the accumulator's
+        template<typename T>
+        using gemm_rep_t = remove_cvref_t<decltype(to_rep(std::declval<T const&>()))>;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::gemm_pack_lhs
+
+        // copies the block of rows [row, row+rows) and depths [depth, depth+depths) of row-major matrix, lhs,
+        // into slivers of gemm_tile_rows rows, each stored depth-major and padded with zeros;
+        // elements are widened to the type of the accumulator so that the kernel need not convert them
+        template<typename Packed, typename Lhs>
+        void gemm_pack_lhs(
+                Packed* packed, Lhs const* lhs, std::size_t lhs_depth,
+                std::size_t row, std::size_t rows, std::size_t depth, std::size_t depths)
+        {
+            for (std::size_t sliver = 0; sliver<rows; sliver += gemm_tile_rows) {
+                for (std::size_t k = 0; k!=depths; ++k) {
+                    for (std::size_t i = 0; i!=gemm_tile_rows; ++i) {
+                        *packed++ = (sliver+i<rows)
+                                ? static_cast<Packed>(to_rep(lhs[(row+sliver+i)*lhs_depth+depth+k]))
+                                : Packed{0};
+                    }
+                }
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::gemm_pack_rhs
+
+        // copies the block of depths [depth, depth+depths) and columns [column, column+columns)
+        // of row-major matrix, rhs, into slivers of gemm_tile_columns columns, each stored depth-major
+        // and padded with zeros
+        template<typename Packed, typename Rhs>
+        void gemm_pack_rhs(
+                Packed* packed, Rhs const* rhs, std::size_t rhs_columns,
+                std::size_t depth, std::size_t depths, std::size_t column, std::size_t columns)
+        {
+            for (std::size_t sliver = 0; sliver<columns; sliver += gemm_tile_columns) {
+                for (std::size_t k = 0; k!=depths; ++k) {
+                    for (std::size_t j = 0; j!=gemm_tile_columns; ++j) {
+                        *packed++ = (sliver+j<columns)
+                                ? static_cast<Packed>(to_rep(rhs[(depth+k)*rhs_columns+column+sliver+j]))
+                                : Packed{0};
+                    }
+                }
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::gemm_vector_lanes
+
+        // number of elements of type Rep in each vector which makes up a row of the tile;
+        // vectors wider than the target's registers are poorly lowered by compilers
+#if defined(__AVX512F__)
+        constexpr std::size_t gemm_vector_width = 64;
+#elif defined(__AVX__)
+        constexpr std::size_t gemm_vector_width = 32;
+#else
+        constexpr std::size_t gemm_vector_width = 16;
+#endif
+
+        template<typename Rep>
+        struct gemm_vector_lanes
+                : std::integral_constant<
+                        std::size_t,
+                        min(gemm_tile_columns, max(std::size_t{1}, gemm_vector_width/sizeof(Rep)))> {
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::gemm_kernel
+
+        // adds the product of a packed sliver of lhs and a packed sliver of rhs
+        // to a tile of gemm_tile_rows by gemm_tile_columns accumulators, out
+        template<typename Rep, bool IsVector = is_simd_vectorizable<Rep, gemm_vector_lanes<Rep>::value>::value>
+        struct gemm_kernel {
+            void operator()(Rep* out, std::size_t out_stride, Rep const* lhs, Rep const* rhs, std::size_t depths) const
+            {
+                Rep tile[gemm_tile_rows][gemm_tile_columns]{};  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+
+                for (std::size_t k = 0; k!=depths; ++k) {
+                    for (std::size_t i = 0; i!=gemm_tile_rows; ++i) {
+                        for (std::size_t j = 0; j!=gemm_tile_columns; ++j) {
+                            tile[i][j] = static_cast<Rep>(tile[i][j]+static_cast<Rep>(lhs[i]*rhs[j]));
+                        }
+                    }
+                    lhs += gemm_tile_rows;
+                    rhs += gemm_tile_columns;
+                }
+
+                for (std::size_t i = 0; i!=gemm_tile_rows; ++i) {
+                    for (std::size_t j = 0; j!=gemm_tile_columns; ++j) {
+                        out[i*out_stride+j] = static_cast<Rep>(out[i*out_stride+j]+tile[i][j]);
+                    }
+                }
+            }
+        };
+
+#if defined(CNL_VECTOR_EXTENSIONS_ENABLED)
+        // each row of the tile is held in GCC vectors and updated with a broadcast multiply-add
+        template<typename Rep>
+        struct gemm_kernel<Rep, true> {
+            static constexpr std::size_t lanes = gemm_vector_lanes<Rep>::value;
+            static constexpr std::size_t vectors = gemm_tile_columns/lanes;
+            using vector_type = typename simd_storage<Rep, lanes>::type;
+
+            void operator()(Rep* out, std::size_t out_stride, Rep const* lhs, Rep const* rhs, std::size_t depths) const
+            {
+                vector_type tile[gemm_tile_rows][vectors]{};  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+
+                for (std::size_t k = 0; k!=depths; ++k) {
+                    for (std::size_t v = 0; v!=vectors; ++v) {
+                        vector_type factors;
+                        std::memcpy(&factors, rhs+v*lanes, sizeof(factors));
+                        for (std::size_t i = 0; i!=gemm_tile_rows; ++i) {
+                            tile[i][v] += factors*lhs[i];
+                        }
+                    }
+                    lhs += gemm_tile_rows;
+                    rhs += gemm_tile_columns;
+                }
+
+                for (std::size_t i = 0; i!=gemm_tile_rows; ++i) {
+                    for (std::size_t v = 0; v!=vectors; ++v) {
+                        vector_type sums;
+                        std::memcpy(&sums, out+i*out_stride+v*lanes, sizeof(sums));
+                        sums += tile[i][v];
+                        std::memcpy(out+i*out_stride+v*lanes, &sums, sizeof(sums));
+                    }
+                }
+            }
+        };
+#endif
+    }
+}
+
+#endif  // CNL_IMPL_GEMM_KERNEL_H
@@ -0,0 +1,53 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_INDEX_SEQUENCE_H)
+#define CNL_IMPL_INDEX_SEQUENCE_H
+
+#include <cstddef>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::index_sequence - C++11 substitute for std::index_sequence
+
+        template<std::size_t ... Indices>
+        struct index_sequence {
+        };
+
+        template<class Lhs, class Rhs>
+        struct concat_index_sequence;
+
+        template<std::size_t ... LhsIndices, std::size_t ... RhsIndices>
+        struct concat_index_sequence<index_sequence<LhsIndices...>, index_sequence<RhsIndices...>> {
+            using type = index_sequence<LhsIndices..., (sizeof...(LhsIndices)+RhsIndices)...>;
+        };
+
+        // halves the sequence at each step so that instantiation depth is logarithmic in N
+        template<std::size_t N>
+        struct make_index_sequence_impl
+                : concat_index_sequence<
+                        typename make_index_sequence_impl<N/2>::type,
+                        typename make_index_sequence_impl<N-N/2>::type> {
+        };
+
+        template<>
+        struct make_index_sequence_impl<0> {
+            using type = index_sequence<>;
+        };
+
+        template<>
+        struct make_index_sequence_impl<1> {
+            using type = index_sequence<0>;
+        };
+
+        template<std::size_t N>
+        using make_index_sequence = typename make_index_sequence_impl<N>::type;
+    }
+}
+
+#endif  // CNL_IMPL_INDEX_SEQUENCE_H
@@ -7,6 +7,7 @@
 #if !defined(CNL_IMPL_NUM_TRAITS_SCALE)
 #define CNL_IMPL_NUM_TRAITS_SCALE
 
+#include "../decimal_divide.h"
 #include "../power_value.h"
 #include "../type_traits/enable_if.h"
 #include "../type_traits/is_integral.h"
@@ -40,10 +41,40 @@ namespace cnl {
         };
     }
 
+    namespace _impl {
+        // cnl::_impl::fundamental_scale
+        template<int Digits, int Radix, typename S, class Enable = void>
+        struct fundamental_scale : default_scale<Digits, Radix, S> {
+        };
+
+#if defined(CNL_INT128_ENABLED)
+        // Compilers implement 128-bit division by a constant with a library call.
+        // Division by a power of ten is instead performed by multiplication with a precomputed reciprocal.
+        template<int Digits>
+        struct fundamental_scale<Digits, 10, uint128, enable_if_t<Digits<0>> {
+            CNL_NODISCARD constexpr uint128 operator()(uint128 const& s) const
+            {
+                return decimal_divide<-Digits>(s);
+            }
+        };
+
+        template<int Digits>
+        struct fundamental_scale<Digits, 10, int128, enable_if_t<Digits<0>> {
+            // truncates toward zero, as division does
+            CNL_NODISCARD constexpr int128 operator()(int128 const& s) const
+            {
+                return (s<0)
+                       ? -static_cast<int128>(decimal_divide<-Digits>(uint128{0}-static_cast<uint128>(s)))
+                       : static_cast<int128>(decimal_divide<-Digits>(static_cast<uint128>(s)));
+            }
+        };
+#endif
+    }
+
     // cnl::scale<..., fundamental-integer>
     template<int Digits, int Radix, class S>
     struct scale<Digits, Radix, S, _impl::enable_if_t<cnl::_impl::is_integral<S>::value>>
-            : _impl::default_scale<Digits, Radix, S> {
+            : _impl::fundamental_scale<Digits, Radix, S> {
     };
 
     namespace _impl {
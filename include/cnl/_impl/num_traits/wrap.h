@@ -8,6 +8,7 @@
 #define CNL_IMPL_NUM_TRAITS_WRAP_H
 
 #include "../type_traits/enable_if.h"
+#include "from_rep.h"
 #include "is_composite.h"
 #include "rep.h"
 
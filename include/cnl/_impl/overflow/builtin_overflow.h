@@ -81,13 +81,17 @@ namespace cnl {
         ////////////////////////////////////////////////////////////////////////////////
         // cnl::_impl::builtin_overflow_operator
 
-        template<class Operator, typename Lhs, typename Rhs>
+        // provides operator()(lhs, rhs, result) which stores the wrapped result and returns true iff it overflowed;
+        // specialized for fundamental integers and for types which can detect overflow as cheaply
+        template<class Operator, typename Lhs, typename Rhs, class Enable = void>
         struct builtin_overflow_operator : std::false_type {
         };
 
 #if defined(CNL_BUILTIN_OVERFLOW_ENABLED)
         template<typename Lhs, typename Rhs>
-        struct builtin_overflow_operator<add_op, Lhs, Rhs> : are_builtin_operands<Lhs, Rhs> {
+        struct builtin_overflow_operator<
+                add_op, Lhs, Rhs,
+                enable_if_t<are_builtin_operands<Lhs, Rhs>::value>> : std::true_type {
             template<typename Result>
             CNL_NODISCARD constexpr auto operator() (Lhs const& lhs, Rhs const& rhs, Result& result) const
             {
@@ -96,7 +100,9 @@ namespace cnl {
         };
 
         template<typename Lhs, typename Rhs>
-        struct builtin_overflow_operator<subtract_op, Lhs, Rhs> : are_builtin_operands<Lhs, Rhs> {
+        struct builtin_overflow_operator<
+                subtract_op, Lhs, Rhs,
+                enable_if_t<are_builtin_operands<Lhs, Rhs>::value>> : std::true_type {
             template<typename Result>
             CNL_NODISCARD constexpr auto operator() (Lhs const& lhs, Rhs const& rhs, Result& result) const
             {
@@ -105,7 +111,9 @@ namespace cnl {
         };
 
         template<typename Lhs, typename Rhs>
-        struct builtin_overflow_operator<multiply_op, Lhs, Rhs> : are_builtin_operands<Lhs, Rhs> {
+        struct builtin_overflow_operator<
+                multiply_op, Lhs, Rhs,
+                enable_if_t<are_builtin_operands<Lhs, Rhs>::value>> : std::true_type {
             template<typename Result>
             CNL_NODISCARD constexpr auto operator() (Lhs const& lhs, Rhs const& rhs, Result& result) const
             {
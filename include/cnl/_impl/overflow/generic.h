@@ -15,6 +15,10 @@
 #include "is_overflow.h"
 #include "is_overflow_tag.h"
 #include "overflow_operator.h"
+#include "saturated.h"
+#include "saturated_arithmetic.h"
+#include "sticky.h"
+#include "wants_generic_overflow_ops.h"
 
 #include <type_traits>
 
@@ -59,11 +63,38 @@ namespace cnl {
 
         template<class Tag1, class Tag2>
         using common_overflow_tag_t = typename common_overflow_tag<Tag1, Tag2>::type;
+
+        // true iff an operation with the given tags is handled by a branchless saturating operator
+        template<class LhsTag, class RhsTag, class SaturatedOperator, class Enable = void>
+        struct is_saturated_fast_path : std::false_type {
+        };
+
+        template<class SaturatedOperator>
+        struct is_saturated_fast_path<saturated_overflow_tag, saturated_overflow_tag, SaturatedOperator>
+                : std::integral_constant<bool, SaturatedOperator::value> {
+        };
+
+        template<class Tag, class SaturatedOperator>
+        struct is_saturated_fast_path<
+                saturated_overflow_tag, Tag, SaturatedOperator,
+                enable_if_t<!is_overflow_tag<Tag>::value>>
+                : std::integral_constant<bool, SaturatedOperator::value> {
+        };
+
+        template<class Tag, class SaturatedOperator>
+        struct is_saturated_fast_path<
+                Tag, saturated_overflow_tag, SaturatedOperator,
+                enable_if_t<!is_overflow_tag<Tag>::value>>
+                : std::integral_constant<bool, SaturatedOperator::value> {
+        };
     }
 
     template<class DestTag, class SrcTag, typename Destination, typename Source>
     struct convert_operator<DestTag, SrcTag, Destination, Source,
-            _impl::enable_if_t<_impl::is_overflow_tag<DestTag>::value || _impl::is_overflow_tag<SrcTag>::value>> {
+            _impl::enable_if_t<(_impl::is_overflow_tag<DestTag>::value || _impl::is_overflow_tag<SrcTag>::value)
+                    && _impl::wants_generic_overflow_ops<Destination>::value
+                    && !_impl::is_saturated_fast_path<
+                            DestTag, SrcTag, _impl::saturated_convert_operator<Destination, Source>>::value>> {
         using overflow_tag = _impl::common_overflow_tag_t<DestTag, SrcTag>;
 
         CNL_NODISCARD constexpr Destination operator()(Source const& from) const
@@ -76,9 +107,19 @@ namespace cnl {
         }
     };
 
+    // saturated conversion between integers: clamp without branching
+    template<class DestTag, class SrcTag, typename Destination, typename Source>
+    struct convert_operator<DestTag, SrcTag, Destination, Source,
+            _impl::enable_if_t<_impl::wants_generic_overflow_ops<Destination>::value
+                    && _impl::is_saturated_fast_path<
+                            DestTag, SrcTag, _impl::saturated_convert_operator<Destination, Source>>::value>>
+            : _impl::saturated_convert_operator<Destination, Source> {
+    };
+
     template<class Operator, class OverflowTag, typename Operand>
     struct unary_operator<Operator, OverflowTag, Operand,
-            _impl::enable_if_t<_impl::is_overflow_tag<OverflowTag>::value>> {
+            _impl::enable_if_t<_impl::is_overflow_tag<OverflowTag>::value
+                    && _impl::wants_generic_overflow_ops<Operand>::value>> {
         CNL_NODISCARD constexpr auto operator()(Operand const& operand) const
         -> _impl::op_result<Operator, Operand>
         {
@@ -90,7 +131,7 @@ namespace cnl {
         }
     };
 
-#if defined(CNL_BUILTIN_OVERFLOW_ENABLED)
+#if defined(CNL_BUILTIN_OVERFLOW_SUPPORTED_BY_LANGUAGE)
     template<class Operator, class LhsTag, class RhsTag, typename Lhs, typename Rhs>
     struct binary_operator<
             Operator,
@@ -98,6 +139,9 @@ namespace cnl {
             Lhs, Rhs,
             _impl::enable_if_t<_impl::is_overflow_tag<LhsTag>::value
                     && _impl::is_overflow_tag<RhsTag>::value
+                    && !std::is_same<_impl::common_overflow_tag_t<LhsTag, RhsTag>, sticky_overflow_tag>::value
+                    && !_impl::is_saturated_fast_path<
+                            LhsTag, RhsTag, _impl::saturated_binary_operator<Operator, Lhs, Rhs>>::value
                     && _impl::builtin_overflow_operator<Operator, Lhs, Rhs>::value>> {
         using result_type = _impl::op_result<Operator, Lhs, Rhs>;
 
@@ -121,12 +165,34 @@ namespace cnl {
             }
         }
     };
+
+    // sticky overflow of operands with cheap overflow detection: accumulate the overflow flag without branching
+    template<class Operator, typename Lhs, typename Rhs>
+    struct binary_operator<
+            Operator,
+            sticky_overflow_tag, sticky_overflow_tag,
+            Lhs, Rhs,
+            _impl::enable_if_t<_impl::builtin_overflow_operator<Operator, Lhs, Rhs>::value>> {
+        using result_type = _impl::op_result<Operator, Lhs, Rhs>;
+
+        CNL_NODISCARD auto operator()(Lhs const& lhs, Rhs const& rhs) const
+        -> result_type
+        {
+            result_type result{};
+            _impl::sticky_overflow_status() |= _impl::builtin_overflow_operator<Operator, Lhs, Rhs>{}(lhs, rhs, result);
+            return result;
+        }
+    };
 #endif
 
     template<class Operator, class LhsTag, class RhsTag, typename Lhs, typename Rhs>
     struct binary_operator<Operator, LhsTag, RhsTag, Lhs, Rhs,
             _impl::enable_if_t<_impl::is_overflow_tag<LhsTag>::value
                     && _impl::is_overflow_tag<RhsTag>::value
+                    && _impl::wants_generic_overflow_ops<Lhs>::value
+                    && _impl::wants_generic_overflow_ops<Rhs>::value
+                    && !_impl::is_saturated_fast_path<
+                            LhsTag, RhsTag, _impl::saturated_binary_operator<Operator, Lhs, Rhs>>::value
                     && !_impl::builtin_overflow_operator<Operator, Lhs, Rhs>::value>> {
         CNL_NODISCARD constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
         -> _impl::op_result<Operator, Lhs, Rhs>
@@ -143,9 +209,20 @@ namespace cnl {
         }
     };
 
+    // saturated add, subtract and multiply of fundamental integers: clamp or select without branching
+    template<class Operator, typename Lhs, typename Rhs>
+    struct binary_operator<
+            Operator,
+            saturated_overflow_tag, saturated_overflow_tag,
+            Lhs, Rhs,
+            _impl::enable_if_t<_impl::saturated_binary_operator<Operator, Lhs, Rhs>::value>>
+            : _impl::saturated_binary_operator<Operator, Lhs, Rhs> {
+    };
+
     template<class Operator, class LhsTag, class RhsTag, typename Lhs, typename Rhs>
     struct shift_operator<Operator, LhsTag, RhsTag, Lhs, Rhs,
-            _impl::enable_if_t<_impl::is_overflow_tag<LhsTag>::value>> {
+            _impl::enable_if_t<_impl::is_overflow_tag<LhsTag>::value
+                    && _impl::wants_generic_overflow_ops<Lhs>::value>> {
         CNL_NODISCARD constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
         -> _impl::op_result<Operator, Lhs, Rhs>
         {
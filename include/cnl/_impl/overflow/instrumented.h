@@ -0,0 +1,244 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_OVERFLOW_INSTRUMENTED_H)
+#define CNL_IMPL_OVERFLOW_INSTRUMENTED_H
+
+#include "../config.h"
+#include "../operators/homogeneous_deduction_tag_base.h"
+#include "../operators/homogeneous_operator_tag_base.h"
+#include "../operators/operators.h"
+#include "../polarity.h"
+#include "../type_traits/enable_if.h"
+#include "is_overflow_tag.h"
+#include "overflow_operator.h"
+
+#include <atomic>
+#include <string>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief tag which counts overflow events before handling them according to another overflow tag
+    ///
+    /// \tparam BaseTag the overflow tag which determines how overflow is handled, e.g. \ref saturated_overflow_tag
+    /// \tparam Bucket optional type used to separate the counts of different call sites or subsystems;
+    /// each distinct tag type has its own set of counters
+    ///
+    /// Each time an operation using this tag overflows, a relaxed atomic counter for that operator and polarity
+    /// is incremented and then the overflow is handled by `BaseTag`. Operations which do not overflow incur no
+    /// additional cost. Counters are retrieved using \ref cnl::instrumented_overflow_counters.
+    ///
+    /// \headerfile cnl/overflow.h
+    /// \sa cnl::overflow_integer, cnl::instrumented_overflow_counters, cnl::overflow_counters,
+    /// cnl::native_overflow_tag, cnl::saturated_overflow_tag, cnl::throwing_overflow_tag, cnl::trapping_overflow_tag,
+    /// cnl::undefined_overflow_tag
+    template<class BaseTag, class Bucket = void>
+    struct instrumented_overflow_tag
+            : _impl::homogeneous_deduction_tag_base, _impl::homogeneous_operator_tag_base {
+        static_assert(_impl::is_overflow_tag<BaseTag>::value, "BaseTag must be an overflow tag");
+    };
+
+    /// \brief identifies the operator whose overflow is counted by \ref cnl::overflow_counters
+    enum class overflow_operation {
+        convert,
+        negate,
+        add,
+        subtract,
+        multiply,
+        divide,
+        shift_left,
+        other
+    };
+
+    /// \brief set of counters of overflow events incremented by operations using \ref cnl::instrumented_overflow_tag
+    ///
+    /// \headerfile cnl/overflow.h
+    /// \sa cnl::instrumented_overflow_tag, cnl::instrumented_overflow_counters
+    class overflow_counters {
+    public:
+        using count_type = unsigned long long;
+
+        static constexpr int num_operations = static_cast<int>(overflow_operation::other)+1;
+
+        /// returns the number of overflow events of the given operation and polarity
+        CNL_NODISCARD count_type count(overflow_operation operation, bool positive) const noexcept
+        {
+            return counter(operation, positive).load(std::memory_order_relaxed);
+        }
+
+        /// returns the number of overflow events of the given operation
+        CNL_NODISCARD count_type count(overflow_operation operation) const noexcept
+        {
+            return count(operation, true)+count(operation, false);
+        }
+
+        /// returns the total number of overflow events
+        CNL_NODISCARD count_type total() const noexcept
+        {
+            count_type sum{0};
+            for (auto const& c : _counters) {
+                sum += c.load(std::memory_order_relaxed);
+            }
+            return sum;
+        }
+
+        /// sets all counters to zero
+        void reset() noexcept
+        {
+            for (auto& c : _counters) {
+                c.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        /// increments the counter of the given operation and polarity
+        void increment(overflow_operation operation, bool positive) noexcept
+        {
+            counter(operation, positive).fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /// returns the name of the given operation, as used in JSON output
+        CNL_NODISCARD static char const* name(overflow_operation operation) noexcept
+        {
+            return names()[static_cast<int>(operation)];
+        }
+
+    private:
+        CNL_NODISCARD static char const* const* names() noexcept
+        {
+            static char const* const n[num_operations] = {
+                    "convert", "negate", "add", "subtract", "multiply", "divide", "shift_left", "other"};
+            return n;
+        }
+
+        CNL_NODISCARD std::atomic<count_type>& counter(overflow_operation operation, bool positive) noexcept
+        {
+            return _counters[static_cast<int>(operation)*2+(positive ? 0 : 1)];
+        }
+
+        CNL_NODISCARD std::atomic<count_type> const& counter(overflow_operation operation, bool positive) const noexcept
+        {
+            return _counters[static_cast<int>(operation)*2+(positive ? 0 : 1)];
+        }
+
+        std::atomic<count_type> _counters[num_operations*2] = {};
+    };
+
+    /// \brief produces a JSON object describing the given counters
+    ///
+    /// \headerfile cnl/overflow.h
+    /// \return a string of the form `{"add":{"positive":0,"negative":0},...,"total":0}`
+    inline std::string to_json(overflow_counters const& counters)
+    {
+        std::string json{"{"};
+        for (auto index = 0; index!=overflow_counters::num_operations; ++index) {
+            auto const operation = static_cast<overflow_operation>(index);
+            json += "\"";
+            json += overflow_counters::name(operation);
+            json += "\":{\"positive\":";
+            json += std::to_string(counters.count(operation, true));
+            json += ",\"negative\":";
+            json += std::to_string(counters.count(operation, false));
+            json += "},";
+        }
+        json += "\"total\":";
+        json += std::to_string(counters.total());
+        json += "}";
+        return json;
+    }
+
+    /// \brief returns the counters incremented by operations using the given \ref cnl::instrumented_overflow_tag
+    ///
+    /// \headerfile cnl/overflow.h
+    template<class InstrumentedOverflowTag>
+    overflow_counters& instrumented_overflow_counters() noexcept
+    {
+        static overflow_counters counters;
+        return counters;
+    }
+
+    namespace _impl {
+        template<class BaseTag, class Bucket>
+        struct is_overflow_tag<instrumented_overflow_tag<BaseTag, Bucket>> : std::true_type {
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::overflow_operation_of
+
+        template<class Operator>
+        struct overflow_operation_of
+                : std::integral_constant<overflow_operation, overflow_operation::other> {
+        };
+
+        template<>
+        struct overflow_operation_of<convert_op>
+                : std::integral_constant<overflow_operation, overflow_operation::convert> {
+        };
+
+        template<>
+        struct overflow_operation_of<minus_op>
+                : std::integral_constant<overflow_operation, overflow_operation::negate> {
+        };
+
+        template<>
+        struct overflow_operation_of<add_op>
+                : std::integral_constant<overflow_operation, overflow_operation::add> {
+        };
+
+        template<>
+        struct overflow_operation_of<subtract_op>
+                : std::integral_constant<overflow_operation, overflow_operation::subtract> {
+        };
+
+        template<>
+        struct overflow_operation_of<multiply_op>
+                : std::integral_constant<overflow_operation, overflow_operation::multiply> {
+        };
+
+        template<>
+        struct overflow_operation_of<divide_op>
+                : std::integral_constant<overflow_operation, overflow_operation::divide> {
+        };
+
+        template<>
+        struct overflow_operation_of<shift_left_op>
+                : std::integral_constant<overflow_operation, overflow_operation::shift_left> {
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::count_overflow
+
+        template<class Tag, class Operator, polarity Polarity>
+        void count_overflow() noexcept
+        {
+            instrumented_overflow_counters<Tag>().increment(
+                    overflow_operation_of<Operator>::value,
+                    Polarity==polarity::positive);
+        }
+
+        // not constexpr because counting the event writes to shared state;
+        // operations which do not overflow remain usable in constant expressions
+        template<typename Operator, class BaseTag, class Bucket, polarity Polarity>
+        struct overflow_operator<Operator, instrumented_overflow_tag<BaseTag, Bucket>, Polarity> {
+            using _base = overflow_operator<Operator, BaseTag, Polarity>;
+
+            template<typename Destination, typename Source>
+            CNL_NODISCARD Destination operator()(Source const& from) const
+            {
+                return count_overflow<instrumented_overflow_tag<BaseTag, Bucket>, Operator, Polarity>(),
+                        _base{}.template operator()<Destination>(from);
+            }
+
+            template<class ... Operands>
+            CNL_NODISCARD op_result<Operator, Operands...> operator()(Operands const& ... operands) const
+            {
+                return count_overflow<instrumented_overflow_tag<BaseTag, Bucket>, Operator, Polarity>(),
+                        _base{}(operands...);
+            }
+        };
+    }
+}
+
+#endif  // CNL_IMPL_OVERFLOW_INSTRUMENTED_H
@@ -7,6 +7,10 @@
 #if !defined(CNL_IMPL_OVERFLOW_SATURATED_H)
 #define CNL_IMPL_OVERFLOW_SATURATED_H
 
+#include "../../limits.h"
+#include "../operators/homogeneous_deduction_tag_base.h"
+#include "../operators/homogeneous_operator_tag_base.h"
+#include "../operators/operators.h"
 #include "../polarity.h"
 #include "../terminate.h"
 #include "is_overflow_tag.h"
@@ -0,0 +1,217 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_OVERFLOW_SATURATED_ARITHMETIC_H)
+#define CNL_IMPL_OVERFLOW_SATURATED_ARITHMETIC_H
+
+#include "../../cstdint.h"
+#include "../../limits.h"
+#include "../config.h"
+#include "../num_traits/digits.h"
+#include "../num_traits/set_digits.h"
+#include "../operators/operators.h"
+#include "../polarity.h"
+#include "../type_traits/enable_if.h"
+#include "builtin_overflow.h"
+#include "is_overflow.h"
+
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::is_saturatable_operator
+
+        template<class Operator>
+        struct is_saturatable_operator : std::integral_constant<bool,
+                std::is_same<Operator, add_op>::value
+                        || std::is_same<Operator, subtract_op>::value
+                        || std::is_same<Operator, multiply_op>::value> {
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::saturated_exact_digits
+
+        // number of digits needed to hold the exact result of an add_op, subtract_op or multiply_op
+        template<class Operator, typename Lhs, typename Rhs>
+        struct saturated_exact_digits : std::integral_constant<int,
+                (digits<Lhs>::value>digits<Rhs>::value ? digits<Lhs>::value : digits<Rhs>::value)+1> {
+        };
+
+        template<typename Lhs, typename Rhs>
+        struct saturated_exact_digits<multiply_op, Lhs, Rhs>
+                : std::integral_constant<int, digits<Lhs>::value+digits<Rhs>::value> {
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::is_exactly_saturatable
+
+        // true iff the exact result of the operation fits in a fundamental integer no wider than 64 bits
+        template<class Operator, typename Lhs, typename Rhs, bool AreBuiltin = are_builtin_operands<Lhs, Rhs>::value>
+        struct is_exactly_saturatable : std::false_type {
+        };
+
+        template<class Operator, typename Lhs, typename Rhs>
+        struct is_exactly_saturatable<Operator, Lhs, Rhs, true> : std::integral_constant<bool,
+                is_saturatable_operator<Operator>::value
+                        && saturated_exact_digits<Operator, Lhs, Rhs>::value<=digits<int64>::value> {
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::saturated_limit
+
+        // the limit to which an overflowing result is saturated,
+        // given operands of the same type as the result
+        template<class Operator>
+        struct saturated_limit;
+
+        template<>
+        struct saturated_limit<add_op> {
+            template<typename Result>
+            CNL_NODISCARD constexpr Result operator()(Result const&, Result const& rhs) const
+            {
+                return rhs<Result{} ? numeric_limits<Result>::lowest() : numeric_limits<Result>::max();
+            }
+        };
+
+        template<>
+        struct saturated_limit<subtract_op> {
+            template<typename Result>
+            CNL_NODISCARD constexpr Result operator()(Result const&, Result const& rhs) const
+            {
+                return rhs<Result{} ? numeric_limits<Result>::max() : numeric_limits<Result>::lowest();
+            }
+        };
+
+        template<>
+        struct saturated_limit<multiply_op> {
+            template<typename Result>
+            CNL_NODISCARD constexpr Result operator()(Result const& lhs, Result const& rhs) const
+            {
+                return (lhs<Result{})!=(rhs<Result{}) ? numeric_limits<Result>::lowest() : numeric_limits<Result>::max();
+            }
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::saturated_clamp
+
+        // converts an integer to a narrower one, saturating values which are out of range;
+        // each comparison is omitted if it cannot succeed and is otherwise written as a select
+        template<
+                typename Destination, typename Source,
+                bool ClampMax = (overflow_digits<Destination, polarity::positive>::value
+                        <overflow_digits<Source, polarity::positive>::value),
+                bool ClampLowest = (overflow_digits<Destination, polarity::negative>::value
+                        <overflow_digits<Source, polarity::negative>::value)>
+        struct saturated_clamp {
+            CNL_NODISCARD constexpr Destination operator()(Source const& from) const
+            {
+                return static_cast<Destination>(from);
+            }
+        };
+
+        template<typename Destination, typename Source>
+        struct saturated_clamp<Destination, Source, true, false> {
+            CNL_NODISCARD constexpr Destination operator()(Source const& from) const
+            {
+                return static_cast<Destination>(
+                        from>static_cast<Source>(numeric_limits<Destination>::max())
+                        ? static_cast<Source>(numeric_limits<Destination>::max())
+                        : from);
+            }
+        };
+
+        template<typename Destination, typename Source>
+        struct saturated_clamp<Destination, Source, false, true> {
+            CNL_NODISCARD constexpr Destination operator()(Source const& from) const
+            {
+                return static_cast<Destination>(
+                        from<static_cast<Source>(numeric_limits<Destination>::lowest())
+                        ? static_cast<Source>(numeric_limits<Destination>::lowest())
+                        : from);
+            }
+        };
+
+        template<typename Destination, typename Source>
+        struct saturated_clamp<Destination, Source, true, true> {
+            CNL_NODISCARD constexpr Destination operator()(Source const& from) const
+            {
+                return static_cast<Destination>(
+                        from>static_cast<Source>(numeric_limits<Destination>::max())
+                        ? static_cast<Source>(numeric_limits<Destination>::max())
+                        : from<static_cast<Source>(numeric_limits<Destination>::lowest())
+                                ? static_cast<Source>(numeric_limits<Destination>::lowest())
+                                : from);
+            }
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::saturated_convert_operator
+
+        template<typename Destination, typename Source, class Enable = void>
+        struct saturated_convert_operator : std::false_type {
+        };
+
+        template<typename Destination, typename Source>
+        struct saturated_convert_operator<
+                Destination, Source,
+                enable_if_t<numeric_limits<Destination>::is_integer && numeric_limits<Source>::is_integer>>
+                : std::true_type, saturated_clamp<Destination, Source> {
+            using saturated_clamp<Destination, Source>::operator();
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::saturated_binary_operator
+
+        // saturating add_op, subtract_op and multiply_op of fundamental integers which avoid branches
+        template<class Operator, typename Lhs, typename Rhs, class Enable = void>
+        struct saturated_binary_operator : std::false_type {
+        };
+
+        // the exact result fits in a fundamental integer; calculate it and clamp
+        template<class Operator, typename Lhs, typename Rhs>
+        struct saturated_binary_operator<
+                Operator, Lhs, Rhs,
+                enable_if_t<is_exactly_saturatable<Operator, Lhs, Rhs>::value>>
+                : std::true_type {
+            using result_type = op_result<Operator, Lhs, Rhs>;
+            using exact_type = set_digits_t<
+                    int64,
+                    (saturated_exact_digits<Operator, Lhs, Rhs>::value>digits<result_type>::value)
+                    ? saturated_exact_digits<Operator, Lhs, Rhs>::value
+                    : digits<result_type>::value>;
+
+            CNL_NODISCARD constexpr result_type operator()(Lhs const& lhs, Rhs const& rhs) const
+            {
+                return saturated_clamp<result_type, exact_type>{}(
+                        static_cast<exact_type>(Operator{}(static_cast<exact_type>(lhs), static_cast<exact_type>(rhs))));
+            }
+        };
+
+#if defined(CNL_BUILTIN_OVERFLOW_ENABLED)
+        // otherwise, detect overflow with intrinsics and select the result or the limit
+        template<class Operator, typename Operand>
+        struct saturated_binary_operator<
+                Operator, Operand, Operand,
+                enable_if_t<is_saturatable_operator<Operator>::value
+                        && are_builtin_operands<Operand, Operand>::value
+                        && !is_exactly_saturatable<Operator, Operand, Operand>::value
+                        && std::is_same<op_result<Operator, Operand, Operand>, Operand>::value>>
+                : std::true_type {
+            CNL_NODISCARD constexpr Operand operator()(Operand const& lhs, Operand const& rhs) const
+            {
+                Operand result{};
+                auto const overflow = builtin_overflow_operator<Operator, Operand, Operand>{}(lhs, rhs, result);
+                auto const limit = saturated_limit<Operator>{}(lhs, rhs);
+                return overflow ? limit : result;
+            }
+        };
+#endif
+    }
+}
+
+#endif  // CNL_IMPL_OVERFLOW_SATURATED_ARITHMETIC_H
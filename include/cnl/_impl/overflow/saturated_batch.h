@@ -0,0 +1,231 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_OVERFLOW_SATURATED_BATCH_H)
+#define CNL_IMPL_OVERFLOW_SATURATED_BATCH_H
+
+#include "../../limits.h"
+#include "../config.h"
+#include "../num_traits/width.h"
+#include "../operators/generic.h"
+#include "../operators/operators.h"
+#include "../operators/tagged.h"
+#include "../type_traits/enable_if.h"
+#include "../type_traits/is_integral.h"
+#include "../type_traits/is_signed.h"
+#include "../type_traits/remove_signedness.h"
+#include "generic.h"
+#include "saturated.h"
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::saturated_batch_scalar
+
+        // applies a saturating operator element-wise
+        template<class Operator, typename Rep>
+        struct saturated_batch_scalar {
+            void operator()(Rep const* lhs, Rep const* rhs, Rep* result, std::size_t size) const
+            {
+                for (std::size_t index = 0; index!=size; ++index) {
+                    result[index] = convert<saturated_overflow_tag, saturated_overflow_tag, Rep>(
+                            binary_operator<
+                                    Operator,
+                                    saturated_overflow_tag, saturated_overflow_tag,
+                                    Rep, Rep>{}(lhs[index], rhs[index]));
+                }
+            }
+        };
+
+#if defined(CNL_VECTOR_EXTENSIONS_ENABLED)
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::saturated_vector
+
+        // vector of as many Rep as fit into 16 bytes
+        template<typename Rep>
+        struct saturated_vector {
+            typedef Rep type __attribute__((vector_size(16)));  // NOLINT(modernize-use-using)
+
+            static constexpr std::size_t size = 16/sizeof(Rep);
+
+            static type load(Rep const* from)
+            {
+                type v;
+                std::memcpy(&v, from, sizeof(v));
+                return v;
+            }
+
+            static void store(Rep* to, type const& v)
+            {
+                std::memcpy(to, &v, sizeof(v));
+            }
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::saturated_vector_operator
+
+        // Add and subtract are performed in lanes of the same width as Rep. Overflow is detected from the signs,
+        // or from the carry, of the operands and wrapped result. Lanes which overflow are replaced with the limit.
+        template<class Operator, typename Rep, bool IsSigned = is_signed<Rep>::value>
+        struct saturated_vector_operator;
+
+        template<typename Rep>
+        struct saturated_vector_operator<add_op, Rep, true> {
+            using vector = typename saturated_vector<Rep>::type;
+            using unsigned_vector = typename saturated_vector<remove_signedness_t<Rep>>::type;
+
+            vector operator()(vector const& lhs, vector const& rhs) const
+            {
+                auto const sum = (vector)((unsigned_vector)lhs+(unsigned_vector)rhs);
+                auto const overflow = (vector)(((lhs ^ sum) & (rhs ^ sum))<0);
+                auto const limit = (lhs >> (width<Rep>::value-1)) ^ numeric_limits<Rep>::max();
+                return (limit & overflow) | (sum & ~overflow);
+            }
+        };
+
+        template<typename Rep>
+        struct saturated_vector_operator<subtract_op, Rep, true> {
+            using vector = typename saturated_vector<Rep>::type;
+            using unsigned_vector = typename saturated_vector<remove_signedness_t<Rep>>::type;
+
+            vector operator()(vector const& lhs, vector const& rhs) const
+            {
+                auto const difference = (vector)((unsigned_vector)lhs-(unsigned_vector)rhs);
+                auto const overflow = (vector)(((lhs ^ rhs) & (lhs ^ difference))<0);
+                auto const limit = (lhs >> (width<Rep>::value-1)) ^ numeric_limits<Rep>::max();
+                return (limit & overflow) | (difference & ~overflow);
+            }
+        };
+
+        template<typename Rep>
+        struct saturated_vector_operator<add_op, Rep, false> {
+            using vector = typename saturated_vector<Rep>::type;
+
+            vector operator()(vector const& lhs, vector const& rhs) const
+            {
+                auto const sum = lhs+rhs;
+                return sum | (vector)(sum<lhs);
+            }
+        };
+
+        template<typename Rep>
+        struct saturated_vector_operator<subtract_op, Rep, false> {
+            using vector = typename saturated_vector<Rep>::type;
+
+            vector operator()(vector const& lhs, vector const& rhs) const
+            {
+                auto const difference = lhs-rhs;
+                return difference & ~(vector)(lhs<rhs);
+            }
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::saturated_batch_vector
+
+        // applies a saturating operator to vectors of elements and then to any remaining elements
+        template<class Operator, typename Rep>
+        struct saturated_batch_vector {
+            void operator()(Rep const* lhs, Rep const* rhs, Rep* result, std::size_t size) const
+            {
+                using vector = saturated_vector<Rep>;
+                std::size_t index = 0;
+                for (; index+vector::size<=size; index += vector::size) {
+                    vector::store(
+                            result+index,
+                            saturated_vector_operator<Operator, Rep>{}(
+                                    vector::load(lhs+index),
+                                    vector::load(rhs+index)));
+                }
+                saturated_batch_scalar<Operator, Rep>{}(lhs+index, rhs+index, result+index, size-index);
+            }
+        };
+#endif
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::saturated_batch
+
+        template<class Operator, typename Rep, class Enable = void>
+        struct saturated_batch : saturated_batch_scalar<Operator, Rep> {
+        };
+
+#if defined(CNL_VECTOR_EXTENSIONS_ENABLED)
+        template<class Operator, typename Rep>
+        struct saturated_batch<
+                Operator, Rep,
+                enable_if_t<std::is_integral<Rep>::value && !std::is_same<Rep, bool>::value && sizeof(Rep)<=8
+                        && (std::is_same<Operator, add_op>::value || std::is_same<Operator, subtract_op>::value)>>
+                : saturated_batch_vector<Operator, Rep> {
+        };
+#endif
+    }
+
+    /// \brief adds arrays of integers element-wise, saturating results which overflow
+    /// \headerfile cnl/overflow.h
+    ///
+    /// \param lhs, rhs arrays of operands of length `size`
+    /// \param result array of length `size` into which sums are written
+    /// \param size number of elements to process
+    ///
+    /// \note When `CNL_VECTOR_EXTENSIONS_ENABLED` is defined, elements are processed in 16-byte vectors
+    /// using GCC vector extensions. Define `CNL_USE_VECTOR_EXTENSIONS` to 0 to select the scalar implementation.
+    ///
+    /// \sa cnl::saturated_overflow_tag, cnl::saturated_subtract, cnl::saturated_multiply, cnl::saturated_convert
+    template<typename Rep>
+    void saturated_add(Rep const* lhs, Rep const* rhs, Rep* result, std::size_t size)
+    {
+        static_assert(_impl::is_integral<Rep>::value, "Rep must be a fundamental integer");
+        _impl::saturated_batch<_impl::add_op, Rep>{}(lhs, rhs, result, size);
+    }
+
+    /// \brief subtracts arrays of integers element-wise, saturating results which overflow
+    /// \headerfile cnl/overflow.h
+    ///
+    /// \sa cnl::saturated_add
+    template<typename Rep>
+    void saturated_subtract(Rep const* lhs, Rep const* rhs, Rep* result, std::size_t size)
+    {
+        static_assert(_impl::is_integral<Rep>::value, "Rep must be a fundamental integer");
+        _impl::saturated_batch<_impl::subtract_op, Rep>{}(lhs, rhs, result, size);
+    }
+
+    /// \brief multiplies arrays of integers element-wise, saturating results which overflow
+    /// \headerfile cnl/overflow.h
+    ///
+    /// \note The loop is written so that optimizing compilers emit SIMD instructions.
+    ///
+    /// \sa cnl::saturated_add
+    template<typename Rep>
+    void saturated_multiply(Rep const* lhs, Rep const* rhs, Rep* result, std::size_t size)
+    {
+        static_assert(_impl::is_integral<Rep>::value, "Rep must be a fundamental integer");
+        _impl::saturated_batch<_impl::multiply_op, Rep>{}(lhs, rhs, result, size);
+    }
+
+    /// \brief converts an array of integers element-wise, saturating values which are out of range
+    /// \headerfile cnl/overflow.h
+    ///
+    /// \param from array of length `size` to convert
+    /// \param result array of length `size` into which converted values are written
+    /// \param size number of elements to process
+    ///
+    /// \note The loop is written so that optimizing compilers emit SIMD instructions.
+    ///
+    /// \sa cnl::saturated_add
+    template<typename Destination, typename Source>
+    void saturated_convert(Source const* from, Destination* result, std::size_t size)
+    {
+        for (std::size_t index = 0; index!=size; ++index) {
+            result[index] = convert<saturated_overflow_tag, _impl::native_tag, Destination>(from[index]);
+        }
+    }
+}
+
+#endif  // CNL_IMPL_OVERFLOW_SATURATED_BATCH_H
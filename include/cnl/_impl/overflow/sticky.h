@@ -0,0 +1,113 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_OVERFLOW_STICKY_H)
+#define CNL_IMPL_OVERFLOW_STICKY_H
+
+#include "../../limits.h"
+#include "../config.h"
+#include "../operators/homogeneous_deduction_tag_base.h"
+#include "../operators/homogeneous_operator_tag_base.h"
+#include "../operators/operators.h"
+#include "../polarity.h"
+#include "is_overflow_tag.h"
+#include "overflow_operator.h"
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief tag to specify deferred, sticky overflow detection in arithmetic operations
+    ///
+    /// Arithmetic operations using this tag record overflow in a thread-local status flag instead of reacting to it.
+    /// The flag remains set until cleared with \ref cnl::clear_overflow_status. This allows a block of work to be
+    /// checked for overflow once, at the end, rather than once per operation.
+    ///
+    /// Where the toolchain provides overflow intrinsics, addition, subtraction and multiplication of fundamental
+    /// integers record overflow without branching. Otherwise, overflow is detected as for the other overflow tags.
+    ///
+    /// \note The value of a result which overflows is unspecified but the operation never invokes undefined behavior.
+    ///
+    /// \headerfile cnl/overflow.h
+    /// \sa cnl::overflow_integer, cnl::overflow_status, cnl::clear_overflow_status,
+    /// cnl::native_overflow_tag, cnl::saturated_overflow_tag, cnl::throwing_overflow_tag, cnl::trapping_overflow_tag,
+    /// cnl::undefined_overflow_tag
+    struct sticky_overflow_tag
+            : _impl::homogeneous_deduction_tag_base, _impl::homogeneous_operator_tag_base {
+    };
+
+    namespace _impl {
+        template<>
+        struct is_overflow_tag<sticky_overflow_tag> : std::true_type {
+        };
+
+        // the status flag of the calling thread
+        inline bool& sticky_overflow_status() noexcept
+        {
+            static thread_local bool status{false};
+            return status;
+        }
+
+        // records an overflow event and returns the given value
+        template<typename Result>
+        Result sticky_overflow(Result const& result) noexcept
+        {
+            sticky_overflow_status() = true;
+            return result;
+        }
+
+        // not constexpr because recording the event writes to thread-local state;
+        // operations which do not overflow remain usable in constant expressions
+        template<typename Operator>
+        struct overflow_operator<Operator, sticky_overflow_tag, polarity::positive> {
+            template<typename Destination, typename Source>
+            CNL_NODISCARD Destination operator()(Source const&) const
+            {
+                return sticky_overflow(numeric_limits<Destination>::max());
+            }
+
+            template<class ... Operands>
+            CNL_NODISCARD op_result<Operator, Operands...> operator()(Operands const& ...) const
+            {
+                return sticky_overflow(numeric_limits<op_result<Operator, Operands...>>::max());
+            }
+        };
+
+        template<typename Operator>
+        struct overflow_operator<Operator, sticky_overflow_tag, polarity::negative> {
+            template<typename Destination, typename Source>
+            CNL_NODISCARD Destination operator()(Source const&) const
+            {
+                return sticky_overflow(numeric_limits<Destination>::lowest());
+            }
+
+            template<class ... Operands>
+            CNL_NODISCARD op_result<Operator, Operands...> operator()(Operands const& ...) const
+            {
+                return sticky_overflow(numeric_limits<op_result<Operator, Operands...>>::lowest());
+            }
+        };
+    }
+
+    /// \brief returns true iff an operation using \ref cnl::sticky_overflow_tag has overflowed on the calling thread
+    /// since the last call to \ref cnl::clear_overflow_status
+    ///
+    /// \headerfile cnl/overflow.h
+    /// \sa cnl::sticky_overflow_tag
+    CNL_NODISCARD inline bool overflow_status() noexcept
+    {
+        return _impl::sticky_overflow_status();
+    }
+
+    /// \brief resets the overflow status of the calling thread
+    ///
+    /// \headerfile cnl/overflow.h
+    /// \sa cnl::sticky_overflow_tag, cnl::overflow_status
+    inline void clear_overflow_status() noexcept
+    {
+        _impl::sticky_overflow_status() = false;
+    }
+}
+
+#endif  // CNL_IMPL_OVERFLOW_STICKY_H
@@ -0,0 +1,26 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_OVERFLOW_WANTS_GENERIC_OVERFLOW_OPS_H)
+#define CNL_IMPL_OVERFLOW_WANTS_GENERIC_OVERFLOW_OPS_H
+
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::wants_generic_overflow_ops
+
+        // true iff overflow-tagged operations upon T are handled by the generic overflow operators;
+        // types which specialize the operators themselves specialize this trait as false
+        template<class T, class Enable = void>
+        struct wants_generic_overflow_ops : std::true_type {
+        };
+    }
+}
+
+#endif  // CNL_IMPL_OVERFLOW_WANTS_GENERIC_OVERFLOW_OPS_H
@@ -0,0 +1,66 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_PARALLEL_PARTITION_H)
+#define CNL_IMPL_PARALLEL_PARTITION_H
+
+#include "../config.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::default_concurrency
+
+        // number of threads used by parallel algorithms unless the caller specifies otherwise
+        CNL_NODISCARD inline unsigned default_concurrency()
+        {
+            return std::max(1U, std::thread::hardware_concurrency());
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::parallel_parts
+
+        // number of parts into which size items are divided such that there are no more parts than concurrency
+        // and, where possible, no part has fewer than grain items
+        CNL_NODISCARD inline std::size_t parallel_parts(std::size_t size, unsigned concurrency, std::size_t grain)
+        {
+            return std::max(std::size_t{1}, std::min(std::size_t{concurrency}, size/std::max(std::size_t{1}, grain)));
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::parallel_for
+
+        // divides [0, size) into parts contiguous ranges of near-equal length
+        // and invokes function(part, begin, end) for each concurrently;
+        // the first part is processed on the calling thread and every part is complete upon return
+        template<typename Function>
+        void parallel_for(std::size_t size, std::size_t parts, Function const& function)
+        {
+            auto const part_begin = [&](std::size_t part) {
+                return size*part/parts;
+            };
+
+            auto workers = std::vector<std::thread>{};
+            workers.reserve(parts-1);
+            for (std::size_t part = 1; part<parts; ++part) {
+                workers.emplace_back(function, part, part_begin(part), part_begin(part+1));
+            }
+            function(std::size_t{0}, part_begin(0), part_begin(1));
+
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
+    }
+}
+
+#endif  // CNL_IMPL_PARALLEL_PARTITION_H
@@ -0,0 +1,132 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_PARALLEL_REDUCE_H)
+#define CNL_IMPL_PARALLEL_REDUCE_H
+
+#include "../config.h"
+#include "../exact_accumulator.h"
+#include "../num_traits/digits.h"
+#include "partition.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // parameters of parallel algorithms
+
+        // number of digits by which a value must be widened to hold the sum of up to 2^31 values
+        constexpr int parallel_headroom = digits<std::int32_t>::value;
+
+        // fewest elements processed by each thread; fewer are not worth the cost of starting a thread
+        constexpr std::size_t parallel_grain = std::size_t{1} << 14;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::parallel_sum_t
+
+        // type of T widened by parallel_headroom
+        template<typename T>
+        using parallel_sum_t = exact_sum_t<T, parallel_headroom>;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::parallel_product_sum_t
+
+        // type of the product of Lhs and Rhs widened by parallel_headroom
+        template<typename Lhs, typename Rhs>
+        using parallel_product_sum_t = exact_product_sum_t<Lhs, Rhs, parallel_headroom>;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::exact_sum
+
+        // sum of size elements of input
+        template<typename Accumulator, typename T>
+        CNL_NODISCARD Accumulator exact_sum(T const* input, std::size_t size)
+        {
+            auto total = Accumulator{0};
+            for (std::size_t index = 0; index!=size; ++index) {
+                total = static_cast<Accumulator>(total+static_cast<Accumulator>(input[index]));
+            }
+            return total;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::parallel_partial_sums
+
+        // sum of each of the parts into which parallel_for divides [0, size) as computed by part_sum(begin, end)
+        template<typename Accumulator, typename PartSum>
+        CNL_NODISCARD std::vector<Accumulator> parallel_partial_sums(
+                std::size_t size, unsigned concurrency, PartSum const& part_sum)
+        {
+            auto partial_sums = std::vector<Accumulator>(
+                    parallel_parts(size, concurrency, parallel_grain), Accumulator{0});
+            parallel_for(
+                    size, partial_sums.size(),
+                    [&](std::size_t part, std::size_t begin, std::size_t end) {
+                        partial_sums[part] = part_sum(begin, end);
+                    });
+            return partial_sums;
+        }
+    }
+
+    /// \brief returns the sum of the \c size elements of \c input
+    ///
+    /// \param input array of \c size elements
+    /// \param size number of elements; no greater than 2^31
+    /// \param concurrency greatest number of threads used to sum parts of \c input
+    ///
+    /// The result is widened by 31 digits so that it does not overflow, e.g. the sum of
+    /// `scaled_integer<int16_t, power<-8>>` is a `scaled_integer<int64_t, power<-8>>`
+    /// and the sum of `elastic_integer<24>` is an `elastic_integer<55>`.
+    /// Each thread sums a contiguous part of \c input in an accumulator of the same type.
+    /// Because summation is exact, the result does not depend upon \c concurrency.
+    ///
+    /// \headerfile cnl/parallel.h
+    /// \sa cnl::sum, cnl::inclusive_scan
+    template<typename T>
+    CNL_NODISCARD _impl::parallel_sum_t<T> reduce(
+            T const* input, std::size_t size, unsigned concurrency = _impl::default_concurrency())
+    {
+        using accumulator = _impl::parallel_sum_t<T>;
+
+        auto const partial_sums = _impl::parallel_partial_sums<accumulator>(
+                size, concurrency,
+                [input](std::size_t begin, std::size_t end) {
+                    return _impl::exact_sum<accumulator>(input+begin, end-begin);
+                });
+        return _impl::exact_sum<accumulator>(partial_sums.data(), partial_sums.size());
+    }
+
+    /// \brief returns the sum of the products of the corresponding elements of \c lhs and \c rhs
+    ///
+    /// \param lhs array of \c size elements
+    /// \param rhs array of \c size elements
+    /// \param size number of elements; no greater than 2^31
+    /// \param concurrency greatest number of threads used to sum parts of \c lhs and \c rhs
+    ///
+    /// The result has the scale of the product of two elements and is widened by 31 digits so that it does not
+    /// overflow. Because summation is exact, the result does not depend upon \c concurrency.
+    ///
+    /// \headerfile cnl/parallel.h
+    template<typename Lhs, typename Rhs>
+    CNL_NODISCARD _impl::parallel_product_sum_t<Lhs, Rhs> dot(
+            Lhs const* lhs, Rhs const* rhs, std::size_t size, unsigned concurrency = _impl::default_concurrency())
+    {
+        using accumulator = _impl::parallel_product_sum_t<Lhs, Rhs>;
+
+        auto const partial_sums = _impl::parallel_partial_sums<accumulator>(
+                size, concurrency,
+                [lhs, rhs](std::size_t begin, std::size_t end) {
+                    return _impl::exact_dot<accumulator>(lhs+begin, rhs+begin, end-begin);
+                });
+        return _impl::exact_sum<accumulator>(partial_sums.data(), partial_sums.size());
+    }
+}
+
+#endif  // CNL_IMPL_PARALLEL_REDUCE_H
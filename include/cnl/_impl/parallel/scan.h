@@ -0,0 +1,56 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_PARALLEL_SCAN_H)
+#define CNL_IMPL_PARALLEL_SCAN_H
+
+#include "../config.h"
+#include "partition.h"
+#include "reduce.h"
+
+#include <cstddef>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief stores in each of the \c size elements of \c output the sum of the corresponding element of \c input
+    /// and every element which precedes it
+    ///
+    /// \param input array of \c size elements
+    /// \param size number of elements; no greater than 2^31
+    /// \param output array of \c size elements
+    /// \param concurrency greatest number of threads used to scan parts of \c input
+    ///
+    /// Sums are accumulated in the type returned by \ref reduce and converted to \c Output.
+    /// Each thread first sums a contiguous part of \c input; the sums of preceding parts then offset its scan.
+    /// Because summation is exact, the result does not depend upon \c concurrency.
+    ///
+    /// \headerfile cnl/parallel.h
+    /// \sa cnl::reduce
+    template<typename T, typename Output>
+    void inclusive_scan(
+            T const* input, std::size_t size, Output* output, unsigned concurrency = _impl::default_concurrency())
+    {
+        using accumulator = _impl::parallel_sum_t<T>;
+
+        auto const partial_sums = _impl::parallel_partial_sums<accumulator>(
+                size, concurrency,
+                [input](std::size_t begin, std::size_t end) {
+                    return _impl::exact_sum<accumulator>(input+begin, end-begin);
+                });
+
+        _impl::parallel_for(
+                size, partial_sums.size(),
+                [&](std::size_t part, std::size_t begin, std::size_t end) {
+                    auto total = _impl::exact_sum<accumulator>(partial_sums.data(), part);
+                    for (auto index = begin; index!=end; ++index) {
+                        total = static_cast<accumulator>(total+static_cast<accumulator>(input[index]));
+                        output[index] = static_cast<Output>(total);
+                    }
+                });
+    }
+}
+
+#endif  // CNL_IMPL_PARALLEL_SCAN_H
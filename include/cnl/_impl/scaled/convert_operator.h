@@ -8,11 +8,15 @@
 #define CNL_IMPL_SCALED_CONVERT_OPERATOR_H
 
 #include "../../fraction.h"
+#include "../common.h"
+#include "../exact_accumulator.h"
 #include "../num_traits/fixed_width_scale.h"
 #include "../num_traits/scale.h"
 #include "../operators/native_tag.h"
 #include "../power_value.h"
 #include "../scaled_integer/declaration.h"
+#include "../type_traits/remove_signedness.h"
+#include "../used_digits.h"
 #include "is_same_tag_family.h"
 #include "power.h"
 
@@ -66,6 +70,50 @@ namespace cnl {
         }
     };
 
+    // integer -> integer of a different radix, e.g. between decimal and binary fixed-point
+    template<
+            int DestExponent, int DestRadix, int SrcExponent, int SrcRadix,
+            typename Result, typename Input>
+    struct convert_operator<
+            power<DestExponent, DestRadix>,
+            power<SrcExponent, SrcRadix>,
+            Result, Input,
+            _impl::enable_if_t<DestRadix!=SrcRadix
+                    && _impl::is_integral<Result>::value && _impl::is_integral<Input>::value>> {
+    private:
+        // scaling up precedes scaling down in an intermediate type wide enough for the scaled-up value;
+        // the magnitude is scaled so that a wide intermediate never multiplies or divides a negative value
+        using _unsigned_input = remove_signedness_t<Input>;
+        using _unsigned_result = remove_signedness_t<Result>;
+        static constexpr int _src_up = _impl::max(SrcExponent, 0);
+        static constexpr int _dest_up = _impl::max(-DestExponent, 0);
+        static constexpr int _src_down = _impl::min(SrcExponent, 0);
+        static constexpr int _dest_down = _impl::min(-DestExponent, 0);
+        static constexpr int _intermediate_digits = digits<_unsigned_input>::value
+                +_src_up*_impl::used_digits(SrcRadix-1)
+                +_dest_up*_impl::used_digits(DestRadix-1);
+        using _intermediate = typename _impl::exact_widen<_unsigned_input, _intermediate_digits>::type;
+
+        CNL_NODISCARD static constexpr _unsigned_result scale_magnitude(_unsigned_input const& magnitude)
+        {
+            return static_cast<_unsigned_result>(
+                    _impl::scale<_dest_down, DestRadix>(
+                            _impl::scale<_src_down, SrcRadix>(
+                                    _impl::scale<_dest_up, DestRadix>(
+                                            _impl::scale<_src_up, SrcRadix>(static_cast<_intermediate>(magnitude))))));
+        }
+
+    public:
+        // as with conversion between integers, the result is truncated toward zero
+        CNL_NODISCARD constexpr Result operator()(Input const& from) const
+        {
+            return (from<Input{0})
+                   ? static_cast<Result>(_unsigned_result{0}-scale_magnitude(
+                            static_cast<_unsigned_input>(_unsigned_input{0}-static_cast<_unsigned_input>(from))))
+                   : static_cast<Result>(scale_magnitude(static_cast<_unsigned_input>(from)));
+        }
+    };
+
     // shims between equivalent tags
     template<
             int DestExponent, int DestRadix,
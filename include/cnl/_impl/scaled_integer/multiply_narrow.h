@@ -0,0 +1,198 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief rounding, narrowing multiplication of `cnl::scaled_integer` values
+
+#if !defined(CNL_IMPL_SCALED_INTEGER_MULTIPLY_NARROW_H)
+#define CNL_IMPL_SCALED_INTEGER_MULTIPLY_NARROW_H
+
+#include "../config.h"
+#include "../num_traits/digits.h"
+#include "../num_traits/from_rep.h"
+#include "../num_traits/set_digits.h"
+#include "../num_traits/to_rep.h"
+#include "../type_traits/enable_if.h"
+#include "../type_traits/is_signed.h"
+#include "../type_traits/remove_signedness.h"
+#include "../type_traits/set_signedness.h"
+#include "type.h"
+
+#include <cstddef>
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::narrow_product_rep
+
+        // type wide enough to hold the exact product of LhsRep and RhsRep
+        template<typename LhsRep, typename RhsRep>
+        using narrow_product_rep = set_digits_t<
+                set_signedness_t<
+                        decltype(std::declval<LhsRep>()*std::declval<RhsRep>()),
+                        is_signed<LhsRep>::value || is_signed<RhsRep>::value>,
+                digits<LhsRep>::value+digits<RhsRep>::value>;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::narrow_product
+
+        // rescales an exact product by Shift binary digits;
+        // when bits are lost, rounds half towards positive infinity
+        // in the manner of DSP Q-format instructions, e.g. SSSE3 pmulhrsw;
+        // the shift-increment-shift form is the one GCC recognizes as pmulhrsw
+        template<int Shift, class Enable = void>
+        struct narrow_product {
+            template<typename Result, typename Product>
+            CNL_NODISCARD constexpr Result operator()(Product const& product) const
+            {
+                static_assert(Shift<=digits<Product>::value, "shift exceeds the digits of the product");
+                return static_cast<Result>(((product >> (Shift-1))+1) >> 1);
+            }
+        };
+
+        // the shift is performed on the promoted, unsigned equivalent of Result
+        // because left-shifting a negative value is undefined before C++20
+        template<int Shift>
+        struct narrow_product<Shift, enable_if_t<(Shift<=0)>> {
+            template<typename Result, typename Product>
+            CNL_NODISCARD constexpr Result operator()(Product const& product) const
+            {
+                using unsigned_result = remove_signedness_t<decltype(+std::declval<Result>())>;
+                return static_cast<Result>(
+                        static_cast<unsigned_result>(static_cast<unsigned_result>(static_cast<Result>(product))
+                                << -Shift));
+            }
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::multiply_narrow_rep
+
+        template<typename Result, typename Lhs, typename Rhs>
+        struct multiply_narrow_rep;
+
+        template<
+                typename ResultRep, int ResultExponent,
+                typename LhsRep, int LhsExponent,
+                typename RhsRep, int RhsExponent,
+                int Radix>
+        struct multiply_narrow_rep<
+                scaled_integer<ResultRep, power<ResultExponent, Radix>>,
+                scaled_integer<LhsRep, power<LhsExponent, Radix>>,
+                scaled_integer<RhsRep, power<RhsExponent, Radix>>> {
+            static_assert(Radix==2, "cnl::multiply_narrow is only implemented for binary scaled_integer types");
+
+            using product_rep = narrow_product_rep<LhsRep, RhsRep>;
+            static constexpr int shift = ResultExponent-(LhsExponent+RhsExponent);
+
+            CNL_NODISCARD constexpr ResultRep operator()(LhsRep const& lhs, RhsRep const& rhs) const
+            {
+                return narrow_product<shift>{}.template operator()<ResultRep>(
+                        static_cast<product_rep>(static_cast<product_rep>(lhs)*static_cast<product_rep>(rhs)));
+            }
+        };
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // cnl::multiply_narrow
+
+    /// \brief multiplies two \ref scaled_integer values and rounds the result directly into a given format
+    /// \headerfile cnl/scaled_integer.h
+    ///
+    /// \tparam Result the \ref scaled_integer type of the result
+    /// \param lhs, rhs the factors
+    ///
+    /// \return product of `lhs` and `rhs`, rounded to the nearest value representable by `Result`
+    ///
+    /// \note The exact product is computed in an integer just wide enough to hold it and then the high half is
+    /// taken with a single round-and-shift. For `scaled_integer<int16_t, power<-15>>` this is the operation performed
+    /// by instructions such as SSSE3 `pmulhrsw` and NEON `vqrdmulh`. Ties are rounded towards positive infinity.
+    ///
+    /// \note Overflow of the result is handled by the conversion to `Result`'s rep, e.g. wrapping for fundamental
+    /// integers. As with `pmulhrsw`, the only Q15 case which overflows is `-1 * -1`.
+    ///
+    /// \sa rounding_multiply
+
+    template<class Result, typename LhsRep, class LhsScale, typename RhsRep, class RhsScale>
+    CNL_NODISCARD constexpr auto multiply_narrow(
+            scaled_integer<LhsRep, LhsScale> const& lhs,
+            scaled_integer<RhsRep, RhsScale> const& rhs)
+    -> Result
+    {
+        return _impl::from_rep<Result>(_impl::multiply_narrow_rep<
+                Result,
+                scaled_integer<LhsRep, LhsScale>,
+                scaled_integer<RhsRep, RhsScale>>{}(_impl::to_rep(lhs), _impl::to_rep(rhs)));
+    }
+
+    /// \brief multiplies arrays of \ref scaled_integer values element-wise, rounding directly into a given format
+    /// \headerfile cnl/scaled_integer.h
+    ///
+    /// \tparam Result the \ref scaled_integer type of the results
+    /// \param lhs, rhs arrays of factors of length `size`
+    /// \param result array of length `size` into which products are written
+    /// \param size number of elements to process
+    ///
+    /// \note The loop operates directly on the reps of its operands
+    /// and is written so that optimizing compilers emit SIMD instructions,
+    /// e.g. `pmulhrsw` for Q15 operands when SSSE3 is enabled.
+    ///
+    /// \sa multiply_narrow
+
+    template<class Result, typename LhsRep, class LhsScale, typename RhsRep, class RhsScale>
+    void multiply_narrow(
+            scaled_integer<LhsRep, LhsScale> const* lhs,
+            scaled_integer<RhsRep, RhsScale> const* rhs,
+            Result* result,
+            std::size_t size)
+    {
+        using rep_operator = _impl::multiply_narrow_rep<
+                Result,
+                scaled_integer<LhsRep, LhsScale>,
+                scaled_integer<RhsRep, RhsScale>>;
+        for (std::size_t index = 0; index!=size; ++index) {
+            result[index] = _impl::from_rep<Result>(
+                    rep_operator{}(_impl::to_rep(lhs[index]), _impl::to_rep(rhs[index])));
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // cnl::rounding_multiply
+
+    /// \brief multiplies two \ref scaled_integer values of the same type and rounds the result to that type
+    /// \headerfile cnl/scaled_integer.h
+    ///
+    /// \return `multiply_narrow<scaled_integer<Rep, Scale>>(lhs, rhs)`
+    ///
+    /// \sa multiply_narrow
+
+    template<typename Rep, class Scale>
+    CNL_NODISCARD constexpr auto rounding_multiply(
+            scaled_integer<Rep, Scale> const& lhs,
+            scaled_integer<Rep, Scale> const& rhs)
+    -> scaled_integer<Rep, Scale>
+    {
+        return multiply_narrow<scaled_integer<Rep, Scale>>(lhs, rhs);
+    }
+
+    /// \brief multiplies arrays of \ref scaled_integer values element-wise and rounds the results to the same type
+    /// \headerfile cnl/scaled_integer.h
+    ///
+    /// \sa multiply_narrow
+
+    template<typename Rep, class Scale>
+    void rounding_multiply(
+            scaled_integer<Rep, Scale> const* lhs,
+            scaled_integer<Rep, Scale> const* rhs,
+            scaled_integer<Rep, Scale>* result,
+            std::size_t size)
+    {
+        multiply_narrow<scaled_integer<Rep, Scale>>(lhs, rhs, result, size);
+    }
+}
+
+#endif  // CNL_IMPL_SCALED_INTEGER_MULTIPLY_NARROW_H
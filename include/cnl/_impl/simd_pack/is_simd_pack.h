@@ -0,0 +1,28 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_SIMD_PACK_IS_SIMD_PACK_H)
+#define CNL_IMPL_SIMD_PACK_IS_SIMD_PACK_H
+
+#include "forward_declaration.h"
+
+#include <cstddef>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        template<typename T>
+        struct is_simd_pack : std::false_type {
+        };
+
+        template<typename T, std::size_t N>
+        struct is_simd_pack<simd_pack<T, N>> : std::true_type {
+        };
+    }
+}
+
+#endif  // CNL_IMPL_SIMD_PACK_IS_SIMD_PACK_H
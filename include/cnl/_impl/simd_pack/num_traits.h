@@ -0,0 +1,88 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_SIMD_PACK_NUM_TRAITS_H)
+#define CNL_IMPL_SIMD_PACK_NUM_TRAITS_H
+
+#include "../../limits.h"
+#include "../num_traits/digits.h"
+#include "../num_traits/from_value.h"
+#include "../num_traits/scale.h"
+#include "../num_traits/set_digits.h"
+#include "../num_traits/to_rep.h"
+#include "../power_value.h"
+#include "../type_traits/add_signedness.h"
+#include "../type_traits/enable_if.h"
+#include "../type_traits/is_signed.h"
+#include "../type_traits/remove_signedness.h"
+#include "operators.h"
+#include "type.h"
+
+#include <cstddef>
+
+/// compositional numeric library
+namespace cnl {
+    template<typename T, std::size_t N>
+    struct numeric_limits<simd_pack<T, N>> : numeric_limits<T> {
+    };
+
+    template<typename T, std::size_t N>
+    struct digits<simd_pack<T, N>> : digits<T> {
+    };
+
+    template<typename T, std::size_t N, int Digits>
+    struct set_digits<simd_pack<T, N>, Digits> {
+        using type = simd_pack<set_digits_t<T, Digits>, N>;
+    };
+
+    template<typename T, std::size_t N>
+    struct is_signed<simd_pack<T, N>> : is_signed<T> {
+    };
+
+    template<typename T, std::size_t N>
+    struct add_signedness<simd_pack<T, N>> {
+        using type = simd_pack<add_signedness_t<T>, N>;
+    };
+
+    template<typename T, std::size_t N>
+    struct remove_signedness<simd_pack<T, N>> {
+        using type = simd_pack<remove_signedness_t<T>, N>;
+    };
+
+    template<typename T, std::size_t N>
+    struct to_rep<simd_pack<T, N>> : _impl::default_to_rep<simd_pack<T, N>> {
+    };
+
+    // a scalar value is broadcast to a pack whose lanes are of the value's type
+    template<typename T, std::size_t N, typename Value>
+    struct from_value<simd_pack<T, N>, Value, _impl::enable_if_t<_impl::is_simd_scalar<Value>::value>>
+            : _impl::from_value_simple<simd_pack<Value, N>, Value> {
+    };
+
+    template<typename T, std::size_t N, typename U>
+    struct from_value<simd_pack<T, N>, simd_pack<U, N>>
+            : _impl::from_value_simple<simd_pack<U, N>, simd_pack<U, N>> {
+    };
+
+    // each lane is multiplied or divided by the same scalar power of Radix
+    template<int Digits, int Radix, typename T, std::size_t N>
+    struct scale<Digits, Radix, simd_pack<T, N>, _impl::enable_if_t<0<=Digits>> {
+        CNL_NODISCARD simd_pack<T, N> operator()(simd_pack<T, N> const& s) const
+        {
+            return s*static_cast<T>(_impl::power_value<T, Digits, Radix>());
+        }
+    };
+
+    template<int Digits, int Radix, typename T, std::size_t N>
+    struct scale<Digits, Radix, simd_pack<T, N>, _impl::enable_if_t<Digits<0>> {
+        CNL_NODISCARD simd_pack<T, N> operator()(simd_pack<T, N> const& s) const
+        {
+            return s/static_cast<T>(_impl::power_value<T, -Digits, Radix>());
+        }
+    };
+}
+
+#endif  // CNL_IMPL_SIMD_PACK_NUM_TRAITS_H
@@ -0,0 +1,367 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_SIMD_PACK_OPERATORS_H)
+#define CNL_IMPL_SIMD_PACK_OPERATORS_H
+
+#include "../config.h"
+#include "../operators/operators.h"
+#include "../type_traits/enable_if.h"
+#include "is_simd_pack.h"
+#include "type.h"
+
+#include <cstddef>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::simd_unary_operator
+
+        template<class Operator, typename T, std::size_t N, bool IsVector = is_simd_vectorizable<T, N>::value>
+        struct simd_unary_operator {
+            CNL_NODISCARD simd_pack<T, N> operator()(simd_pack<T, N> const& rhs) const
+            {
+                simd_pack<T, N> result;
+                for (std::size_t lane = 0; lane!=N; ++lane) {
+                    result.set(lane, static_cast<T>(Operator{}(rhs[lane])));
+                }
+                return result;
+            }
+        };
+
+        template<class Operator, typename T, std::size_t N>
+        struct simd_unary_operator<Operator, T, N, true> {
+            CNL_NODISCARD simd_pack<T, N> operator()(simd_pack<T, N> const& rhs) const
+            {
+                return simd_pack<T, N>(Operator{}(rhs.data()));
+            }
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::simd_binary_operator
+
+        template<class Operator, typename T, std::size_t N, bool IsVector = is_simd_vectorizable<T, N>::value>
+        struct simd_binary_operator {
+            CNL_NODISCARD simd_pack<T, N> operator()(simd_pack<T, N> const& lhs, simd_pack<T, N> const& rhs) const
+            {
+                simd_pack<T, N> result;
+                for (std::size_t lane = 0; lane!=N; ++lane) {
+                    result.set(lane, static_cast<T>(Operator{}(lhs[lane], rhs[lane])));
+                }
+                return result;
+            }
+        };
+
+        template<class Operator, typename T, std::size_t N>
+        struct simd_binary_operator<Operator, T, N, true> {
+            CNL_NODISCARD simd_pack<T, N> operator()(simd_pack<T, N> const& lhs, simd_pack<T, N> const& rhs) const
+            {
+                return simd_pack<T, N>(Operator{}(lhs.data(), rhs.data()));
+            }
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::simd_comparison_operator
+
+        template<class Operator, typename T, std::size_t N, bool IsVector = is_simd_vectorizable<T, N>::value>
+        struct simd_comparison_operator {
+            CNL_NODISCARD simd_mask<T, N> operator()(simd_pack<T, N> const& lhs, simd_pack<T, N> const& rhs) const
+            {
+                simd_mask<T, N> result;
+                for (std::size_t lane = 0; lane!=N; ++lane) {
+                    result.set(lane, Operator{}(lhs[lane], rhs[lane]));
+                }
+                return result;
+            }
+        };
+
+        template<class Operator, typename T, std::size_t N>
+        struct simd_comparison_operator<Operator, T, N, true> {
+            using mask_storage = typename simd_mask<T, N>::storage_type;
+
+            CNL_NODISCARD simd_mask<T, N> operator()(simd_pack<T, N> const& lhs, simd_pack<T, N> const& rhs) const
+            {
+                // a vector comparison produces lanes of all ones or all zeros
+                return simd_mask<T, N>((mask_storage)(Operator{}(lhs.data(), rhs.data())));  // NOLINT
+            }
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::simd_common_pack
+
+        // the type to which operands of a binary operation are converted
+        template<typename Lhs, typename Rhs, class Enable = void>
+        struct simd_common_pack;
+
+        template<typename LhsT, typename RhsT, std::size_t N>
+        struct simd_common_pack<simd_pack<LhsT, N>, simd_pack<RhsT, N>> {
+            using type = simd_pack<typename std::common_type<LhsT, RhsT>::type, N>;
+        };
+
+        template<typename T, std::size_t N, typename Scalar>
+        struct simd_common_pack<simd_pack<T, N>, Scalar, enable_if_t<is_simd_scalar<Scalar>::value>> {
+            using type = simd_pack<T, N>;
+        };
+
+        template<typename Scalar, typename T, std::size_t N>
+        struct simd_common_pack<Scalar, simd_pack<T, N>, enable_if_t<is_simd_scalar<Scalar>::value>> {
+            using type = simd_pack<T, N>;
+        };
+
+        template<typename Lhs, typename Rhs>
+        using simd_common_pack_t = typename simd_common_pack<Lhs, Rhs>::type;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::is_simd_operation
+
+        // true iff Lhs and Rhs are the operands of a lane-wise binary operation,
+        // i.e. packs of the same size or a pack and a scalar
+        template<typename Lhs, typename Rhs>
+        struct is_simd_operation : std::false_type {
+        };
+
+        template<typename LhsT, std::size_t LhsN, typename RhsT, std::size_t RhsN>
+        struct is_simd_operation<simd_pack<LhsT, LhsN>, simd_pack<RhsT, RhsN>>
+                : std::integral_constant<bool, LhsN==RhsN> {
+        };
+
+        template<typename T, std::size_t N, typename Scalar>
+        struct is_simd_operation<simd_pack<T, N>, Scalar> : is_simd_scalar<Scalar> {
+        };
+
+        template<typename Scalar, typename T, std::size_t N>
+        struct is_simd_operation<Scalar, simd_pack<T, N>> : is_simd_scalar<Scalar> {
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::simd_select
+
+        template<
+                typename T, typename U, std::size_t N,
+                bool IsVector = is_simd_vectorizable<U, N>::value && std::is_integral<U>::value
+                        && sizeof(T)==sizeof(U)>
+        struct simd_select {
+            CNL_NODISCARD simd_pack<U, N> operator()(
+                    simd_mask<T, N> const& mask, simd_pack<U, N> const& if_true, simd_pack<U, N> const& if_false) const
+            {
+                simd_pack<U, N> result;
+                for (std::size_t lane = 0; lane!=N; ++lane) {
+                    result.set(lane, mask[lane] ? if_true[lane] : if_false[lane]);
+                }
+                return result;
+            }
+        };
+
+        // the lanes of a mask are all ones or all zeros and so blend integer lanes of the same width
+        template<typename T, typename U, std::size_t N>
+        struct simd_select<T, U, N, true> {
+            using storage_type = typename simd_pack<U, N>::storage_type;
+
+            CNL_NODISCARD simd_pack<U, N> operator()(
+                    simd_mask<T, N> const& mask, simd_pack<U, N> const& if_true, simd_pack<U, N> const& if_false) const
+            {
+                auto const blend = (storage_type)(mask.data());  // NOLINT
+                return simd_pack<U, N>((if_true.data() & blend) | (if_false.data() & ~blend));
+            }
+        };
+
+        template<class Pack, typename Operand>
+        CNL_NODISCARD Pack simd_convert(Operand const& operand)
+        {
+            return Pack(operand);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // unary operators
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define CNL_IMPL_SIMD_PACK_UNARY_OPERATOR(OP, NAME) \
+    template<typename T, std::size_t N> \
+    CNL_NODISCARD simd_pack<T, N> operator OP(simd_pack<T, N> const& rhs) \
+    { \
+        return _impl::simd_unary_operator<_impl::NAME, T, N>{}(rhs); \
+    }
+
+    CNL_IMPL_SIMD_PACK_UNARY_OPERATOR(+, plus_op)
+
+    CNL_IMPL_SIMD_PACK_UNARY_OPERATOR(-, minus_op)
+
+    CNL_IMPL_SIMD_PACK_UNARY_OPERATOR(~, bitwise_not_op)
+
+#undef CNL_IMPL_SIMD_PACK_UNARY_OPERATOR
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // binary arithmetic, bitwise and shift operators
+
+    // Operands of different types are first converted to a common simd_pack type;
+    // scalar operands are broadcast to every lane.
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define CNL_IMPL_SIMD_PACK_BINARY_OPERATOR(OP, NAME) \
+    template<typename Lhs, typename Rhs, _impl::enable_if_t<_impl::is_simd_operation<Lhs, Rhs>::value, int> = 0> \
+    CNL_NODISCARD auto operator OP(Lhs const& lhs, Rhs const& rhs) \
+    -> _impl::simd_common_pack_t<Lhs, Rhs> \
+    { \
+        using pack = _impl::simd_common_pack_t<Lhs, Rhs>; \
+        return _impl::simd_binary_operator<_impl::NAME, typename pack::value_type, pack::size()>{}( \
+                _impl::simd_convert<pack>(lhs), _impl::simd_convert<pack>(rhs)); \
+    } \
+    \
+    template<typename T, std::size_t N, typename Rhs, \
+            _impl::enable_if_t<_impl::is_simd_operation<simd_pack<T, N>, Rhs>::value, int> = 0> \
+    simd_pack<T, N>& operator OP##=(simd_pack<T, N>& lhs, Rhs const& rhs) \
+    { \
+        return lhs = simd_pack<T, N>(lhs OP rhs); \
+    }
+
+    CNL_IMPL_SIMD_PACK_BINARY_OPERATOR(+, add_op)
+
+    CNL_IMPL_SIMD_PACK_BINARY_OPERATOR(-, subtract_op)
+
+    CNL_IMPL_SIMD_PACK_BINARY_OPERATOR(*, multiply_op)
+
+    CNL_IMPL_SIMD_PACK_BINARY_OPERATOR(/, divide_op)
+
+    CNL_IMPL_SIMD_PACK_BINARY_OPERATOR(%, modulo_op)
+
+    CNL_IMPL_SIMD_PACK_BINARY_OPERATOR(|, bitwise_or_op)
+
+    CNL_IMPL_SIMD_PACK_BINARY_OPERATOR(&, bitwise_and_op)
+
+    CNL_IMPL_SIMD_PACK_BINARY_OPERATOR(^, bitwise_xor_op)
+
+    // shift operators take the type of the left-hand operand
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define CNL_IMPL_SIMD_PACK_SHIFT_OPERATOR(OP, NAME) \
+    template<typename T, std::size_t N, typename Rhs, \
+            _impl::enable_if_t<_impl::is_simd_operation<simd_pack<T, N>, Rhs>::value, int> = 0> \
+    CNL_NODISCARD simd_pack<T, N> operator OP(simd_pack<T, N> const& lhs, Rhs const& rhs) \
+    { \
+        return _impl::simd_binary_operator<_impl::NAME, T, N>{}(lhs, _impl::simd_convert<simd_pack<T, N>>(rhs)); \
+    } \
+    \
+    template<typename T, std::size_t N, typename Rhs, \
+            _impl::enable_if_t<_impl::is_simd_operation<simd_pack<T, N>, Rhs>::value, int> = 0> \
+    simd_pack<T, N>& operator OP##=(simd_pack<T, N>& lhs, Rhs const& rhs) \
+    { \
+        return lhs = lhs OP rhs; \
+    }
+
+    CNL_IMPL_SIMD_PACK_SHIFT_OPERATOR(<<, shift_left_op)
+
+    CNL_IMPL_SIMD_PACK_SHIFT_OPERATOR(>>, shift_right_op)
+
+#undef CNL_IMPL_SIMD_PACK_BINARY_OPERATOR
+#undef CNL_IMPL_SIMD_PACK_SHIFT_OPERATOR
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // comparison operators
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define CNL_IMPL_SIMD_PACK_COMPARISON_OPERATOR(OP, NAME) \
+    template<typename Lhs, typename Rhs, _impl::enable_if_t<_impl::is_simd_operation<Lhs, Rhs>::value, int> = 0> \
+    CNL_NODISCARD auto operator OP(Lhs const& lhs, Rhs const& rhs) \
+    -> typename _impl::simd_common_pack_t<Lhs, Rhs>::mask_type \
+    { \
+        using pack = _impl::simd_common_pack_t<Lhs, Rhs>; \
+        return _impl::simd_comparison_operator<_impl::NAME, typename pack::value_type, pack::size()>{}( \
+                _impl::simd_convert<pack>(lhs), _impl::simd_convert<pack>(rhs)); \
+    }
+
+    CNL_IMPL_SIMD_PACK_COMPARISON_OPERATOR(==, equal_op)
+
+    CNL_IMPL_SIMD_PACK_COMPARISON_OPERATOR(!=, not_equal_op)
+
+    CNL_IMPL_SIMD_PACK_COMPARISON_OPERATOR(<, less_than_op)
+
+    CNL_IMPL_SIMD_PACK_COMPARISON_OPERATOR(>, greater_than_op)
+
+    CNL_IMPL_SIMD_PACK_COMPARISON_OPERATOR(<=, less_than_or_equal_op)
+
+    CNL_IMPL_SIMD_PACK_COMPARISON_OPERATOR(>=, greater_than_or_equal_op)
+
+#undef CNL_IMPL_SIMD_PACK_COMPARISON_OPERATOR
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // simd_mask operators and functions
+
+    template<typename T, std::size_t N>
+    CNL_NODISCARD simd_mask<T, N> operator!(simd_mask<T, N> const& rhs)
+    {
+        simd_mask<T, N> result;
+        for (std::size_t lane = 0; lane!=N; ++lane) {
+            result.set(lane, !rhs[lane]);
+        }
+        return result;
+    }
+
+    template<typename T, std::size_t N>
+    CNL_NODISCARD simd_mask<T, N> operator&&(simd_mask<T, N> const& lhs, simd_mask<T, N> const& rhs)
+    {
+        simd_mask<T, N> result;
+        for (std::size_t lane = 0; lane!=N; ++lane) {
+            result.set(lane, lhs[lane] && rhs[lane]);
+        }
+        return result;
+    }
+
+    template<typename T, std::size_t N>
+    CNL_NODISCARD simd_mask<T, N> operator||(simd_mask<T, N> const& lhs, simd_mask<T, N> const& rhs)
+    {
+        simd_mask<T, N> result;
+        for (std::size_t lane = 0; lane!=N; ++lane) {
+            result.set(lane, lhs[lane] || rhs[lane]);
+        }
+        return result;
+    }
+
+    /// \brief returns true iff every lane of \c mask is true
+    /// \headerfile cnl/simd_pack.h
+    template<typename T, std::size_t N>
+    CNL_NODISCARD bool all_of(simd_mask<T, N> const& mask)
+    {
+        for (std::size_t lane = 0; lane!=N; ++lane) {
+            if (!mask[lane]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// \brief returns true iff any lane of \c mask is true
+    /// \headerfile cnl/simd_pack.h
+    template<typename T, std::size_t N>
+    CNL_NODISCARD bool any_of(simd_mask<T, N> const& mask)
+    {
+        for (std::size_t lane = 0; lane!=N; ++lane) {
+            if (mask[lane]) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// \brief returns true iff no lane of \c mask is true
+    /// \headerfile cnl/simd_pack.h
+    template<typename T, std::size_t N>
+    CNL_NODISCARD bool none_of(simd_mask<T, N> const& mask)
+    {
+        return !any_of(mask);
+    }
+
+    /// \brief returns the lanes of \c if_true where \c mask is true and of \c if_false otherwise
+    /// \headerfile cnl/simd_pack.h
+    template<typename T, std::size_t N, typename U>
+    CNL_NODISCARD simd_pack<U, N> select(
+            simd_mask<T, N> const& mask, simd_pack<U, N> const& if_true, simd_pack<U, N> const& if_false)
+    {
+        return _impl::simd_select<T, U, N>{}(mask, if_true, if_false);
+    }
+}
+
+#endif  // CNL_IMPL_SIMD_PACK_OPERATORS_H
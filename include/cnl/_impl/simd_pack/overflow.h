@@ -0,0 +1,353 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_SIMD_PACK_OVERFLOW_H)
+#define CNL_IMPL_SIMD_PACK_OVERFLOW_H
+
+#include "../../limits.h"
+#include "../config.h"
+#include "../operators/generic.h"
+#include "../operators/native_tag.h"
+#include "../overflow/generic.h"
+#include "../overflow/is_overflow_tag.h"
+#include "../overflow/native.h"
+#include "../overflow/saturated.h"
+#include "../overflow/saturated_batch.h"
+#include "../overflow/undefined.h"
+#include "../overflow/wants_generic_overflow_ops.h"
+#include "../type_traits/enable_if.h"
+#include "../type_traits/is_signed.h"
+#include "../type_traits/remove_signedness.h"
+#include "operators.h"
+#include "type.h"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        template<typename T, std::size_t N>
+        struct wants_generic_overflow_ops<simd_pack<T, N>> : std::false_type {
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::simd_overflow
+
+        // operations upon whole packs of lanes of type T which handle overflow as OverflowTag does;
+        // tags whose handlers have side effects, e.g. trapping_overflow_tag, have no specialization
+        template<class OverflowTag, typename T, class Enable = void>
+        struct simd_overflow;
+
+        template<class OverflowTag, typename T>
+        struct has_simd_overflow : std::false_type {
+        };
+
+        // native and undefined overflow: the operators of simd_pack, whose lanes wrap
+        template<class OverflowTag, typename T>
+        struct simd_overflow<
+                OverflowTag, T,
+                enable_if_t<std::is_same<OverflowTag, native_overflow_tag>::value
+                        || std::is_same<OverflowTag, undefined_overflow_tag>::value>> {
+            template<typename DestT, typename SrcT, std::size_t N>
+            CNL_NODISCARD static simd_pack<DestT, N> convert(simd_pack<SrcT, N> const& from)
+            {
+                return simd_pack<DestT, N>(from);
+            }
+
+            template<class Operator, std::size_t N>
+            CNL_NODISCARD static simd_pack<T, N> unary(simd_pack<T, N> const& rhs)
+            {
+                return Operator{}(rhs);
+            }
+
+            template<class Operator, typename LhsT, typename RhsT, std::size_t N>
+            CNL_NODISCARD static simd_common_pack_t<simd_pack<LhsT, N>, simd_pack<RhsT, N>> binary(
+                    simd_pack<LhsT, N> const& lhs, simd_pack<RhsT, N> const& rhs)
+            {
+                return Operator{}(lhs, rhs);
+            }
+
+            template<class Operator, std::size_t N, typename Rhs>
+            CNL_NODISCARD static simd_pack<T, N> shift(simd_pack<T, N> const& lhs, Rhs const& rhs)
+            {
+                return Operator{}(lhs, rhs);
+            }
+        };
+
+        template<typename T>
+        struct has_simd_overflow<native_overflow_tag, T> : std::true_type {
+        };
+
+        template<typename T>
+        struct has_simd_overflow<undefined_overflow_tag, T> : std::true_type {
+        };
+
+        // saturated overflow of integer lanes: lanes which overflow are replaced with the limit
+        // using comparisons and selection rather than branches
+        template<typename T>
+        struct simd_overflow<saturated_overflow_tag, T> {
+            template<std::size_t N>
+            using pack = simd_pack<T, N>;
+
+            template<std::size_t N>
+            CNL_NODISCARD static pack<N> max()
+            {
+                return pack<N>(numeric_limits<T>::max());
+            }
+
+            template<std::size_t N>
+            CNL_NODISCARD static pack<N> lowest()
+            {
+                return pack<N>(numeric_limits<T>::lowest());
+            }
+
+            // clamps the lanes of from to the range of DestT before converting them
+            template<typename DestT, typename SrcT, std::size_t N>
+            CNL_NODISCARD static simd_pack<DestT, N> convert(simd_pack<SrcT, N> const& from)
+            {
+                auto const upper = simd_pack<SrcT, N>(
+                        cnl::convert<saturated_overflow_tag, native_tag, SrcT>(numeric_limits<DestT>::max()));
+                auto const lower = simd_pack<SrcT, N>(
+                        cnl::convert<saturated_overflow_tag, native_tag, SrcT>(numeric_limits<DestT>::lowest()));
+                return simd_pack<DestT, N>(select(from>upper, upper, select(from<lower, lower, from)));
+            }
+
+            template<class Operator, std::size_t N>
+            CNL_NODISCARD static pack<N> unary(pack<N> const& rhs)
+            {
+                return std::is_same<Operator, minus_op>::value ? negate(rhs) : Operator{}(rhs);
+            }
+
+            // lanes of different types are first converted to the common type, as with simd_pack operators
+            template<class Operator, typename LhsT, typename RhsT, std::size_t N>
+            CNL_NODISCARD static pack<N> binary(simd_pack<LhsT, N> const& lhs, simd_pack<RhsT, N> const& rhs)
+            {
+                return binary(Operator{}, convert<T>(lhs), convert<T>(rhs));
+            }
+
+            // a lane is shifted only if the result is in range
+            template<class Operator, std::size_t N, typename Rhs>
+            CNL_NODISCARD static pack<N> shift(pack<N> const& lhs, Rhs const& rhs)
+            {
+                if (!std::is_same<Operator, shift_left_op>::value) {
+                    return Operator{}(lhs, rhs);
+                }
+
+                auto const upper = pack<N>(static_cast<T>(numeric_limits<T>::max() >> rhs));
+                auto const lower = pack<N>(static_cast<T>(numeric_limits<T>::lowest() >> rhs));
+                auto const positive = lhs>upper;
+                auto const negative = lhs<lower;
+                auto const in_range = select(positive, pack<N>(T{0}), select(negative, pack<N>(T{0}), lhs));
+                return select(positive, max<N>(), select(negative, lowest<N>(), pack<N>(in_range << rhs)));
+            }
+
+        private:
+            // the negation of the most negative value is the greatest value; of a positive unsigned value, zero
+            template<std::size_t N>
+            CNL_NODISCARD static pack<N> negate(pack<N> const& rhs)
+            {
+                using unsigned_pack = simd_pack<remove_signedness_t<T>, N>;
+                return is_signed<T>::value
+                       ? select(rhs==lowest<N>(), max<N>(), pack<N>(-unsigned_pack(rhs)))
+                       : pack<N>(T{0});
+            }
+
+            // add and subtract reuse the vector operators of cnl::saturated_add and cnl::saturated_subtract
+            template<class Operator, std::size_t N>
+            CNL_NODISCARD static pack<N> batch(pack<N> const& lhs, pack<N> const& rhs)
+            {
+                T lhs_lanes[N];  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+                T rhs_lanes[N];  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+                T result_lanes[N];  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+                lhs.store(lhs_lanes);
+                rhs.store(rhs_lanes);
+                saturated_batch<Operator, T>{}(lhs_lanes, rhs_lanes, result_lanes, N);
+                return pack<N>::load(result_lanes);
+            }
+
+            template<std::size_t N>
+            CNL_NODISCARD static pack<N> binary(add_op, pack<N> const& lhs, pack<N> const& rhs)
+            {
+                return batch<add_op>(lhs, rhs);
+            }
+
+            template<std::size_t N>
+            CNL_NODISCARD static pack<N> binary(subtract_op, pack<N> const& lhs, pack<N> const& rhs)
+            {
+                return batch<subtract_op>(lhs, rhs);
+            }
+
+            template<std::size_t N>
+            CNL_NODISCARD static pack<N> binary(multiply_op, pack<N> const& lhs, pack<N> const& rhs)
+            {
+                return batch<multiply_op>(lhs, rhs);
+            }
+
+            // only division of the most negative value by -1 overflows; division by -1 is negation
+            template<std::size_t N>
+            CNL_NODISCARD static pack<N> binary(divide_op, pack<N> const& lhs, pack<N> const& rhs)
+            {
+                if (!is_signed<T>::value) {
+                    return lhs/rhs;
+                }
+
+                auto const minus_one = pack<N>(static_cast<T>(-1));
+                auto const is_minus_one = rhs==minus_one;
+                return select(is_minus_one, negate(lhs), lhs/select(is_minus_one, pack<N>(T{1}), rhs));
+            }
+
+            // other operations do not overflow
+            template<class Operator, std::size_t N>
+            CNL_NODISCARD static pack<N> binary(Operator, pack<N> const& lhs, pack<N> const& rhs)
+            {
+                return Operator{}(lhs, rhs);
+            }
+        };
+
+        template<typename T>
+        struct has_simd_overflow<saturated_overflow_tag, T>
+                : std::integral_constant<bool, std::is_integral<T>::value && !std::is_same<T, bool>::value> {
+        };
+    }
+
+    // Where the overflow tag has no side effects, whole packs are operated upon by _impl::simd_overflow.
+    // Otherwise, the overflow of each lane is handled in turn by the scalar operators of the same overflow tags
+    // and the result of each lane is then converted back to the lane type, also according to the overflow tag.
+
+    template<class DestTag, class SrcTag, typename DestT, typename SrcT, std::size_t N>
+    struct convert_operator<
+            DestTag, SrcTag, simd_pack<DestT, N>, simd_pack<SrcT, N>,
+            _impl::enable_if_t<_impl::is_overflow_tag<DestTag>::value || _impl::is_overflow_tag<SrcTag>::value>> {
+        using _overflow_tag = _impl::common_overflow_tag_t<DestTag, SrcTag>;
+
+        CNL_NODISCARD simd_pack<DestT, N> operator()(simd_pack<SrcT, N> const& from) const
+        {
+            return convert(from, _impl::has_simd_overflow<_overflow_tag, DestT>{});
+        }
+
+    private:
+        CNL_NODISCARD static simd_pack<DestT, N> convert(simd_pack<SrcT, N> const& from, std::true_type)
+        {
+            return _impl::simd_overflow<_overflow_tag, DestT>::template convert<DestT>(from);
+        }
+
+        CNL_NODISCARD static simd_pack<DestT, N> convert(simd_pack<SrcT, N> const& from, std::false_type)
+        {
+            simd_pack<DestT, N> result;
+            for (std::size_t lane = 0; lane!=N; ++lane) {
+                result.set(lane, convert_operator<DestTag, SrcTag, DestT, SrcT>{}(from[lane]));
+            }
+            return result;
+        }
+    };
+
+    template<class DestTag, class SrcTag, typename DestT, std::size_t N, typename Source>
+    struct convert_operator<
+            DestTag, SrcTag, simd_pack<DestT, N>, Source,
+            _impl::enable_if_t<(_impl::is_overflow_tag<DestTag>::value || _impl::is_overflow_tag<SrcTag>::value)
+                    && _impl::is_simd_scalar<Source>::value>> {
+        CNL_NODISCARD simd_pack<DestT, N> operator()(Source const& from) const
+        {
+            return simd_pack<DestT, N>(convert_operator<DestTag, SrcTag, DestT, Source>{}(from));
+        }
+    };
+
+    template<class Operator, class OverflowTag, typename T, std::size_t N>
+    struct unary_operator<
+            Operator, OverflowTag, simd_pack<T, N>,
+            _impl::enable_if_t<_impl::is_overflow_tag<OverflowTag>::value
+                    && _impl::has_simd_overflow<OverflowTag, T>::value>> {
+        CNL_NODISCARD simd_pack<T, N> operator()(simd_pack<T, N> const& rhs) const
+        {
+            return _impl::simd_overflow<OverflowTag, T>::template unary<Operator>(rhs);
+        }
+    };
+
+    template<class Operator, class OverflowTag, typename T, std::size_t N>
+    struct unary_operator<
+            Operator, OverflowTag, simd_pack<T, N>,
+            _impl::enable_if_t<_impl::is_overflow_tag<OverflowTag>::value
+                    && !_impl::has_simd_overflow<OverflowTag, T>::value>> {
+        using lane_result = decltype(unary_operator<Operator, OverflowTag, T>{}(std::declval<T>()));
+
+        CNL_NODISCARD simd_pack<T, N> operator()(simd_pack<T, N> const& rhs) const
+        {
+            simd_pack<T, N> result;
+            for (std::size_t lane = 0; lane!=N; ++lane) {
+                result.set(lane, convert_operator<OverflowTag, OverflowTag, T, lane_result>{}(
+                        unary_operator<Operator, OverflowTag, T>{}(rhs[lane])));
+            }
+            return result;
+        }
+    };
+
+    template<class Operator, class LhsTag, class RhsTag, typename LhsT, typename RhsT, std::size_t N>
+    struct binary_operator<
+            Operator, LhsTag, RhsTag, simd_pack<LhsT, N>, simd_pack<RhsT, N>,
+            _impl::enable_if_t<_impl::is_overflow_tag<LhsTag>::value && _impl::is_overflow_tag<RhsTag>::value>> {
+        using result_type = _impl::simd_common_pack_t<simd_pack<LhsT, N>, simd_pack<RhsT, N>>;
+        using lane_type = typename result_type::value_type;
+        using _overflow_tag = _impl::common_overflow_tag_t<LhsTag, RhsTag>;
+
+        CNL_NODISCARD result_type operator()(simd_pack<LhsT, N> const& lhs, simd_pack<RhsT, N> const& rhs) const
+        {
+            return apply(lhs, rhs, _impl::has_simd_overflow<_overflow_tag, lane_type>{});
+        }
+
+    private:
+        CNL_NODISCARD static result_type apply(
+                simd_pack<LhsT, N> const& lhs, simd_pack<RhsT, N> const& rhs, std::true_type)
+        {
+            return _impl::simd_overflow<_overflow_tag, lane_type>::template binary<Operator>(lhs, rhs);
+        }
+
+        CNL_NODISCARD static result_type apply(
+                simd_pack<LhsT, N> const& lhs, simd_pack<RhsT, N> const& rhs, std::false_type)
+        {
+            using lane_operator = binary_operator<Operator, LhsTag, RhsTag, LhsT, RhsT>;
+            using lane_result = decltype(lane_operator{}(std::declval<LhsT>(), std::declval<RhsT>()));
+
+            result_type result;
+            for (std::size_t lane = 0; lane!=N; ++lane) {
+                result.set(lane, convert_operator<LhsTag, RhsTag, lane_type, lane_result>{}(
+                        lane_operator{}(lhs[lane], rhs[lane])));
+            }
+            return result;
+        }
+    };
+
+    template<class Operator, class LhsTag, class RhsTag, typename T, std::size_t N, typename Rhs>
+    struct shift_operator<
+            Operator, LhsTag, RhsTag, simd_pack<T, N>, Rhs,
+            _impl::enable_if_t<_impl::is_overflow_tag<LhsTag>::value && _impl::is_simd_scalar<Rhs>::value>> {
+        CNL_NODISCARD simd_pack<T, N> operator()(simd_pack<T, N> const& lhs, Rhs const& rhs) const
+        {
+            return apply(lhs, rhs, _impl::has_simd_overflow<LhsTag, T>{});
+        }
+
+    private:
+        CNL_NODISCARD static simd_pack<T, N> apply(simd_pack<T, N> const& lhs, Rhs const& rhs, std::true_type)
+        {
+            return _impl::simd_overflow<LhsTag, T>::template shift<Operator>(lhs, rhs);
+        }
+
+        CNL_NODISCARD static simd_pack<T, N> apply(simd_pack<T, N> const& lhs, Rhs const& rhs, std::false_type)
+        {
+            using lane_operator = shift_operator<Operator, LhsTag, RhsTag, T, Rhs>;
+            using lane_result = decltype(lane_operator{}(std::declval<T>(), std::declval<Rhs>()));
+
+            simd_pack<T, N> result;
+            for (std::size_t lane = 0; lane!=N; ++lane) {
+                result.set(lane, convert_operator<LhsTag, LhsTag, T, lane_result>{}(lane_operator{}(lhs[lane], rhs)));
+            }
+            return result;
+        }
+    };
+}
+
+#endif  // CNL_IMPL_SIMD_PACK_OVERFLOW_H
@@ -0,0 +1,234 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_SIMD_PACK_TYPE_H)
+#define CNL_IMPL_SIMD_PACK_TYPE_H
+
+#include "../../constant.h"
+#include "../config.h"
+#include "../num_traits/set_digits.h"
+#include "../type_traits/enable_if.h"
+#include "../type_traits/is_integral.h"
+#include "forward_declaration.h"
+
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::is_simd_vectorizable
+
+        // true iff N lanes of T are stored in a GCC vector
+        template<typename T, std::size_t N>
+        struct is_simd_vectorizable : std::integral_constant<bool,
+#if defined(CNL_VECTOR_EXTENSIONS_ENABLED)
+                (std::is_integral<T>::value || std::is_floating_point<T>::value)
+                        && !std::is_same<T, bool>::value
+                        && sizeof(T)<=8
+                        && (N>1) && (N & (N-1))==0
+#else
+                false
+#endif
+        > {
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::simd_storage
+
+        template<typename T, std::size_t N, bool IsVector = is_simd_vectorizable<T, N>::value>
+        struct simd_storage {
+            using type = std::array<T, N>;
+        };
+
+#if defined(CNL_VECTOR_EXTENSIONS_ENABLED)
+        template<typename T, std::size_t N>
+        struct simd_storage<T, N, true> {
+            typedef T type __attribute__((vector_size(sizeof(T)*N)));  // NOLINT(modernize-use-using)
+        };
+#endif
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::is_simd_scalar
+
+        // true iff a value of type T can be broadcast to every lane of a simd_pack
+        template<typename T>
+        struct is_simd_scalar : std::integral_constant<bool,
+                is_integral<T>::value || std::is_floating_point<T>::value || is_constant<T>::value> {
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::simd_mask_lane
+
+        // signed integer of the same width as T; each lane of a mask is all ones or all zeros
+        template<typename T>
+        struct simd_mask_lane : set_digits<signed char, sizeof(T)*CHAR_BIT-1> {
+        };
+    }
+
+    /// \brief fixed-size pack of arithmetic values which are operated upon lane-wise
+    ///
+    /// \tparam T the type of each lane, e.g. a fundamental integer or floating-point type
+    /// \tparam N the number of lanes
+    ///
+    /// When \c CNL_VECTOR_EXTENSIONS_ENABLED is defined and \c N is a power of two,
+    /// lanes are stored in a GCC vector and arithmetic operators map onto SIMD instructions.
+    /// Otherwise, lanes are stored in an array and operated upon in loops.
+    ///
+    /// Unlike fundamental integers, operands are not promoted, i.e. the lanes of the sum of two
+    /// `simd_pack<int16_t, N>` are of type `int16_t`. Comparison operators return a \ref cnl::simd_mask.
+    ///
+    /// \headerfile cnl/simd_pack.h
+    /// \sa cnl::simd_mask, cnl::scaled_integer, cnl::elastic_integer, cnl::overflow_integer
+    template<typename T, std::size_t N>
+    class simd_pack {
+        static_assert(N>0, "simd_pack must have at least one lane");
+    public:
+        using value_type = T;
+        using mask_type = simd_mask<T, N>;
+        using storage_type = typename _impl::simd_storage<T, N>::type;
+
+        /// returns the number of lanes
+        CNL_NODISCARD static constexpr std::size_t size() noexcept
+        {
+            return N;
+        }
+
+        simd_pack() = default;
+
+        /// initializes every lane with \c value
+        template<typename Value, _impl::enable_if_t<_impl::is_simd_scalar<Value>::value, int> Dummy = 0>
+        simd_pack(Value const& value)  // NOLINT(hicpp-explicit-conversions, google-explicit-constructor)
+                : _lanes()
+        {
+            for (std::size_t lane = 0; lane!=N; ++lane) {
+                _lanes[lane] = static_cast<T>(value);
+            }
+        }
+
+        /// initializes each lane with the corresponding value
+        template<
+                typename ... Values,
+                _impl::enable_if_t<(N>1) && sizeof...(Values)==N, int> Dummy = 0>
+        simd_pack(Values const& ... values)  // NOLINT(hicpp-explicit-conversions, google-explicit-constructor)
+                : _lanes()
+        {
+            T const lanes[N] = {static_cast<T>(values)...};  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+            for (std::size_t lane = 0; lane!=N; ++lane) {
+                _lanes[lane] = lanes[lane];
+            }
+        }
+
+        /// converts each lane of \c from
+        template<typename U>
+        explicit simd_pack(simd_pack<U, N> const& from)
+                : _lanes()
+        {
+            for (std::size_t lane = 0; lane!=N; ++lane) {
+                _lanes[lane] = static_cast<T>(from[lane]);
+            }
+        }
+
+        explicit simd_pack(storage_type const& lanes)
+                : _lanes(lanes)
+        {
+        }
+
+        /// reads \ref size() values from \c from, which need not be aligned
+        CNL_NODISCARD static simd_pack load(T const* from)
+        {
+            simd_pack pack;
+            std::memcpy(&pack._lanes, from, sizeof(pack._lanes));
+            return pack;
+        }
+
+        /// writes \ref size() values to \c to, which need not be aligned
+        void store(T* to) const
+        {
+            std::memcpy(to, &_lanes, sizeof(_lanes));
+        }
+
+        /// returns the value of the given lane
+        CNL_NODISCARD T operator[](std::size_t lane) const
+        {
+            return _lanes[lane];
+        }
+
+        /// assigns \c value to the given lane
+        void set(std::size_t lane, T const& value)
+        {
+            _lanes[lane] = value;
+        }
+
+        CNL_NODISCARD storage_type const& data() const noexcept
+        {
+            return _lanes;
+        }
+
+    private:
+        storage_type _lanes;
+    };
+
+    /// \brief fixed-size pack of boolean values produced by comparing \ref cnl::simd_pack objects
+    ///
+    /// \headerfile cnl/simd_pack.h
+    /// \sa cnl::all_of, cnl::any_of, cnl::none_of, cnl::select
+    template<typename T, std::size_t N>
+    class simd_mask {
+        using lane_type = typename _impl::simd_mask_lane<T>::type;
+    public:
+        using value_type = bool;
+        using storage_type = typename _impl::simd_storage<lane_type, N>::type;
+
+        /// returns the number of lanes
+        CNL_NODISCARD static constexpr std::size_t size() noexcept
+        {
+            return N;
+        }
+
+        simd_mask() = default;
+
+        /// initializes every lane with \c value
+        explicit simd_mask(bool value)
+                : _lanes()
+        {
+            for (std::size_t lane = 0; lane!=N; ++lane) {
+                set(lane, value);
+            }
+        }
+
+        explicit simd_mask(storage_type const& lanes)
+                : _lanes(lanes)
+        {
+        }
+
+        /// returns the value of the given lane
+        CNL_NODISCARD bool operator[](std::size_t lane) const
+        {
+            return _lanes[lane]!=0;
+        }
+
+        /// assigns \c value to the given lane
+        void set(std::size_t lane, bool value)
+        {
+            _lanes[lane] = static_cast<lane_type>(value ? ~lane_type{0} : lane_type{0});
+        }
+
+        CNL_NODISCARD storage_type const& data() const noexcept
+        {
+            return _lanes;
+        }
+
+    private:
+        storage_type _lanes;
+    };
+}
+
+#endif  // CNL_IMPL_SIMD_PACK_TYPE_H
@@ -0,0 +1,41 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_SOFT_FLOAT_CONVERT_OPERATOR_H)
+#define CNL_IMPL_SOFT_FLOAT_CONVERT_OPERATOR_H
+
+#include "../config.h"
+#include "../operators/generic.h"
+#include "../scaled/power.h"
+#include "../type_traits/remove_signedness.h"
+#include "type.h"
+
+/// compositional numeric library
+namespace cnl {
+    ////////////////////////////////////////////////////////////////////////////////
+    // conversion from soft_float
+
+    // rounds as RoundingTag; overflow is undefined
+    template<int DestExponent, typename Dest, int MantissaDigits, int ExponentDigits, class RoundingTag>
+    struct convert_operator<
+            power<DestExponent, 2>,
+            power<0, 2>,
+            Dest,
+            soft_float<MantissaDigits, ExponentDigits, RoundingTag>> {
+        CNL_NODISCARD constexpr Dest operator()(
+                soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& from) const
+        {
+            using magnitude = remove_signedness_t<Dest>;
+            return from.negative()
+                   ? static_cast<Dest>(-static_cast<Dest>(_impl::soft_float_rescale<RoundingTag, magnitude>(
+                            from.mantissa(), DestExponent-from.exponent())))
+                   : static_cast<Dest>(_impl::soft_float_rescale<RoundingTag, magnitude>(
+                            from.mantissa(), DestExponent-from.exponent()));
+        }
+    };
+}
+
+#endif  // CNL_IMPL_SOFT_FLOAT_CONVERT_OPERATOR_H
@@ -0,0 +1,114 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_SOFT_FLOAT_NUMERIC_LIMITS_H)
+#define CNL_IMPL_SOFT_FLOAT_NUMERIC_LIMITS_H
+
+#include "../../limits.h"
+#include "../../rounding.h"
+#include "../config.h"
+#include "type.h"
+
+#include <limits>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    ////////////////////////////////////////////////////////////////////////////////
+    // cnl::numeric_limits<soft_float>
+
+    template<int MantissaDigits, int ExponentDigits, class RoundingTag>
+    struct numeric_limits<soft_float<MantissaDigits, ExponentDigits, RoundingTag>> {
+        using _value_type = soft_float<MantissaDigits, ExponentDigits, RoundingTag>;
+
+        static constexpr bool is_specialized = true;
+        static constexpr bool is_signed = true;
+        static constexpr bool is_integer = false;
+        static constexpr bool is_exact = false;
+        static constexpr bool has_infinity = false;
+        static constexpr bool has_quiet_NaN = false;
+        static constexpr bool has_signaling_NaN = false;
+        static constexpr std::float_denorm_style has_denorm = std::denorm_absent;
+        static constexpr bool has_denorm_loss = false;
+        static constexpr std::float_round_style round_style =
+                std::is_same<RoundingTag, native_rounding_tag>::value ? std::round_toward_zero : std::round_to_nearest;
+        static constexpr bool is_iec559 = false;
+        static constexpr bool is_bounded = true;
+        static constexpr bool is_modulo = false;
+        static constexpr int digits = MantissaDigits;
+        static constexpr int digits10 = (MantissaDigits-1)*30103/100000;
+        static constexpr int max_digits10 = 2+MantissaDigits*30103/100000;
+        static constexpr int radix = 2;
+        static constexpr int min_exponent = 3-(1 << (ExponentDigits-1));
+        static constexpr int min_exponent10 = (min_exponent-1)*30103/100000;
+        static constexpr int max_exponent = 1 << (ExponentDigits-1);
+        static constexpr int max_exponent10 = max_exponent*30103/100000;
+        static constexpr bool traps = false;
+        static constexpr bool tinyness_before = false;
+
+        CNL_NODISCARD static constexpr _value_type min() noexcept
+        {
+            return _value_type(false, 1u, min_exponent-1);
+        }
+
+        CNL_NODISCARD static constexpr _value_type max() noexcept
+        {
+            return _value_type(false, 1u, max_exponent);
+        }
+
+        CNL_NODISCARD static constexpr _value_type lowest() noexcept
+        {
+            return _value_type(true, 1u, max_exponent);
+        }
+
+        CNL_NODISCARD static constexpr _value_type epsilon() noexcept
+        {
+            return _value_type(false, 1u, 1-MantissaDigits);
+        }
+
+        CNL_NODISCARD static constexpr _value_type round_error() noexcept
+        {
+            return _value_type(false, 1u, std::is_same<RoundingTag, native_rounding_tag>::value ? 0 : -1);
+        }
+
+        CNL_NODISCARD static constexpr _value_type infinity() noexcept
+        {
+            return _value_type{};
+        }
+
+        CNL_NODISCARD static constexpr _value_type quiet_NaN() noexcept
+        {
+            return _value_type{};
+        }
+
+        CNL_NODISCARD static constexpr _value_type signaling_NaN() noexcept
+        {
+            return _value_type{};
+        }
+
+        CNL_NODISCARD static constexpr _value_type denorm_min() noexcept
+        {
+            return min();
+        }
+    };
+}
+
+namespace std {
+    ////////////////////////////////////////////////////////////////////////////////
+    // std::numeric_limits specialization for soft_float
+
+    template<int MantissaDigits, int ExponentDigits, class RoundingTag>
+    struct numeric_limits<cnl::soft_float<MantissaDigits, ExponentDigits, RoundingTag>>
+            : cnl::numeric_limits<cnl::soft_float<MantissaDigits, ExponentDigits, RoundingTag>> {
+    };
+
+    template<int MantissaDigits, int ExponentDigits, class RoundingTag>
+    struct numeric_limits<cnl::soft_float<MantissaDigits, ExponentDigits, RoundingTag> const>
+            : cnl::numeric_limits<cnl::soft_float<MantissaDigits, ExponentDigits, RoundingTag>> {
+    };
+}
+
+#endif  // CNL_IMPL_SOFT_FLOAT_NUMERIC_LIMITS_H
@@ -0,0 +1,342 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_SOFT_FLOAT_OPERATORS_H)
+#define CNL_IMPL_SOFT_FLOAT_OPERATORS_H
+
+#include "../../constant.h"
+#include "../../elastic_integer.h"
+#include "../../wide_integer.h"
+#include "../common.h"
+#include "../config.h"
+#include "../type_traits/enable_if.h"
+#include "../type_traits/is_integral.h"
+#include "type.h"
+
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::soft_float_less_magnitude
+
+        template<int MantissaDigits, int ExponentDigits, class RoundingTag>
+        CNL_NODISCARD constexpr bool soft_float_less_magnitude(
+                soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& lhs,
+                soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& rhs)
+        {
+            return !lhs.mantissa()
+                   ? !!rhs.mantissa()
+                   : !!rhs.mantissa()
+                     && (lhs.exponent()<rhs.exponent()
+                             || (lhs.exponent()==rhs.exponent() && lhs.mantissa()<rhs.mantissa()));
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::soft_float_add
+
+        // shifts value right, setting the lowest bit of the result if any set bits are lost
+        template<typename Field>
+        CNL_NODISCARD constexpr Field soft_float_sticky_shift(Field const& value, int shift)
+        {
+            return (shift>=digits<Field>::value)
+                   ? Field{value!=Field{0}}
+                   : static_cast<Field>((value >> shift) | Field{((value >> shift) << shift)!=value});
+        }
+
+        // mantissa of small, with three extra bits, aligned with a mantissa whose exponent is greater by shift;
+        // a zero mantissa has an exponent of zero so the shift may be negative
+        template<typename Field, typename Mantissa>
+        CNL_NODISCARD constexpr Field soft_float_align(Mantissa const& small, int shift)
+        {
+            return soft_float_sticky_shift(static_cast<Field>(Field{small} << 3), max(shift, 0));
+        }
+
+        template<typename Field>
+        CNL_NODISCARD constexpr Field soft_float_add_fields(bool subtract, Field const& big, Field const& small)
+        {
+            return static_cast<Field>(subtract ? big-small : big+small);
+        }
+
+        // adds the value, big, to small, whose magnitude is no greater
+        template<int MantissaDigits, int ExponentDigits, class RoundingTag>
+        CNL_NODISCARD constexpr soft_float<MantissaDigits, ExponentDigits, RoundingTag> soft_float_add_ordered(
+                bool big_negative, soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& big,
+                bool small_negative, soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& small)
+        {
+            using field = soft_float_field_t<MantissaDigits>;
+            return soft_float<MantissaDigits, ExponentDigits, RoundingTag>(
+                    big_negative,
+                    soft_float_add_fields(
+                            big_negative!=small_negative,
+                            static_cast<field>(field{big.mantissa()} << 3),
+                            soft_float_align<field>(small.mantissa(), big.exponent()-small.exponent())),
+                    big.exponent()-3);
+        }
+
+        // adds lhs to rhs, whose sign is given by rhs_negative
+        template<int MantissaDigits, int ExponentDigits, class RoundingTag>
+        CNL_NODISCARD constexpr soft_float<MantissaDigits, ExponentDigits, RoundingTag> soft_float_add(
+                soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& lhs,
+                soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& rhs, bool rhs_negative)
+        {
+            return soft_float_less_magnitude(lhs, rhs)
+                   ? soft_float_add_ordered(rhs_negative, rhs, lhs.negative(), lhs)
+                   : soft_float_add_ordered(lhs.negative(), lhs, rhs_negative, rhs);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::soft_float_wide_t
+
+        // type with which the mantissas of products and quotients are calculated
+        template<int Digits>
+        using soft_float_wide_t = elastic_integer<Digits, wide_integer<Digits, unsigned>>;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::soft_float_multiply
+
+        // product of two mantissas, which has 2*MantissaDigits digits, reduced to a field with a sticky bit
+        template<int MantissaDigits, typename Product>
+        CNL_NODISCARD constexpr soft_float_field_t<MantissaDigits> soft_float_product_field(Product const& product)
+        {
+            return static_cast<soft_float_field_t<MantissaDigits>>(
+                    static_cast<soft_float_field_t<MantissaDigits>>(product >> constant<MantissaDigits-3>{})
+                    | soft_float_field_t<MantissaDigits>{
+                            ((product >> constant<MantissaDigits-3>{}) << constant<MantissaDigits-3>{})!=product});
+        }
+
+        template<int MantissaDigits, int ExponentDigits, class RoundingTag>
+        CNL_NODISCARD constexpr soft_float<MantissaDigits, ExponentDigits, RoundingTag> soft_float_multiply(
+                soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& lhs,
+                soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& rhs)
+        {
+            return soft_float<MantissaDigits, ExponentDigits, RoundingTag>(
+                    lhs.negative()!=rhs.negative(),
+                    soft_float_product_field<MantissaDigits>(
+                            soft_float_wide_t<MantissaDigits>{lhs.mantissa()}
+                            *soft_float_wide_t<MantissaDigits>{rhs.mantissa()}),
+                    lhs.exponent()+rhs.exponent()+MantissaDigits-3);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::soft_float_divide
+
+        // quotient of a dividend, shifted left by MantissaDigits+3, and a divisor,
+        // which has MantissaDigits+3 or MantissaDigits+4 digits, plus a sticky bit
+        template<int MantissaDigits, typename Dividend, typename Divisor>
+        CNL_NODISCARD constexpr soft_float_field_t<MantissaDigits> soft_float_quotient_field(
+                Dividend const& dividend, Divisor const& divisor)
+        {
+            return static_cast<soft_float_field_t<MantissaDigits>>(
+                    static_cast<soft_float_field_t<MantissaDigits>>(dividend/divisor)
+                    | soft_float_field_t<MantissaDigits>{(dividend%divisor)!=Dividend{0}});
+        }
+
+        // division by zero saturates
+        template<int MantissaDigits, int ExponentDigits, class RoundingTag>
+        CNL_NODISCARD constexpr soft_float<MantissaDigits, ExponentDigits, RoundingTag> soft_float_divide(
+                soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& lhs,
+                soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& rhs)
+        {
+            using dividend = wide_integer<MantissaDigits*2+3, unsigned>;
+            return !rhs.mantissa()
+                   ? soft_float<MantissaDigits, ExponentDigits, RoundingTag>(
+                            lhs.negative(), 1u,
+                            soft_float_max_exponent<MantissaDigits, ExponentDigits>()+MantissaDigits)
+                   : soft_float<MantissaDigits, ExponentDigits, RoundingTag>(
+                            lhs.negative()!=rhs.negative(),
+                            soft_float_quotient_field<MantissaDigits>(
+                                    dividend{lhs.mantissa()} << (MantissaDigits+3), dividend{rhs.mantissa()}),
+                            lhs.exponent()-rhs.exponent()-(MantissaDigits+3));
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::is_soft_float_operand
+
+        // arithmetic types which soft_float operators convert to soft_float
+        template<typename S>
+        struct is_soft_float_operand
+                : std::integral_constant<bool, std::is_floating_point<S>::value || is_integral<S>::value> {
+        };
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // unary operators
+
+    template<int MantissaDigits, int ExponentDigits, class RoundingTag>
+    CNL_NODISCARD constexpr soft_float<MantissaDigits, ExponentDigits, RoundingTag> operator+(
+            soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& operand)
+    {
+        return operand;
+    }
+
+    template<int MantissaDigits, int ExponentDigits, class RoundingTag>
+    CNL_NODISCARD constexpr soft_float<MantissaDigits, ExponentDigits, RoundingTag> operator-(
+            soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& operand)
+    {
+        return soft_float<MantissaDigits, ExponentDigits, RoundingTag>(
+                !operand.negative(), operand.mantissa(), operand.exponent());
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // binary arithmetic operators
+
+    template<int MantissaDigits, int ExponentDigits, class RoundingTag>
+    CNL_NODISCARD constexpr soft_float<MantissaDigits, ExponentDigits, RoundingTag> operator+(
+            soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& lhs,
+            soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& rhs)
+    {
+        return _impl::soft_float_add(lhs, rhs, rhs.negative());
+    }
+
+    template<int MantissaDigits, int ExponentDigits, class RoundingTag>
+    CNL_NODISCARD constexpr soft_float<MantissaDigits, ExponentDigits, RoundingTag> operator-(
+            soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& lhs,
+            soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& rhs)
+    {
+        return _impl::soft_float_add(lhs, rhs, !rhs.negative());
+    }
+
+    template<int MantissaDigits, int ExponentDigits, class RoundingTag>
+    CNL_NODISCARD constexpr soft_float<MantissaDigits, ExponentDigits, RoundingTag> operator*(
+            soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& lhs,
+            soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& rhs)
+    {
+        return _impl::soft_float_multiply(lhs, rhs);
+    }
+
+    template<int MantissaDigits, int ExponentDigits, class RoundingTag>
+    CNL_NODISCARD constexpr soft_float<MantissaDigits, ExponentDigits, RoundingTag> operator/(
+            soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& lhs,
+            soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& rhs)
+    {
+        return _impl::soft_float_divide(lhs, rhs);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // comparison operators
+
+    template<int MantissaDigits, int ExponentDigits, class RoundingTag>
+    CNL_NODISCARD constexpr bool operator==(
+            soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& lhs,
+            soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& rhs)
+    {
+        return lhs.negative()==rhs.negative() && lhs.mantissa()==rhs.mantissa() && lhs.exponent()==rhs.exponent();
+    }
+
+    template<int MantissaDigits, int ExponentDigits, class RoundingTag>
+    CNL_NODISCARD constexpr bool operator!=(
+            soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& lhs,
+            soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& rhs)
+    {
+        return !(lhs==rhs);
+    }
+
+    template<int MantissaDigits, int ExponentDigits, class RoundingTag>
+    CNL_NODISCARD constexpr bool operator<(
+            soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& lhs,
+            soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& rhs)
+    {
+        return (lhs.negative()!=rhs.negative())
+               ? lhs.negative()
+               : lhs.negative()
+                 ? _impl::soft_float_less_magnitude(rhs, lhs)
+                 : _impl::soft_float_less_magnitude(lhs, rhs);
+    }
+
+    template<int MantissaDigits, int ExponentDigits, class RoundingTag>
+    CNL_NODISCARD constexpr bool operator>(
+            soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& lhs,
+            soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& rhs)
+    {
+        return rhs<lhs;
+    }
+
+    template<int MantissaDigits, int ExponentDigits, class RoundingTag>
+    CNL_NODISCARD constexpr bool operator<=(
+            soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& lhs,
+            soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& rhs)
+    {
+        return !(rhs<lhs);
+    }
+
+    template<int MantissaDigits, int ExponentDigits, class RoundingTag>
+    CNL_NODISCARD constexpr bool operator>=(
+            soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& lhs,
+            soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& rhs)
+    {
+        return !(lhs<rhs);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // operators taking an arithmetic operand
+
+    // the arithmetic operand is first converted to soft_float
+#define CNL_IMPL_SOFT_FLOAT_MIXED_OPERATOR(OP) \
+    template<int MantissaDigits, int ExponentDigits, class RoundingTag, typename Rhs, \
+            _impl::enable_if_t<_impl::is_soft_float_operand<Rhs>::value, int> = 0> \
+    CNL_NODISCARD constexpr auto operator OP( \
+            soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& lhs, Rhs const& rhs) \
+    -> decltype(lhs OP soft_float<MantissaDigits, ExponentDigits, RoundingTag>(rhs)) \
+    { \
+        return lhs OP soft_float<MantissaDigits, ExponentDigits, RoundingTag>(rhs); \
+    } \
+    \
+    template<typename Lhs, int MantissaDigits, int ExponentDigits, class RoundingTag, \
+            _impl::enable_if_t<_impl::is_soft_float_operand<Lhs>::value, int> = 0> \
+    CNL_NODISCARD constexpr auto operator OP( \
+            Lhs const& lhs, soft_float<MantissaDigits, ExponentDigits, RoundingTag> const& rhs) \
+    -> decltype(soft_float<MantissaDigits, ExponentDigits, RoundingTag>(lhs) OP rhs) \
+    { \
+        return soft_float<MantissaDigits, ExponentDigits, RoundingTag>(lhs) OP rhs; \
+    }
+
+    CNL_IMPL_SOFT_FLOAT_MIXED_OPERATOR(+)
+
+    CNL_IMPL_SOFT_FLOAT_MIXED_OPERATOR(-)
+
+    CNL_IMPL_SOFT_FLOAT_MIXED_OPERATOR(*)
+
+    CNL_IMPL_SOFT_FLOAT_MIXED_OPERATOR(/)
+
+    CNL_IMPL_SOFT_FLOAT_MIXED_OPERATOR(==)
+
+    CNL_IMPL_SOFT_FLOAT_MIXED_OPERATOR(!=)
+
+    CNL_IMPL_SOFT_FLOAT_MIXED_OPERATOR(<)
+
+    CNL_IMPL_SOFT_FLOAT_MIXED_OPERATOR(>)
+
+    CNL_IMPL_SOFT_FLOAT_MIXED_OPERATOR(<=)
+
+    CNL_IMPL_SOFT_FLOAT_MIXED_OPERATOR(>=)
+
+#undef CNL_IMPL_SOFT_FLOAT_MIXED_OPERATOR
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // compound assignment operators
+
+#define CNL_IMPL_SOFT_FLOAT_COMPOUND_ASSIGNMENT_OPERATOR(OP, COMPOUND) \
+    template<int MantissaDigits, int ExponentDigits, class RoundingTag, typename Rhs> \
+    CNL_RELAXED_CONSTEXPR soft_float<MantissaDigits, ExponentDigits, RoundingTag>& operator COMPOUND( \
+            soft_float<MantissaDigits, ExponentDigits, RoundingTag>& lhs, Rhs const& rhs) \
+    { \
+        return lhs = lhs OP rhs; \
+    }
+
+    CNL_IMPL_SOFT_FLOAT_COMPOUND_ASSIGNMENT_OPERATOR(+, +=)
+
+    CNL_IMPL_SOFT_FLOAT_COMPOUND_ASSIGNMENT_OPERATOR(-, -=)
+
+    CNL_IMPL_SOFT_FLOAT_COMPOUND_ASSIGNMENT_OPERATOR(*, *=)
+
+    CNL_IMPL_SOFT_FLOAT_COMPOUND_ASSIGNMENT_OPERATOR(/, /=)
+
+#undef CNL_IMPL_SOFT_FLOAT_COMPOUND_ASSIGNMENT_OPERATOR
+}
+
+#endif  // CNL_IMPL_SOFT_FLOAT_OPERATORS_H
@@ -0,0 +1,337 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_SOFT_FLOAT_TYPE_H)
+#define CNL_IMPL_SOFT_FLOAT_TYPE_H
+
+#include "../../bit.h"
+#include "../../limits.h"
+#include "../../rounding.h"
+#include "../common.h"
+#include "../config.h"
+#include "../num_traits/digits.h"
+#include "../num_traits/set_digits.h"
+#include "../num_traits/to_rep.h"
+#include "../scaled/power.h"
+#include "../scaled_integer/type.h"
+#include "../type_traits/enable_if.h"
+#include "../type_traits/is_integral.h"
+#include "../type_traits/is_signed.h"
+#include "../type_traits/remove_signedness.h"
+
+#include <cmath>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    template<int MantissaDigits, int ExponentDigits, class RoundingTag>
+    class soft_float;
+
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::soft_float_mantissa_t
+
+        // type in which soft_float stores its mantissa
+        template<int MantissaDigits>
+        using soft_float_mantissa_t = set_digits_t<unsigned, MantissaDigits>;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::soft_float_field_t
+
+        // type in which a mantissa is held with three extra low-order bits (guard, round and sticky)
+        // and a carry bit while it is added, subtracted or normalized
+        template<int MantissaDigits>
+        using soft_float_field_t = set_digits_t<unsigned, MantissaDigits+4>;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::soft_float_max_exponent / soft_float_min_exponent
+
+        // greatest exponent of a soft_float, i.e. that of the least significant bit of its greatest value
+        template<int MantissaDigits, int ExponentDigits>
+        CNL_NODISCARD constexpr int soft_float_max_exponent()
+        {
+            return (1 << (ExponentDigits-1))-MantissaDigits;
+        }
+
+        // least exponent of a non-zero soft_float; as with IEEE 754 binary formats,
+        // the smallest normal value is two to the power of 2-2^(ExponentDigits-1)
+        template<int MantissaDigits, int ExponentDigits>
+        CNL_NODISCARD constexpr int soft_float_min_exponent()
+        {
+            return 3-(1 << (ExponentDigits-1))-MantissaDigits;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::soft_float_parts
+
+        // sign, mantissa and exponent of a normalized soft_float
+        template<typename Mantissa>
+        struct soft_float_parts {
+            bool negative;
+            Mantissa mantissa;
+            int exponent;
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::soft_float_round
+
+        // divides a magnitude by two to the power of shift, where 0<shift<=digits<Integer>
+        template<class RoundingTag>
+        struct soft_float_round;
+
+        // rounds toward zero
+        template<>
+        struct soft_float_round<native_rounding_tag> {
+            template<typename Integer>
+            CNL_NODISCARD constexpr Integer operator()(Integer const& magnitude, int shift) const
+            {
+                return static_cast<Integer>((magnitude >> (shift-1)) >> 1);
+            }
+        };
+
+        // rounds to nearest with ties away from zero
+        template<>
+        struct soft_float_round<nearest_rounding_tag> {
+            template<typename Integer>
+            CNL_NODISCARD constexpr Integer operator()(Integer const& magnitude, int shift) const
+            {
+                return static_cast<Integer>(((magnitude >> (shift-1)) >> 1)+((magnitude >> (shift-1)) & Integer{1}));
+            }
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::soft_float_normalize
+
+        // saturates an exponent which is too great and flushes to zero an exponent which is too small
+        template<typename Mantissa, int MantissaDigits, int ExponentDigits>
+        CNL_NODISCARD constexpr soft_float_parts<Mantissa> soft_float_clamp(
+                bool negative, Mantissa const& mantissa, int exponent)
+        {
+            return (exponent>soft_float_max_exponent<MantissaDigits, ExponentDigits>())
+                   ? soft_float_parts<Mantissa>{
+                            negative,
+                            static_cast<Mantissa>((((Mantissa{1} << (MantissaDigits-1))-1) << 1)+1),
+                            soft_float_max_exponent<MantissaDigits, ExponentDigits>()}
+                   : (exponent<soft_float_min_exponent<MantissaDigits, ExponentDigits>())
+                     ? soft_float_parts<Mantissa>{false, Mantissa{0}, 0}
+                     : soft_float_parts<Mantissa>{negative, mantissa, exponent};
+        }
+
+        // rounding may carry into bit, MantissaDigits, in which case the mantissa is halved
+        template<typename Mantissa, int MantissaDigits, int ExponentDigits, typename Integer>
+        CNL_NODISCARD constexpr soft_float_parts<Mantissa> soft_float_carry(
+                bool negative, Integer const& rounded, int exponent)
+        {
+            return soft_float_clamp<Mantissa, MantissaDigits, ExponentDigits>(
+                    negative,
+                    static_cast<Mantissa>(rounded >> (rounded >> MantissaDigits)),
+                    exponent+static_cast<int>(rounded >> MantissaDigits));
+        }
+
+        template<typename Mantissa, int MantissaDigits, int ExponentDigits, class RoundingTag, typename Integer>
+        CNL_NODISCARD constexpr soft_float_parts<Mantissa> soft_float_normalize_width(
+                bool negative, Integer const& magnitude, int exponent, int width)
+        {
+            return (width>MantissaDigits)
+                   ? soft_float_carry<Mantissa, MantissaDigits, ExponentDigits>(
+                            negative,
+                            soft_float_round<RoundingTag>{}(magnitude, width-MantissaDigits),
+                            exponent+width-MantissaDigits)
+                   : soft_float_clamp<Mantissa, MantissaDigits, ExponentDigits>(
+                            negative,
+                            static_cast<Mantissa>(static_cast<Mantissa>(magnitude) << (MantissaDigits-width)),
+                            exponent-(MantissaDigits-width));
+        }
+
+        // converts magnitude*2^exponent to a normalized mantissa and exponent
+        template<typename Mantissa, int MantissaDigits, int ExponentDigits, class RoundingTag, typename Integer>
+        CNL_NODISCARD constexpr soft_float_parts<Mantissa> soft_float_normalize(
+                bool negative, Integer const& magnitude, int exponent)
+        {
+            static_assert(
+                    numeric_limits<Integer>::is_integer && !numeric_limits<Integer>::is_signed,
+                    "magnitude must be an unsigned integer");
+            using wide = set_digits_t<unsigned, max(digits<Integer>::value, MantissaDigits+1)>;
+            return (magnitude==Integer{0})
+                   ? soft_float_parts<Mantissa>{false, Mantissa{0}, 0}
+                   : soft_float_normalize_width<Mantissa, MantissaDigits, ExponentDigits, RoundingTag>(
+                            negative, static_cast<wide>(magnitude), exponent,
+                            digits<wide>::value-countl_zero(static_cast<wide>(magnitude)));
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::soft_float_is_negative / soft_float_magnitude
+
+        template<typename Integer>
+        CNL_NODISCARD constexpr bool soft_float_is_negative(Integer const& value)
+        {
+            return is_signed<Integer>::value && value<Integer{0};
+        }
+
+        // absolute value as an unsigned integer
+        template<typename Integer>
+        CNL_NODISCARD constexpr remove_signedness_t<Integer> soft_float_magnitude(Integer const& value)
+        {
+            return soft_float_is_negative(value)
+                   ? static_cast<remove_signedness_t<Integer>>(
+                            remove_signedness_t<Integer>{0}-static_cast<remove_signedness_t<Integer>>(value))
+                   : static_cast<remove_signedness_t<Integer>>(value);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::soft_float_from_floating
+
+        // exact decomposition into fraction and exponent followed by rounding to MantissaDigits
+        template<typename Mantissa, int MantissaDigits, int ExponentDigits, class RoundingTag, typename Floating>
+        CNL_NODISCARD soft_float_parts<Mantissa> soft_float_from_floating(Floating const& value)
+        {
+            using magnitude_type = set_digits_t<unsigned, numeric_limits<Floating>::digits>;
+            int exponent;
+            auto const fraction = std::frexp(value, &exponent);
+            return soft_float_normalize<Mantissa, MantissaDigits, ExponentDigits, RoundingTag>(
+                    fraction<0,
+                    static_cast<magnitude_type>(std::ldexp(std::fabs(fraction), numeric_limits<Floating>::digits)),
+                    exponent-numeric_limits<Floating>::digits);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::soft_float_rescale
+
+        // magnitude, as Integer, of mantissa*2^-shift
+        template<class RoundingTag, typename Integer, typename Mantissa>
+        CNL_NODISCARD constexpr Integer soft_float_rescale(Mantissa const& mantissa, int shift)
+        {
+            return (shift<=0)
+                   ? static_cast<Integer>(static_cast<Integer>(mantissa) << -shift)
+                   : (shift>digits<Mantissa>::value)
+                     ? Integer{0}
+                     : static_cast<Integer>(soft_float_round<RoundingTag>{}(mantissa, shift));
+        }
+    }
+
+    /// \brief floating-point type whose arithmetic is implemented entirely with integer operations
+    ///
+    /// \tparam MantissaDigits number of binary digits in the mantissa, including the leading digit
+    /// \tparam ExponentDigits number of binary digits with which an IEEE 754 format would encode the exponent
+    /// \tparam RoundingTag \ref cnl::nearest_rounding_tag (ties away from zero)
+    /// or \ref cnl::native_rounding_tag (toward zero)
+    ///
+    /// Results are the same on every platform and with every compiler because no floating-point
+    /// instructions are used. `soft_float<24, 8>` and `soft_float<53, 11>` have the range and precision of
+    /// IEEE 754 binary32 and binary64, but this type does not represent infinities, NaNs, subnormals or negative zero:
+    /// results too great in magnitude saturate to the greatest finite value,
+    /// results too small in magnitude become zero and division by zero saturates.
+    /// Each result is computed with guard, round and sticky bits and rounded once, as with IEEE 754.
+    ///
+    /// The value is `mantissa()*2^exponent()`, negated if `negative()` is true,
+    /// where `mantissa()` is zero or has exactly \c MantissaDigits significant digits.
+    ///
+    /// \headerfile cnl/soft_float.h
+    /// \sa cnl::scaled_integer
+    template<int MantissaDigits = 24, int ExponentDigits = 8, class RoundingTag = nearest_rounding_tag>
+    class soft_float {
+        static_assert(MantissaDigits>=4, "soft_float must have at least four mantissa digits");
+        static_assert(
+                ExponentDigits>=2 && ExponentDigits<=16,
+                "soft_float must have between two and sixteen exponent digits");
+    public:
+        using mantissa_type = _impl::soft_float_mantissa_t<MantissaDigits>;
+
+        constexpr soft_float()
+                : _negative{false}, _mantissa{0}, _exponent{0}
+        {
+        }
+
+        /// initializes the value, `magnitude*2^exponent`, negated if \c negative is true,
+        /// rounding \c magnitude, an unsigned integer, to \c MantissaDigits digits
+        template<typename Magnitude>
+        constexpr soft_float(bool negative, Magnitude const& magnitude, int exponent)
+                : soft_float(_impl::soft_float_normalize<
+                        mantissa_type, MantissaDigits, ExponentDigits, RoundingTag>(negative, magnitude, exponent))
+        {
+        }
+
+        /// initializes the value from an integer, rounding if it has more than \c MantissaDigits digits
+        template<typename S, _impl::enable_if_t<_impl::is_integral<S>::value, int> = 0>
+        constexpr soft_float(S const& value)  // NOLINT(hicpp-explicit-conversions)
+                : soft_float(_impl::soft_float_is_negative(value), _impl::soft_float_magnitude(value), 0)
+        {
+        }
+
+        /// initializes the value from a finite floating-point value
+        template<typename S, _impl::enable_if_t<std::is_floating_point<S>::value, int> = 0>
+        soft_float(S const& value)  // NOLINT(hicpp-explicit-conversions)
+                : soft_float(_impl::soft_float_from_floating<
+                        mantissa_type, MantissaDigits, ExponentDigits, RoundingTag>(value))
+        {
+        }
+
+        /// initializes the value from a \ref scaled_integer, rounding if it has more than \c MantissaDigits digits
+        template<typename Rep, int Exponent>
+        constexpr soft_float(scaled_integer<Rep, power<Exponent>> const& value)  // NOLINT(hicpp-explicit-conversions)
+                : soft_float(
+                        _impl::soft_float_is_negative(_impl::to_rep(value)),
+                        _impl::soft_float_magnitude(_impl::to_rep(value)),
+                        Exponent)
+        {
+        }
+
+        /// converts to an integer, rounding as \c RoundingTag; overflow is undefined
+        template<typename S, _impl::enable_if_t<_impl::is_integral<S>::value, int> = 0>
+        CNL_NODISCARD explicit constexpr operator S() const
+        {
+            return _negative
+                   ? static_cast<S>(-static_cast<S>(
+                            _impl::soft_float_rescale<RoundingTag, remove_signedness_t<S>>(_mantissa, -_exponent)))
+                   : static_cast<S>(
+                            _impl::soft_float_rescale<RoundingTag, remove_signedness_t<S>>(_mantissa, -_exponent));
+        }
+
+        /// converts to a floating-point type
+        template<typename S, _impl::enable_if_t<std::is_floating_point<S>::value, int> = 0>
+        CNL_NODISCARD explicit operator S() const
+        {
+            return _negative
+                   ? -std::ldexp(static_cast<S>(_mantissa), _exponent)
+                   : std::ldexp(static_cast<S>(_mantissa), _exponent);
+        }
+
+        CNL_NODISCARD explicit constexpr operator bool() const
+        {
+            return _mantissa!=mantissa_type{0};
+        }
+
+        /// returns true iff the value is less than zero
+        CNL_NODISCARD constexpr bool negative() const
+        {
+            return _negative;
+        }
+
+        /// returns the magnitude of the value divided by two to the power of `exponent()`
+        CNL_NODISCARD constexpr mantissa_type const& mantissa() const
+        {
+            return _mantissa;
+        }
+
+        /// returns the power of two by which the mantissa is multiplied
+        CNL_NODISCARD constexpr int exponent() const
+        {
+            return _exponent;
+        }
+
+    private:
+        constexpr soft_float(_impl::soft_float_parts<mantissa_type> const& parts)
+                : _negative(parts.negative), _mantissa(parts.mantissa), _exponent(parts.exponent)
+        {
+        }
+
+        bool _negative;
+        mantissa_type _mantissa;
+        int _exponent;
+    };
+}
+
+#endif  // CNL_IMPL_SOFT_FLOAT_TYPE_H
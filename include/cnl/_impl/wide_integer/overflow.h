@@ -0,0 +1,47 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_WIDE_INTEGER_OVERFLOW_H)
+#define CNL_IMPL_WIDE_INTEGER_OVERFLOW_H
+
+#include "../duplex_integer/overflow.h"
+#include "../num_traits/digits.h"
+#include "../num_traits/from_rep.h"
+#include "../num_traits/to_rep.h"
+#include "../overflow/builtin_overflow.h"
+#include "../type_traits/enable_if.h"
+#include "../wide_tag/declaration.h"
+#include "definition.h"
+#include "from_rep.h"
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::builtin_overflow_operator<wide_integer>
+
+        // wide_integer which uses every digit of its rep overflows exactly when its rep does
+        template<class Operator, typename Rep, int Digits, typename Narrowest>
+        struct builtin_overflow_operator<
+                Operator, number<Rep, wide_tag<Digits, Narrowest>>, number<Rep, wide_tag<Digits, Narrowest>>,
+                enable_if_t<digits<Rep>::value==Digits && builtin_overflow_operator<Operator, Rep, Rep>::value>>
+                : std::true_type {
+            using _wide_integer = number<Rep, wide_tag<Digits, Narrowest>>;
+
+            template<typename Result>
+            CNL_NODISCARD CNL_RELAXED_CONSTEXPR bool operator()(
+                    _wide_integer const& lhs, _wide_integer const& rhs, Result& result) const
+            {
+                Rep rep{};
+                auto const overflow = builtin_overflow_operator<Operator, Rep, Rep>{}(to_rep(lhs), to_rep(rhs), rep);
+                result = from_rep<Result>(rep);
+                return overflow;
+            }
+        };
+    }
+}
+
+#endif  // CNL_IMPL_WIDE_INTEGER_OVERFLOW_H
@@ -0,0 +1,15 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief definition of `cnl::accumulator`, a running sum whose width is fixed by the number of terms
+
+#if !defined(CNL_ACCUMULATOR_H)
+#define CNL_ACCUMULATOR_H
+
+#include "_impl/accumulator/type.h"
+
+#endif  // CNL_ACCUMULATOR_H
@@ -100,24 +100,41 @@
 #if !defined(CNL_ALL_H)
 #define CNL_ALL_H
 
+#include "accumulator.h"
+#include "best_format.h"
+#include "big_integer.h"
+#include "biquad_cascade.h"
 #include "bit.h"
+#include "block_scaled_array.h"
+#include "bounded_integer.h"
+#include "capped_elastic_scaled_integer.h"
 #include "cmath.h"
 #include "constant.h"
 #include "cstdint.h"
+#include "dynamic_scaled_integer.h"
+#include "elastic_expression.h"
 #include "elastic_fixed_point.h"
 #include "elastic_integer.h"
 #include "elastic_scaled_integer.h"
+#include "fft.h"
+#include "fir_filter.h"
+#include "fixed_array.h"
 #include "fixed_point.h"
 #include "fraction.h"
+#include "fused_static_integer.h"
+#include "gemm.h"
 #include "limits.h"  // NOLINT(modernize-deprecated-headers,  hicpp-deprecated-headers)
 #include "math.h"  // NOLINT(modernize-deprecated-headers,  hicpp-deprecated-headers)
 #include "num_traits.h"
 #include "numeric.h"
 #include "overflow.h"
 #include "overflow_integer.h"
+#include "parallel.h"
 #include "rounding.h"
 #include "rounding_integer.h"
 #include "scaled_integer.h"
+#include "simd_pack.h"
+#include "soft_float.h"
 #include "static_integer.h"
 #include "static_number.h"
 #include "type_traits.h"
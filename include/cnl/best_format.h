@@ -0,0 +1,16 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief definition of `cnl::best_format`, which chooses a \ref cnl::scaled_integer from a range and resolution
+
+#if !defined(CNL_BEST_FORMAT_H)
+#define CNL_BEST_FORMAT_H
+
+#include "_impl/best_format/type.h"
+#include "scaled_integer.h"
+
+#endif  // CNL_BEST_FORMAT_H
@@ -0,0 +1,18 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief definition of `cnl::big_integer`, an arbitrary-precision integer
+
+#if !defined(CNL_BIG_INTEGER_H)
+#define CNL_BIG_INTEGER_H
+
+#include "_impl/big_integer/arena.h"
+#include "_impl/big_integer/num_traits.h"
+#include "_impl/big_integer/operators.h"
+#include "_impl/big_integer/type.h"
+
+#endif  // CNL_BIG_INTEGER_H
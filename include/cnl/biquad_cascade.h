@@ -0,0 +1,21 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief definition of `cnl::biquad_cascade`, a fixed-point IIR filter of second-order sections
+
+#if !defined(CNL_BIQUAD_CASCADE_H)
+#define CNL_BIQUAD_CASCADE_H
+
+#include "_impl/biquad_cascade/coefficients.h"
+#include "_impl/biquad_cascade/section.h"
+#include "_impl/biquad_cascade/tags.h"
+#include "_impl/biquad_cascade/type.h"
+#include "fixed_array.h"
+#include "overflow.h"
+#include "rounding.h"
+
+#endif  // CNL_BIQUAD_CASCADE_H
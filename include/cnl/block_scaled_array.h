@@ -0,0 +1,18 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief definition of `cnl::block_scaled_array`, an array of integers which share one exponent
+
+#if !defined(CNL_BLOCK_SCALED_ARRAY_H)
+#define CNL_BLOCK_SCALED_ARRAY_H
+
+#include "_impl/block_scaled_array/operators.h"
+#include "_impl/block_scaled_array/type.h"
+#include "fixed_array.h"
+#include "scaled_integer.h"
+
+#endif  // CNL_BLOCK_SCALED_ARRAY_H
@@ -0,0 +1,16 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief definition of `cnl::bounded_integer`, an integer whose range is tracked at compile time
+
+#if !defined(CNL_BOUNDED_INTEGER_H)
+#define CNL_BOUNDED_INTEGER_H
+
+#include "_impl/bounded_integer/operators.h"
+#include "_impl/bounded_integer/type.h"
+
+#endif  // CNL_BOUNDED_INTEGER_H
@@ -0,0 +1,17 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief definition of `cnl::capped_elastic_scaled_integer`, an elastic real number with bounded width
+
+#if !defined(CNL_CAPPED_ELASTIC_SCALED_INTEGER_H)
+#define CNL_CAPPED_ELASTIC_SCALED_INTEGER_H
+
+#include "_impl/capped_elastic/operators.h"
+#include "_impl/capped_elastic/tag.h"
+#include "_impl/capped_elastic/type.h"
+
+#endif  // CNL_CAPPED_ELASTIC_SCALED_INTEGER_H
@@ -11,6 +11,7 @@
 #define CNL_CMATH_H
 
 #include "_impl/cmath/abs.h"
+#include "_impl/cmath/fma.h"
 
 #include <cmath>
 
@@ -0,0 +1,19 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief definition of `cnl::dynamic_scaled_integer`, an integer scaled by a run-time power of two
+
+#if !defined(CNL_DYNAMIC_SCALED_INTEGER_H)
+#define CNL_DYNAMIC_SCALED_INTEGER_H
+
+#include "_impl/dynamic_scaled_integer/convert_operator.h"
+#include "_impl/dynamic_scaled_integer/operators.h"
+#include "_impl/dynamic_scaled_integer/type.h"
+#include "_impl/dynamic_scaled_integer/visit.h"
+#include "scaled_integer.h"
+
+#endif  // CNL_DYNAMIC_SCALED_INTEGER_H
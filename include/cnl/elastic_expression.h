@@ -0,0 +1,18 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief expressions of elastic values which are evaluated in a single integer type
+
+#if !defined(CNL_ELASTIC_EXPRESSION_H)
+#define CNL_ELASTIC_EXPRESSION_H
+
+#include "_impl/elastic_expression/operators.h"
+#include "_impl/elastic_expression/type.h"
+#include "elastic_integer.h"
+#include "scaled_integer.h"
+
+#endif  // CNL_ELASTIC_EXPRESSION_H
@@ -13,6 +13,7 @@
 #include "_impl/elastic_integer/declaration.h"
 #include "_impl/elastic_integer/definition.h"
 #include "_impl/elastic_integer/digits.h"
+#include "_impl/elastic_integer/fast_rep.h"
 #include "_impl/elastic_integer/from_rep.h"
 #include "_impl/elastic_integer/from_value.h"
 #include "_impl/elastic_integer/generic.h"
@@ -0,0 +1,19 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief definition of `cnl::fft`, a block-floating-point fast Fourier transform of `cnl::scaled_integer` data
+
+#if !defined(CNL_FFT_H)
+#define CNL_FFT_H
+
+#include "_impl/fft/fft.h"
+#include "_impl/fft/twiddles.h"
+#include "fixed_array.h"
+#include "numeric.h"
+#include "scaled_integer.h"
+
+#endif  // CNL_FFT_H
@@ -0,0 +1,17 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief definitions of `cnl::fir_filter` and `cnl::convolve`, which sum products without overflow
+
+#if !defined(CNL_FIR_FILTER_H)
+#define CNL_FIR_FILTER_H
+
+#include "_impl/fir_filter/convolve.h"
+#include "_impl/fir_filter/type.h"
+#include "fixed_array.h"
+
+#endif  // CNL_FIR_FILTER_H
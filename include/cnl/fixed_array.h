@@ -0,0 +1,21 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief definitions of `cnl::fixed_array` and `cnl::fixed_vector`, aligned containers of numbers
+/// which are operated upon element-wise
+
+#if !defined(CNL_FIXED_ARRAY_H)
+#define CNL_FIXED_ARRAY_H
+
+#include "_impl/fixed_array/aligned_allocator.h"
+#include "_impl/fixed_array/forward_declaration.h"
+#include "_impl/fixed_array/is_fixed_container.h"
+#include "_impl/fixed_array/operators.h"
+#include "_impl/fixed_array/reduce.h"
+#include "_impl/fixed_array/type.h"
+
+#endif  // CNL_FIXED_ARRAY_H
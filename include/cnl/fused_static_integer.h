@@ -0,0 +1,16 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief definition of `cnl::fused_static_integer`, a single-layer equivalent of `cnl::static_integer`
+
+#if !defined(CNL_FUSED_STATIC_INTEGER_H)
+#define CNL_FUSED_STATIC_INTEGER_H
+
+#include "_impl/fused_static_integer/operators.h"
+#include "_impl/fused_static_integer/type.h"
+
+#endif  // CNL_FUSED_STATIC_INTEGER_H
@@ -0,0 +1,16 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief definition of `cnl::gemm`, a blocked, multi-threaded matrix multiplication with exact accumulation
+
+#if !defined(CNL_GEMM_H)
+#define CNL_GEMM_H
+
+#include "_impl/gemm/gemm.h"
+#include "_impl/gemm/kernel.h"
+
+#endif  // CNL_GEMM_H
@@ -12,8 +12,11 @@
 
 #include "_impl/operators/tagged.h"
 #include "_impl/overflow/generic.h"
+#include "_impl/overflow/instrumented.h"
 #include "_impl/overflow/native.h"
 #include "_impl/overflow/saturated.h"
+#include "_impl/overflow/saturated_batch.h"
+#include "_impl/overflow/sticky.h"
 #include "_impl/overflow/throwing.h"
 #include "_impl/overflow/trapping.h"
 #include "_impl/overflow/undefined.h"
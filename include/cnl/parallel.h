@@ -0,0 +1,16 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief multi-threaded reductions and scans whose results do not depend upon the number of threads
+
+#if !defined(CNL_PARALLEL_H)
+#define CNL_PARALLEL_H
+
+#include "_impl/parallel/reduce.h"
+#include "_impl/parallel/scan.h"
+
+#endif  // CNL_PARALLEL_H
@@ -19,6 +19,7 @@
 #include "_impl/scaled_integer/is_number.h"
 #include "_impl/scaled_integer/is_scaled_integer.h"
 #include "_impl/scaled_integer/math.h"
+#include "_impl/scaled_integer/multiply_narrow.h"
 #include "_impl/scaled_integer/named.h"
 #include "_impl/scaled_integer/num_traits.h"
 #include "_impl/scaled_integer/operators.h"
@@ -0,0 +1,20 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief definition of `cnl::simd_pack`, a rep type whose values are operated upon lane-wise
+
+#if !defined(CNL_SIMD_PACK_H)
+#define CNL_SIMD_PACK_H
+
+#include "_impl/simd_pack/forward_declaration.h"
+#include "_impl/simd_pack/is_simd_pack.h"
+#include "_impl/simd_pack/num_traits.h"
+#include "_impl/simd_pack/operators.h"
+#include "_impl/simd_pack/overflow.h"
+#include "_impl/simd_pack/type.h"
+
+#endif  // CNL_SIMD_PACK_H
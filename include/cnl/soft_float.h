@@ -0,0 +1,19 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief definition of `cnl::soft_float`, a floating-point type with bit-reproducible integer arithmetic
+
+#if !defined(CNL_SOFT_FLOAT_H)
+#define CNL_SOFT_FLOAT_H
+
+#include "_impl/soft_float/convert_operator.h"
+#include "_impl/soft_float/numeric_limits.h"
+#include "_impl/soft_float/operators.h"
+#include "_impl/soft_float/type.h"
+#include "scaled_integer.h"
+
+#endif  // CNL_SOFT_FLOAT_H
@@ -7,9 +7,18 @@
 #include "sample_functions.h"
 
 #include <cnl/cmath.h>
+#include <cnl/fused_static_integer.h>
+#include <cnl/gemm.h>
+#include <cnl/overflow_integer.h>
+#include <cnl/rounding_integer.h>
+#include <cnl/soft_float.h>
+#include <cnl/static_integer.h>
 
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+#include <vector>
+
 #define ESCAPE(X) escape_cppcon2015(&(X))
 //#define ESCAPE(X) escape_codedive2015(&X)
 //#define ESCAPE(x) benchmark::DoNotOptimize(x)
@@ -180,6 +189,93 @@ static void circle_intersect_generic(benchmark::State& state)
     }
 }
 
+// evaluates an expression in which each operation of a static_integer-like type, T, widens its result
+template<class T>
+static void bm_static_integer(benchmark::State& state)
+{
+    auto factor1 = T{100};
+    auto factor2 = T{-3};
+    auto addend = T{7};
+    while (state.KeepRunning()) {
+        ESCAPE(factor1);
+        ESCAPE(factor2);
+        ESCAPE(addend);
+        auto value = (factor1*factor2+addend)/addend;
+        ESCAPE(value);
+    }
+}
+
+// multiplies two prices and rounds the product back to the price type, T
+template<class T>
+static void bm_decimal_multiply(benchmark::State& state)
+{
+    auto factor1 = T{1234.5678};
+    auto factor2 = T{-0.0915};
+    while (state.KeepRunning()) {
+        ESCAPE(factor1);
+        ESCAPE(factor2);
+        auto value = T{factor1*factor2};
+        ESCAPE(value);
+    }
+}
+
+// multiplies square matrices of the given size; reports multiply-accumulate operations per second
+template<class T>
+static void bm_gemm(benchmark::State& state)
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto const lhs = std::vector<T>(size*size, static_cast<T>(numeric_limits<T>::max()/int8_t{5}));
+    auto const rhs = std::vector<T>(size*size, static_cast<T>(numeric_limits<T>::max()/int8_t{3}));
+    auto result = std::vector<T>(size*size);
+    while (state.KeepRunning()) {
+        cnl::gemm(size, size, size, lhs.data(), rhs.data(), result.data());
+        ESCAPE(result.front());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()*size*size*size));
+}
+
+// the quantized matrix multiplication of src/test/zero_cost_gemm.cpp, written by hand with fundamental integers;
+// operands are 1:7, sums are 32-bit and results are rounded and saturated to 3:4
+static void bm_gemm_raw_integer(benchmark::State& state)
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto const lhs = std::vector<int8_t>(size*size, int8_t{25});
+    auto const rhs = std::vector<int8_t>(size*size, int8_t{-42});
+    auto result = std::vector<int8_t>(size*size);
+    while (state.KeepRunning()) {
+        for (std::size_t row = 0; row!=size; ++row) {
+            for (std::size_t column = 0; column!=size; ++column) {
+                auto sum = int32_t{0};
+                for (std::size_t k = 0; k!=size; ++k) {
+                    sum += int32_t{lhs[row*size+k]}*rhs[k*size+column];
+                }
+                auto const rounded = (sum+(sum<0 ? -512 : 512))/1024;
+                result[row*size+column] = static_cast<int8_t>(std::max(-128, std::min(127, rounded)));
+            }
+        }
+        ESCAPE(result.front());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()*size*size*size));
+}
+
+// the same multiplication expressed with cnl::gemm on a single thread; compare with bm_gemm_raw_integer
+static void bm_gemm_scaled_integer(benchmark::State& state)
+{
+    using q1_7 = scaled_integer<int8_t, cnl::power<-7>>;
+    using q3_4 = scaled_integer<
+            cnl::rounding_integer<cnl::overflow_integer<int8_t, cnl::saturated_overflow_tag>>, cnl::power<-4>>;
+
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto const lhs = std::vector<q1_7>(size*size, cnl::_impl::from_rep<q1_7>(int8_t{25}));
+    auto const rhs = std::vector<q1_7>(size*size, cnl::_impl::from_rep<q1_7>(int8_t{-42}));
+    auto result = std::vector<q3_4>(size*size);
+    while (state.KeepRunning()) {
+        cnl::gemm(size, size, size, lhs.data(), rhs.data(), result.data(), 1);
+        ESCAPE(result.front());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()*size*size*size));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // scaled_integer types
 
@@ -192,6 +288,20 @@ using s15_16 = scaled_integer<int32_t, cnl::power<-16>>;
 using u32_32 = scaled_integer<uint64_t, cnl::power<-32>>;
 using s31_32 = scaled_integer<int64_t, cnl::power<-32>>;
 
+////////////////////////////////////////////////////////////////////////////////
+// decimal fixed-point types
+
+using decimal64_4 = scaled_integer<int64_t, cnl::power<-4, 10>>;
+#if defined(CNL_INT128_ENABLED)
+using decimal128_8 = scaled_integer<cnl::int128, cnl::power<-8, 10>>;
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// soft_float types
+
+using soft_binary32 = cnl::soft_float<24, 8>;
+using soft_binary64 = cnl::soft_float<53, 11>;
+
 ////////////////////////////////////////////////////////////////////////////////
 // multi-type benchmark macros
 
@@ -253,3 +363,31 @@ FIXED_POINT_BENCHMARK_REAL(bm_circle_intersect_generic)
 
 // tests involving unoptimized math function, cnl::sqrt
 FIXED_POINT_BENCHMARK_REAL(bm_sqrt)
+
+// throughput of a quantized matrix multiplication
+BENCHMARK_TEMPLATE1(bm_gemm, s3_4)->Arg(64)->Arg(256)->Arg(1024);
+BENCHMARK_TEMPLATE1(bm_gemm, s7_8)->Arg(64)->Arg(256)->Arg(1024);
+
+// cost of cnl::gemm relative to the equivalent hand-written integer kernel
+BENCHMARK(bm_gemm_raw_integer)->Arg(64)->Arg(256);
+BENCHMARK(bm_gemm_scaled_integer)->Arg(64)->Arg(256);
+
+// composed and fused implementations of the same type
+BENCHMARK_TEMPLATE1(bm_static_integer, cnl::static_integer<15>);
+BENCHMARK_TEMPLATE1(bm_static_integer, cnl::fused_static_integer<15>);
+
+// decimal rescaling
+BENCHMARK_TEMPLATE1(bm_decimal_multiply, decimal64_4);
+#if defined(CNL_INT128_ENABLED)
+BENCHMARK_TEMPLATE1(bm_decimal_multiply, decimal128_8);
+#endif
+
+// floating-point arithmetic implemented with integer operations
+BENCHMARK_TEMPLATE1(add, soft_binary32);
+BENCHMARK_TEMPLATE1(add, soft_binary64);
+BENCHMARK_TEMPLATE1(sub, soft_binary32);
+BENCHMARK_TEMPLATE1(sub, soft_binary64);
+BENCHMARK_TEMPLATE1(mul, soft_binary32);
+BENCHMARK_TEMPLATE1(mul, soft_binary64);
+BENCHMARK_TEMPLATE1(div, soft_binary32);
+BENCHMARK_TEMPLATE1(div, soft_binary64);
@@ -0,0 +1,334 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// prints the narrowest cnl::scaled_integer which represents a range of values to a given resolution
+// and estimates the cost of evaluating an expression of such values using elastic arithmetic
+//
+// usage: BestFormat <min> <max> <resolution> [<expression>]
+//
+// e.g.: BestFormat -100 100 0.01 "(x+y)*x/y"
+
+#include <cnl/best_format.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+namespace {
+    using cnl::intmax;
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // parsing of exact decimal values, e.g. "-12.5", into rationals
+
+    struct rational {
+        intmax numerator;
+        intmax denominator;
+    };
+
+    bool parse_rational(char const* text, rational& result)
+    {
+        auto const negative = *text=='-';
+        if (negative || *text=='+') {
+            ++text;
+        }
+
+        intmax numerator = 0;
+        intmax denominator = 1;
+        auto fraction = false;
+        auto any_digits = false;
+        for (; *text; ++text) {
+            if (*text=='.' && !fraction) {
+                fraction = true;
+                continue;
+            }
+            if (!std::isdigit(static_cast<unsigned char>(*text))) {
+                return false;
+            }
+            if (numerator>(cnl::numeric_limits<intmax>::max()-9)/10
+                    || denominator>cnl::numeric_limits<intmax>::max()/10) {
+                return false;
+            }
+            numerator = numerator*10+(*text-'0');
+            if (fraction) {
+                denominator *= 10;
+            }
+            any_digits = true;
+        }
+
+        result = rational{negative ? -numerator : numerator, denominator};
+        return any_digits;
+    }
+
+    // lhs>rhs, compared without forming products which can overflow
+    bool greater(rational const& lhs, rational const& rhs)
+    {
+        auto const lhs_floor = cnl::_impl::best_format_floor(lhs.numerator, lhs.denominator);
+        auto const rhs_floor = cnl::_impl::best_format_floor(rhs.numerator, rhs.denominator);
+        if (lhs_floor!=rhs_floor) {
+            return lhs_floor>rhs_floor;
+        }
+
+        // the fractional parts, lhs_remainder/lhs.denominator and rhs_remainder/rhs.denominator, are in [0, 1);
+        // denominators are powers of ten, so each divides the greater of the two
+        auto const lhs_remainder = lhs.numerator-lhs_floor*lhs.denominator;
+        auto const rhs_remainder = rhs.numerator-rhs_floor*rhs.denominator;
+        auto const denominator = std::max(lhs.denominator, rhs.denominator);
+        return lhs_remainder*(denominator/lhs.denominator)>rhs_remainder*(denominator/rhs.denominator);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // format of a value: a signed or unsigned integer with a number of digits, scaled by 2^exponent
+
+    struct format {
+        int digits;
+        int exponent;
+        bool is_signed;
+    };
+
+    int width(format const& f)
+    {
+        return f.digits+f.is_signed;
+    }
+
+    // narrowest integer of the format, as named in C++
+    std::string rep_name(format const& f)
+    {
+        auto const bits = width(f);
+        if (bits<=64) {
+            auto const native = bits<=8 ? 8 : bits<=16 ? 16 : bits<=32 ? 32 : 64;
+            return std::string(f.is_signed ? "std::int" : "std::uint")+std::to_string(native)+"_t";
+        }
+        if (bits<=128) {
+            return f.is_signed ? "cnl::int128" : "cnl::uint128";
+        }
+        return std::string("cnl::wide_integer<")+std::to_string(f.digits)+(f.is_signed ? ">" : ", unsigned>");
+    }
+
+    std::string type_name(format const& f)
+    {
+        return std::string("cnl::scaled_integer<")+rep_name(f)+", cnl::power<"+std::to_string(f.exponent)+">>";
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // estimated cost of operations, in cycles, by width of the operands
+
+    struct cost_table {
+        int add;
+        int multiply;
+        int divide;
+    };
+
+    cost_table estimate_cost(int bits)
+    {
+        if (bits<=64) {
+            return cost_table{1, 3, 26};
+        }
+        if (bits<=128) {
+            return cost_table{2, 4, 60};
+        }
+
+        // multi-word arithmetic of cnl::wide_integer; multiplication and division are quadratic
+        auto const words = (bits+63)/64;
+        return cost_table{2*words, 4*words*words, 60*words*words};
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // recursive-descent evaluation of an expression of variables, all of the chosen format,
+    // using the rules of cnl::elastic_scaled_integer arithmetic
+
+    class evaluator {
+    public:
+        evaluator(char const* text, format const& variable)
+                : _position(text), _variable(variable)
+        {
+        }
+
+        bool evaluate(format& result)
+        {
+            if (!expression(result)) {
+                return false;
+            }
+            skip_space();
+            return *_position=='\0' || fail("unexpected character");
+        }
+
+        int total_cost() const
+        {
+            return _total_cost;
+        }
+
+        bool needs_wide_integer() const
+        {
+            return _max_width>64;
+        }
+
+    private:
+        bool fail(char const* message)
+        {
+            std::fprintf(stderr, "error: %s at \"%s\"\n", message, _position);
+            return false;
+        }
+
+        void skip_space()
+        {
+            while (std::isspace(static_cast<unsigned char>(*_position))) {
+                ++_position;
+            }
+        }
+
+        bool expression(format& result)
+        {
+            if (!term(result)) {
+                return false;
+            }
+            for (;;) {
+                skip_space();
+                auto const op = *_position;
+                if (op!='+' && op!='-') {
+                    return true;
+                }
+                ++_position;
+                format rhs{};
+                if (!term(rhs)) {
+                    return false;
+                }
+
+                // the sum has the finer exponent and one more digit than the wider operand
+                auto const exponent = std::min(result.exponent, rhs.exponent);
+                auto const high = std::max(result.digits+result.exponent, rhs.digits+rhs.exponent);
+                report(op, result, rhs, format{
+                        high-exponent+1, exponent, result.is_signed || rhs.is_signed || op=='-'}, result);
+            }
+        }
+
+        bool term(format& result)
+        {
+            if (!factor(result)) {
+                return false;
+            }
+            for (;;) {
+                skip_space();
+                auto const op = *_position;
+                if (op!='*' && op!='/') {
+                    return true;
+                }
+                ++_position;
+                format rhs{};
+                if (!factor(rhs)) {
+                    return false;
+                }
+
+                auto const is_signed = result.is_signed || rhs.is_signed;
+                report(op, result, rhs, (op=='*')
+                        ? format{result.digits+rhs.digits, result.exponent+rhs.exponent, is_signed}
+                        : format{result.digits+rhs.digits, result.exponent-rhs.exponent-rhs.digits, is_signed},
+                        result);
+            }
+        }
+
+        bool factor(format& result)
+        {
+            skip_space();
+            if (*_position=='(') {
+                ++_position;
+                if (!expression(result)) {
+                    return false;
+                }
+                skip_space();
+                if (*_position!=')') {
+                    return fail("expected ')'");
+                }
+                ++_position;
+                return true;
+            }
+            if (!std::isalpha(static_cast<unsigned char>(*_position))) {
+                return fail("expected variable");
+            }
+            while (std::isalnum(static_cast<unsigned char>(*_position)) || *_position=='_') {
+                ++_position;
+            }
+            result = _variable;
+            return true;
+        }
+
+        void report(char op, format const& lhs, format const& rhs, format const& output, format& result)
+        {
+            // operands are converted to the width of the result before the operation
+            auto const bits = std::max(width(output), std::max(width(lhs), width(rhs)));
+            auto const costs = estimate_cost(bits);
+            auto const cost = (op=='*') ? costs.multiply : (op=='/') ? costs.divide : costs.add;
+
+            std::printf("  %c  %-48s  ~%d cycles\n", op, type_name(output).c_str(), cost);
+            _total_cost += cost;
+            _max_width = std::max(_max_width, bits);
+            result = output;
+        }
+
+        char const* _position;
+        format _variable;
+        int _total_cost = 0;
+        int _max_width = 0;
+    };
+
+    int usage()
+    {
+        std::fprintf(stderr, "usage: BestFormat <min> <max> <resolution> [<expression>]\n");
+        return EXIT_FAILURE;
+    }
+}
+
+int main(int argc, char const* const argv[])
+{
+    if (argc!=4 && argc!=5) {
+        return usage();
+    }
+
+    rational min{}, max{}, resolution{};
+    if (!parse_rational(argv[1], min) || !parse_rational(argv[2], max) || !parse_rational(argv[3], resolution)) {
+        std::fprintf(stderr, "error: values must be decimal numbers, e.g. -12.5\n");
+        return usage();
+    }
+    if (resolution.numerator<=0 || greater(min, max)) {
+        std::fprintf(stderr, "error: resolution must be positive and min must not exceed max\n");
+        return EXIT_FAILURE;
+    }
+
+    // the same calculation as cnl::best_format
+    auto const exponent = cnl::_impl::best_format_exponent(resolution.numerator, resolution.denominator);
+    if (!cnl::_impl::best_format_bound_fits(min.numerator, exponent)
+            || !cnl::_impl::best_format_bound_fits(max.numerator, exponent)) {
+        std::fprintf(stderr, "error: min and max require more digits at this resolution than the widest integer\n");
+        return EXIT_FAILURE;
+    }
+    auto const min_rep = cnl::_impl::best_format_bound(min.numerator, min.denominator, exponent, true);
+    auto const max_rep = cnl::_impl::best_format_bound(max.numerator, max.denominator, exponent, false);
+    auto const variable = format{
+            std::max(std::max(cnl::used_digits(min_rep), cnl::used_digits(max_rep)), 1), exponent, min_rep<0};
+
+    std::printf("%s\n", type_name(variable).c_str());
+#if defined(CNL_INT128_ENABLED)
+    if (width(variable)>64) {
+        std::printf("warning: values are wider than the widest native integer\n");
+    }
+#endif
+    if (argc==4) {
+        return EXIT_SUCCESS;
+    }
+
+    std::printf("%s\n", argv[4]);
+    evaluator e(argv[4], variable);
+    format result{};
+    if (!e.evaluate(result)) {
+        return EXIT_FAILURE;
+    }
+    std::printf("  =  %-48s  ~%d cycles\n", type_name(result).c_str(), e.total_cost());
+    if (e.needs_wide_integer()) {
+        std::printf("warning: intermediate results are wider than the widest native integer\n");
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,135 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests for <cnl/_impl/duplex_integer/overflow.h>
+
+#include <cnl/_impl/duplex_integer.h>
+#include <cnl/overflow_integer.h>
+#include <cnl/wide_integer.h>
+
+#include <gtest/gtest.h>
+
+namespace {
+#if defined(CNL_BUILTIN_OVERFLOW_SUPPORTED_BY_LANGUAGE)
+    using signed_duplex = cnl::_impl::duplex_integer<cnl::int32, cnl::uint32>;
+    using unsigned_duplex = cnl::_impl::duplex_integer<cnl::uint32, cnl::uint32>;
+    using signed_quad = cnl::_impl::duplex_integer<signed_duplex, unsigned_duplex>;
+
+    template<class Operator, typename Duplex>
+    constexpr bool overflows(Duplex const& lhs, Duplex const& rhs)
+    {
+        Duplex result{};
+        return cnl::_impl::builtin_overflow_operator<Operator, Duplex, Duplex>{}(lhs, rhs, result);
+    }
+
+    template<class Operator, typename Duplex>
+    constexpr Duplex wrapped(Duplex const& lhs, Duplex const& rhs)
+    {
+        Duplex result{};
+        (void)cnl::_impl::builtin_overflow_operator<Operator, Duplex, Duplex>{}(lhs, rhs, result);
+        return result;
+    }
+
+    namespace test_add {
+        static_assert(!overflows<cnl::_impl::add_op>(signed_duplex{INT64_C(0x7ffffffffffffffe)}, signed_duplex{1}),
+                "cnl::_impl::builtin_overflow_operator<add_op, duplex_integer> test failed");
+        static_assert(overflows<cnl::_impl::add_op>(signed_duplex{INT64_C(0x7fffffffffffffff)}, signed_duplex{1}),
+                "cnl::_impl::builtin_overflow_operator<add_op, duplex_integer> test failed");
+        static_assert(overflows<cnl::_impl::add_op>(signed_duplex{INT64_MIN}, signed_duplex{-1}),
+                "cnl::_impl::builtin_overflow_operator<add_op, duplex_integer> test failed");
+        static_assert(!overflows<cnl::_impl::add_op>(signed_duplex{INT64_MIN}, signed_duplex{INT64_MAX}),
+                "cnl::_impl::builtin_overflow_operator<add_op, duplex_integer> test failed");
+        static_assert(overflows<cnl::_impl::add_op>(unsigned_duplex{UINT64_MAX}, unsigned_duplex{1}),
+                "cnl::_impl::builtin_overflow_operator<add_op, duplex_integer> test failed");
+        static_assert(!overflows<cnl::_impl::add_op>(unsigned_duplex{UINT64_MAX-1}, unsigned_duplex{1}),
+                "cnl::_impl::builtin_overflow_operator<add_op, duplex_integer> test failed");
+        static_assert(wrapped<cnl::_impl::add_op>(signed_duplex{INT64_MAX}, signed_duplex{1})==signed_duplex{INT64_MIN},
+                "cnl::_impl::builtin_overflow_operator<add_op, duplex_integer> test failed");
+    }
+
+    namespace test_subtract {
+        static_assert(overflows<cnl::_impl::subtract_op>(signed_duplex{INT64_MIN}, signed_duplex{1}),
+                "cnl::_impl::builtin_overflow_operator<subtract_op, duplex_integer> test failed");
+        static_assert(overflows<cnl::_impl::subtract_op>(signed_duplex{0}, signed_duplex{INT64_MIN}),
+                "cnl::_impl::builtin_overflow_operator<subtract_op, duplex_integer> test failed");
+        static_assert(!overflows<cnl::_impl::subtract_op>(signed_duplex{-1}, signed_duplex{INT64_MIN}),
+                "cnl::_impl::builtin_overflow_operator<subtract_op, duplex_integer> test failed");
+        static_assert(overflows<cnl::_impl::subtract_op>(unsigned_duplex{0}, unsigned_duplex{1}),
+                "cnl::_impl::builtin_overflow_operator<subtract_op, duplex_integer> test failed");
+        static_assert(!overflows<cnl::_impl::subtract_op>(unsigned_duplex{1}, unsigned_duplex{1}),
+                "cnl::_impl::builtin_overflow_operator<subtract_op, duplex_integer> test failed");
+        static_assert(wrapped<cnl::_impl::subtract_op>(unsigned_duplex{0}, unsigned_duplex{1})==unsigned_duplex{UINT64_MAX},
+                "cnl::_impl::builtin_overflow_operator<subtract_op, duplex_integer> test failed");
+    }
+
+    namespace test_multiply {
+        static_assert(!overflows<cnl::_impl::multiply_op>(signed_duplex{INT64_C(0x40000000)}, signed_duplex{INT64_C(-0x80000000)}),
+                "cnl::_impl::builtin_overflow_operator<multiply_op, duplex_integer> test failed");
+        static_assert(overflows<cnl::_impl::multiply_op>(signed_duplex{INT64_C(0x100000000)}, signed_duplex{INT64_C(0x80000000)}),
+                "cnl::_impl::builtin_overflow_operator<multiply_op, duplex_integer> test failed");
+        static_assert(!overflows<cnl::_impl::multiply_op>(signed_duplex{INT64_C(0x100000000)}, signed_duplex{INT64_C(-0x80000000)}),
+                "cnl::_impl::builtin_overflow_operator<multiply_op, duplex_integer> test failed");
+        static_assert(overflows<cnl::_impl::multiply_op>(signed_duplex{INT64_MIN}, signed_duplex{-1}),
+                "cnl::_impl::builtin_overflow_operator<multiply_op, duplex_integer> test failed");
+        static_assert(overflows<cnl::_impl::multiply_op>(unsigned_duplex{UINT64_C(0x100000000)}, unsigned_duplex{UINT64_C(0x100000000)}),
+                "cnl::_impl::builtin_overflow_operator<multiply_op, duplex_integer> test failed");
+        static_assert(wrapped<cnl::_impl::multiply_op>(signed_duplex{-3}, signed_duplex{INT64_C(0x123456789)})==signed_duplex{INT64_C(-0x369d0369b)},
+                "cnl::_impl::builtin_overflow_operator<multiply_op, duplex_integer> test failed");
+        static_assert(overflows<cnl::_impl::multiply_op>(signed_quad{1} << 64, signed_quad{1} << 63),
+                "cnl::_impl::builtin_overflow_operator<multiply_op, duplex_integer> test failed");
+        static_assert(!overflows<cnl::_impl::multiply_op>(signed_quad{1} << 64, -(signed_quad{1} << 63)),
+                "cnl::_impl::builtin_overflow_operator<multiply_op, duplex_integer> test failed");
+    }
+
+    namespace test_wide_integer {
+        static_assert(
+                cnl::_impl::builtin_overflow_operator<
+                        cnl::_impl::add_op, cnl::wide_integer<255>, cnl::wide_integer<255>>::value,
+                "cnl::_impl::builtin_overflow_operator<add_op, wide_integer> test failed");
+        static_assert(
+                cnl::_impl::builtin_overflow_operator<
+                        cnl::_impl::multiply_op, cnl::wide_integer<256, unsigned>, cnl::wide_integer<256, unsigned>>::value,
+                "cnl::_impl::builtin_overflow_operator<multiply_op, wide_integer> test failed");
+
+        // wide_integer which does not use every digit of its rep is checked against its own limits
+        static_assert(
+                !cnl::_impl::builtin_overflow_operator<
+                        cnl::_impl::add_op, cnl::wide_integer<200>, cnl::wide_integer<200>>::value,
+                "cnl::_impl::builtin_overflow_operator<add_op, wide_integer> test failed");
+    }
+
+    TEST(duplex_integer_overflow, saturated_wide_integer)  // NOLINT
+    {
+        using saturated = cnl::overflow_integer<cnl::wide_integer<255>, cnl::saturated_overflow_tag>;
+        auto const max = saturated{cnl::numeric_limits<cnl::wide_integer<255>>::max()};
+        auto const lowest = saturated{cnl::numeric_limits<cnl::wide_integer<255>>::lowest()};
+
+        ASSERT_EQ(max, max+saturated{1});
+        ASSERT_EQ(max-saturated{1}, max+saturated{-1});
+        ASSERT_EQ(lowest, lowest-saturated{1});
+        ASSERT_EQ(max, max*saturated{2});
+        ASSERT_EQ(lowest, max*saturated{-2});
+        ASSERT_EQ(saturated{1} << 200, (saturated{1} << 100)*(saturated{1} << 100));
+    }
+
+    TEST(duplex_integer_overflow, sticky_wide_integer)  // NOLINT
+    {
+        using sticky = cnl::overflow_integer<cnl::wide_integer<128, unsigned>, cnl::sticky_overflow_tag>;
+
+        cnl::clear_overflow_status();
+        auto product = sticky{1};
+        for (auto i = 0; i!=127; ++i) {
+            product = product*sticky{2};
+        }
+        ASSERT_FALSE(cnl::overflow_status());
+
+        product = product*sticky{2};
+        ASSERT_TRUE(cnl::overflow_status());
+        cnl::clear_overflow_status();
+    }
+#endif
+}
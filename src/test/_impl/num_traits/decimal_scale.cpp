@@ -0,0 +1,88 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests for <cnl/_impl/num_traits/scale.h>
+
+#include <cnl/_impl/num_traits/scale.h>
+
+#include <cnl/_impl/type_traits/identical.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#if defined(CNL_INT128_ENABLED)
+namespace {
+    using cnl::_impl::identical;
+    using cnl::int128;
+    using cnl::uint128;
+
+    namespace test_scale {
+        static_assert(
+                identical(int128{-123}, cnl::_impl::scale<-2, 10>(int128{-12399})),
+                "cnl::scale<-2, 10, cnl::int128> truncates toward zero");
+        static_assert(
+                identical(uint128{34}, cnl::_impl::scale<-37, 10>(~uint128{0})),
+                "cnl::scale<-37, 10, cnl::uint128>");
+    }
+
+    CNL_NODISCARD uint128 power_of_ten(int exponent)
+    {
+        return exponent ? 10*power_of_ten(exponent-1) : uint128{1};
+    }
+
+    // compares the quotients of dividing edge values by 10^Exponent with those of native division
+    template<int Exponent>
+    void test_exponent()
+    {
+        auto const power = power_of_ten(Exponent);
+        auto const uint128_max = ~uint128{0};
+        auto const int128_max = static_cast<int128>(uint128_max >> 1);
+        auto const int128_min = -int128_max-1;
+
+        auto const unsigned_operands = std::vector<uint128>{
+                0, 1, power-1, power, power+1, 2*power-1, uint128_max/power*power, uint128_max/power*power-1,
+                uint128_max, uint128_max-1, int128_max, uint128{1} << 64, (uint128{1} << 64)-1};
+        for (auto const operand : unsigned_operands) {
+            EXPECT_TRUE(operand/power==cnl::_impl::decimal_divide<Exponent>(operand))
+                    << "Exponent=" << Exponent << " operand=" << static_cast<double>(operand);
+            EXPECT_TRUE((operand/power==cnl::_impl::scale<-Exponent, 10>(operand)))
+                    << "Exponent=" << Exponent << " operand=" << static_cast<double>(operand);
+        }
+
+        auto const signed_power = static_cast<int128>(power);
+        auto const signed_operands = std::vector<int128>{
+                0, 1, -1, signed_power-1, signed_power, -signed_power+1, -signed_power, int128_max, int128_min,
+                int128_min+1, int128_max/signed_power*signed_power, int128_min/signed_power*signed_power};
+        for (auto const operand : signed_operands) {
+            EXPECT_TRUE((operand/signed_power==cnl::_impl::scale<-Exponent, 10>(operand)))
+                    << "Exponent=" << Exponent << " operand=" << static_cast<double>(operand);
+        }
+    }
+
+    template<int Exponent>
+    struct test_exponents {
+        void operator()() const
+        {
+            test_exponents<Exponent-1>{}();
+            test_exponent<Exponent>();
+        }
+    };
+
+    template<>
+    struct test_exponents<0> {
+        void operator()() const
+        {
+        }
+    };
+
+    TEST(decimal_scale, every_exponent)  // NOLINT
+    {
+        test_exponents<38>{}();
+    }
+}
+#endif
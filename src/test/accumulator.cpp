@@ -0,0 +1,168 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/accumulator.h>
+
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/elastic_integer.h>
+#include <cnl/elastic_scaled_integer.h>
+#include <cnl/overflow_integer.h>
+#include <cnl/rounding_integer.h>
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace {
+    using cnl::_impl::identical;
+    using cnl::accumulate_t;
+    using cnl::accumulator;
+    using cnl::elastic_integer;
+    using cnl::power;
+    using cnl::scaled_integer;
+
+    namespace test_accumulate_t {
+        static_assert(std::is_same<elastic_integer<24>, accumulate_t<elastic_integer<24>, 1>>::value, "");
+        static_assert(std::is_same<elastic_integer<25>, accumulate_t<elastic_integer<24>, 2>>::value, "");
+        static_assert(std::is_same<elastic_integer<26>, accumulate_t<elastic_integer<24>, 3>>::value, "");
+        static_assert(std::is_same<elastic_integer<34>, accumulate_t<elastic_integer<24>, 1000>>::value, "");
+        static_assert(std::is_same<elastic_integer<34>, accumulate_t<elastic_integer<24>, 1024>>::value, "");
+        static_assert(std::is_same<elastic_integer<35>, accumulate_t<elastic_integer<24>, 1025>>::value, "");
+        static_assert(std::is_same<
+                scaled_integer<std::int32_t, power<-8>>,
+                accumulate_t<scaled_integer<std::int16_t, power<-8>>, 256>>::value, "");
+        static_assert(std::is_same<
+                cnl::elastic_scaled_integer<20, -12>,
+                accumulate_t<cnl::elastic_scaled_integer<12, -12>, 200>>::value, "");
+
+        // the widest sum which fits in the widest fundamental integer
+        static_assert(std::is_same<
+                std::int64_t,
+                accumulate_t<std::int32_t, std::uint64_t{1} << 32>>::value, "");
+
+        // wider than the widest fundamental integer when int128 is not available
+        static_assert(cnl::digits<accumulate_t<std::int64_t, 4>>::value>=65, "");
+    }
+
+    namespace test_value_type {
+        static_assert(std::is_same<
+                elastic_integer<34>,
+                accumulator<elastic_integer<24>, 1000>::value_type>::value, "");
+    }
+
+    namespace test_default_construct {
+        static_assert(identical(elastic_integer<34>{0}, accumulator<elastic_integer<24>, 1000>{}.value()), "");
+    }
+
+    namespace test_construct {
+        static_assert(identical(
+                elastic_integer<34>{-123},
+                accumulator<elastic_integer<24>, 1000>{elastic_integer<34>{-123}}.value()), "");
+    }
+
+    namespace test_convert {
+        static_assert(identical(
+                -123,
+                static_cast<int>(accumulator<elastic_integer<24>, 1000>{elastic_integer<34>{-123}})), "");
+        static_assert(identical(
+                elastic_integer<8>{-123},
+                static_cast<elastic_integer<8>>(accumulator<elastic_integer<24>, 1000>{elastic_integer<34>{-123}})),
+                "");
+    }
+
+    TEST(accumulator, elastic_integer)  // NOLINT
+    {
+        using term = elastic_integer<24>;
+        constexpr auto max_terms = 1000;
+
+        auto sum = accumulator<term, max_terms>{};
+        auto expected = std::int64_t{0};
+        for (auto index = 0; index!=max_terms; ++index) {
+            auto const value = cnl::numeric_limits<term>::max()-index;
+            sum += value;
+            expected += static_cast<std::int64_t>(value);
+        }
+        EXPECT_EQ(expected, static_cast<std::int64_t>(sum));
+    }
+
+    TEST(accumulator, elastic_integer_lowest)  // NOLINT
+    {
+        using term = elastic_integer<24>;
+        constexpr auto max_terms = 1024;
+
+        auto sum = accumulator<term, max_terms>{};
+        for (auto index = 0; index!=max_terms; ++index) {
+            sum += cnl::numeric_limits<term>::lowest();
+        }
+        EXPECT_EQ(-(std::int64_t{1} << 34)+max_terms, static_cast<std::int64_t>(sum));
+    }
+
+    TEST(accumulator, wider_than_64_bits)  // NOLINT
+    {
+        auto sum = accumulator<std::int64_t, 4>{};
+        for (auto index = 0; index!=4; ++index) {
+            sum += cnl::numeric_limits<std::int64_t>::max();
+        }
+        EXPECT_EQ(4.*static_cast<double>(cnl::numeric_limits<std::int64_t>::max()), static_cast<double>(sum.value()));
+    }
+
+    TEST(accumulator, overflow_tag)  // NOLINT
+    {
+        // past MaxTerms, the sum overflows according to the tag of the term
+        using term = cnl::overflow_integer<std::int16_t, cnl::saturated_overflow_tag>;
+        using sum_type = accumulate_t<term, 2>;
+
+        auto sum = accumulator<term, 2>{};
+        for (auto index = 0; index!=70000; ++index) {
+            sum += cnl::numeric_limits<term>::max();
+        }
+        EXPECT_EQ(cnl::numeric_limits<sum_type>::max(), sum.value());
+    }
+
+    TEST(accumulator, subtract)  // NOLINT
+    {
+        auto sum = accumulator<elastic_integer<15>, 3>{};
+        sum += elastic_integer<15>{32767};
+        sum -= elastic_integer<15>{-32767};
+        EXPECT_EQ(elastic_integer<17>{65534}, sum.value());
+        sum -= elastic_integer<15>{32767};
+        EXPECT_EQ(elastic_integer<17>{32767}, sum.value());
+    }
+
+    TEST(accumulator, elastic_scaled_integer)  // NOLINT
+    {
+        using term = cnl::elastic_scaled_integer<12, -12>;
+
+        auto sum = accumulator<term, 200>{};
+        for (auto index = 0; index!=200; ++index) {
+            sum += term{.75};
+        }
+        EXPECT_EQ(150., static_cast<double>(sum));
+    }
+
+    TEST(accumulator, convert_term)  // NOLINT
+    {
+        // terms are converted to the accumulator's type, so the same rules apply as to static_cast
+        auto sum = accumulator<scaled_integer<std::int16_t, power<-8>>, 4>{};
+        sum += 1.5;
+        sum += scaled_integer<std::int8_t, power<-2>>{-.25};
+        EXPECT_EQ(1.25, static_cast<double>(sum));
+    }
+
+    TEST(accumulator, rounding_integer)  // NOLINT
+    {
+        using term = scaled_integer<cnl::rounding_integer<std::int16_t>, power<-4>>;
+
+        auto sum = accumulator<term, 16>{};
+        sum += .5;
+        sum += .75;
+        EXPECT_EQ(1, static_cast<scaled_integer<cnl::rounding_integer<std::int32_t>>>(sum.value()));
+        sum += .25;
+        EXPECT_EQ(2, static_cast<scaled_integer<cnl::rounding_integer<std::int32_t>>>(sum.value()));
+    }
+}
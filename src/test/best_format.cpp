@@ -0,0 +1,110 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/best_format.h>
+
+#include <cnl/_impl/type_traits/identical.h>
+
+#include <cstdint>
+#include <ratio>
+
+namespace {
+    using cnl::_impl::identical;
+    using cnl::best_format;
+    using cnl::best_format_t;
+    using cnl::power;
+    using cnl::scaled_integer;
+
+    namespace test_exponent {
+        static_assert(
+                identical(0, best_format<std::ratio<0>, std::ratio<1>, std::ratio<1>>::exponent),
+                "cnl::best_format");
+        static_assert(
+                identical(1, best_format<std::ratio<0>, std::ratio<1>, std::ratio<3>>::exponent),
+                "cnl::best_format");
+        static_assert(
+                identical(-1, best_format<std::ratio<0>, std::ratio<1>, std::ratio<1, 2>>::exponent),
+                "cnl::best_format");
+        static_assert(
+                identical(-2, best_format<std::ratio<0>, std::ratio<1>, std::ratio<2, 5>>::exponent),
+                "cnl::best_format");
+        static_assert(
+                identical(-7, best_format<std::ratio<0>, std::ratio<1>, std::ratio<1, 100>>::exponent),
+                "cnl::best_format");
+    }
+
+    namespace test_bounds {
+        // bounds are rounded outward
+        using symmetric = best_format<std::ratio<-13, 10>, std::ratio<13, 10>, std::ratio<1, 4>>;
+        static_assert(identical(cnl::intmax{-6}, symmetric::min_rep), "cnl::best_format");
+        static_assert(identical(cnl::intmax{6}, symmetric::max_rep), "cnl::best_format");
+
+        using coarse = best_format<std::ratio<0>, std::ratio<1000000>, std::ratio<1000>>;
+        static_assert(identical(cnl::intmax{0}, coarse::min_rep), "cnl::best_format");
+        static_assert(identical(cnl::intmax{1954}, coarse::max_rep), "cnl::best_format");
+        static_assert(identical(11, coarse::digits), "cnl::best_format");
+
+        // a positive exponent and a large denominator
+        using tiny = best_format<std::ratio<0>, std::ratio<1, 1000000000000000000>, std::ratio<1000>>;
+        static_assert(identical(cnl::intmax{0}, tiny::min_rep), "cnl::best_format");
+        static_assert(identical(cnl::intmax{1}, tiny::max_rep), "cnl::best_format");
+        static_assert(
+                identical(cnl::intmax{-1}, cnl::_impl::best_format_bound(-1, 1000000000000000000, 62, true)),
+                "cnl::_impl::best_format_bound");
+    }
+
+    namespace test_bound_fits {
+        static_assert(cnl::_impl::best_format_bound_fits(-1000, -50), "cnl::_impl::best_format_bound_fits");
+        static_assert(cnl::_impl::best_format_bound_fits(1000000000000, 30), "cnl::_impl::best_format_bound_fits");
+        static_assert(
+                !cnl::_impl::best_format_bound_fits(-1000000000000000000, -70),
+                "a negative bound whose scaled magnitude overflows");
+        static_assert(
+                !cnl::_impl::best_format_bound_fits(1000000000000000000, -70),
+                "a positive bound whose scaled magnitude overflows");
+        static_assert(
+                !cnl::_impl::best_format_bound_fits(0, -cnl::digits<cnl::intmax>::value),
+                "a shift as wide as the widest integer");
+    }
+
+    namespace test_type {
+        static_assert(
+                identical(
+                        scaled_integer<std::uint8_t, power<0>>{},
+                        best_format_t<std::ratio<0>, std::ratio<255>, std::ratio<1>>{}),
+                "cnl::best_format");
+        static_assert(
+                identical(
+                        scaled_integer<std::uint16_t, power<0>>{},
+                        best_format_t<std::ratio<0>, std::ratio<256>, std::ratio<1>>{}),
+                "cnl::best_format");
+        static_assert(
+                identical(
+                        scaled_integer<std::int8_t, power<0>>{},
+                        best_format_t<std::ratio<-128>, std::ratio<127>, std::ratio<1>>{}),
+                "cnl::best_format");
+        static_assert(
+                identical(
+                        scaled_integer<std::int16_t, power<-7>>{},
+                        best_format_t<std::ratio<-100>, std::ratio<100>, std::ratio<1, 100>>{}),
+                "cnl::best_format");
+        static_assert(
+                identical(
+                        scaled_integer<std::int32_t, power<-30>>{},
+                        best_format_t<std::ratio<-1>, std::ratio<1>, std::ratio<1, 1000000000>>{}),
+                "cnl::best_format");
+        static_assert(
+                identical(
+                        scaled_integer<std::uint16_t, power<9>>{},
+                        best_format_t<std::ratio<0>, std::ratio<1000000>, std::ratio<1000>>{}),
+                "cnl::best_format");
+        static_assert(
+                identical(
+                        scaled_integer<std::uint64_t, power<-40>>{},
+                        best_format_t<std::ratio<0>, std::ratio<1000000>, std::ratio<1, 1000000000000>>{}),
+                "cnl::best_format");
+    }
+}
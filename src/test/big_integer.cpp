@@ -0,0 +1,151 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/big_integer.h>
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace {
+    using cnl::arena_big_integer;
+    using cnl::big_integer;
+    using cnl::power;
+    using cnl::scaled_integer;
+
+    namespace test_traits {
+        static_assert(cnl::is_signed<big_integer>::value, "cnl::is_signed<cnl::big_integer>");
+        static_assert(!cnl::numeric_limits<big_integer>::is_bounded, "cnl::numeric_limits<cnl::big_integer>");
+        static_assert(
+                std::is_same<big_integer, cnl::set_digits_t<big_integer, 1000>>::value,
+                "cnl::set_digits<cnl::big_integer>");
+        static_assert(
+                std::is_same<
+                        scaled_integer<big_integer, power<-40>>,
+                        decltype(scaled_integer<big_integer, power<-20>>{}*scaled_integer<big_integer, power<-20>>{})
+                >::value,
+                "cnl::scaled_integer<cnl::big_integer> multiplication");
+    }
+
+    // 30!
+    big_integer factorial30()
+    {
+        big_integer result = 1;
+        for (auto factor = 2; factor<=30; ++factor) {
+            result = std::move(result)*factor;
+        }
+        return result;
+    }
+
+    TEST(big_integer, matches_int64)  // NOLINT
+    {
+        std::int64_t const values[] = {
+                0, 1, -1, 7, -7, 0xffffffffLL, -0x100000000LL, 0x7fffffffffffLL, -0x123456789abcLL};
+        for (auto a : values) {
+            for (auto b : values) {
+                EXPECT_EQ(a+b, static_cast<std::int64_t>(big_integer{a}+big_integer{b}));
+                EXPECT_EQ(a-b, static_cast<std::int64_t>(big_integer{a}-big_integer{b}));
+                EXPECT_EQ(a<b, big_integer{a}<big_integer{b});
+                EXPECT_EQ(a==b, big_integer{a}==big_integer{b});
+                if (b) {
+                    EXPECT_EQ(a/b, static_cast<std::int64_t>(big_integer{a}/big_integer{b}));
+                    EXPECT_EQ(a%b, static_cast<std::int64_t>(big_integer{a}%big_integer{b}));
+                }
+            }
+            EXPECT_EQ(a*3, static_cast<std::int64_t>(big_integer{a}*3));
+            EXPECT_EQ(a >> 5, static_cast<std::int64_t>(big_integer{a} >> 5));
+            EXPECT_EQ(-a, static_cast<std::int64_t>(-big_integer{a}));
+        }
+    }
+
+    TEST(big_integer, arbitrary_precision)  // NOLINT
+    {
+        auto const f = factorial30();
+        EXPECT_EQ(265252859812191058636308480000000., static_cast<double>(f));
+
+        auto quotient = f;
+        for (auto divisor = 30; divisor>=2; --divisor) {
+            quotient = std::move(quotient)/divisor;
+        }
+        EXPECT_EQ(1, quotient);
+
+        // multi-limb divisor
+        auto const dividend = f*f+12345;
+        auto const divisor = f+7;
+        auto const remainder = dividend%divisor;
+        EXPECT_EQ(dividend, dividend/divisor*divisor+remainder);
+        EXPECT_TRUE(remainder>=0 && remainder<divisor);
+
+        EXPECT_EQ(big_integer{1} << 100, big_integer{1e30} >> 99 << 100);
+        EXPECT_EQ(-1, big_integer{-3} >> 100);
+        EXPECT_EQ(big_integer{std::uint64_t{1} << 63}*4, big_integer{1} << 65);
+    }
+
+    TEST(big_integer, small_buffer)  // NOLINT
+    {
+        big_integer const small{std::uint64_t{0x123456789abcdef0}};
+        EXPECT_EQ(big_integer::inline_limbs, small.capacity());
+
+        auto const large = small << 200;
+        EXPECT_LT(big_integer::inline_limbs, large.capacity());
+    }
+
+    TEST(big_integer, rvalue_operands_reuse_storage)  // NOLINT
+    {
+        auto value = factorial30()*factorial30();
+        auto const* const limbs = value.data();
+
+        auto result = std::move(value)+factorial30()-1234567;
+        EXPECT_EQ(limbs, result.data());
+
+        result = 1+std::move(result)*3;
+        EXPECT_EQ(limbs, result.data());
+        EXPECT_EQ((factorial30()*factorial30()+factorial30()-1234567)*3+1, result);
+    }
+
+    TEST(big_integer, arena)  // NOLINT
+    {
+        cnl::big_integer_arena arena(64);
+        {
+            cnl::big_integer_arena::scope scope(arena);
+            auto const value = arena_big_integer{1} << 300;
+            EXPECT_EQ(&arena, value.get_allocator().arena());
+            EXPECT_LT(0u, arena.used());
+            EXPECT_EQ(arena_big_integer{1} << 302, value*4);
+        }
+        EXPECT_EQ(nullptr, arena_big_integer{}.get_allocator().arena());
+
+        // exhausted arena falls back to the heap
+        arena.release();
+        {
+            cnl::big_integer_arena::scope scope(arena);
+            auto const value = arena_big_integer{1} << 3000;
+            EXPECT_EQ(0u, arena.used());
+            EXPECT_EQ(1, value >> 3000);
+        }
+    }
+
+    TEST(big_integer, scaled_integer_rep)  // NOLINT
+    {
+        using fixed = scaled_integer<big_integer, power<-64>>;
+        auto const a = fixed{1.5};
+        auto const b = fixed{-2.25};
+        EXPECT_EQ(-.75, static_cast<double>(a+b));
+        EXPECT_EQ(3.75, static_cast<double>(a-b));
+        EXPECT_EQ(-3.375, static_cast<double>(a*b));
+        EXPECT_EQ(-1.125, static_cast<double>(b/2));
+
+        // the product has 128 fractional digits and no overflow
+        auto const c = fixed{1e15}*fixed{1e15};
+        EXPECT_EQ(1e30, static_cast<double>(c));
+
+        // as with fundamental integers, conversion truncates toward zero
+        EXPECT_EQ(-2., static_cast<double>(scaled_integer<big_integer, power<-1>>{b}));
+    }
+}
@@ -0,0 +1,159 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/biquad_cascade.h>
+
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+namespace {
+    using cnl::biquad_cascade;
+    using cnl::fixed_array;
+    using cnl::fixed_vector;
+    using cnl::power;
+    using cnl::scaled_integer;
+
+    using q15 = scaled_integer<std::int16_t, power<-15>>;
+    using q14 = scaled_integer<std::int16_t, power<-14>>;
+    using coefficients = cnl::biquad_coefficients<q14>;
+
+    // second-order Butterworth low-pass filter with a cut-off of a tenth of the sample rate
+    constexpr double lowpass[] = {.0674552738890719, .1349105477781438, .0674552738890719,
+                                  -1.1429805025399011, .4128015980961886};
+
+    coefficients make_lowpass()
+    {
+        return coefficients{lowpass[0], lowpass[1], lowpass[2], lowpass[3], lowpass[4]};
+    }
+
+    fixed_vector<q15> make_signal(std::size_t size)
+    {
+        auto signal = fixed_vector<q15>(size);
+        for (std::size_t index = 0; index!=size; ++index) {
+            signal[index] = .45*std::sin(static_cast<double>(index)*.3)+.4*std::sin(static_cast<double>(index)*2.1);
+        }
+        return signal;
+    }
+
+    namespace test_accumulator {
+        using section = cnl::_impl::biquad_section<cnl::direct_form_1_tag, q15, q14, cnl::nearest_rounding_tag,
+                cnl::saturated_overflow_tag>;
+        static_assert(std::is_same<scaled_integer<std::int64_t, power<-29>>, section::accumulator>::value, "");
+
+        using state = cnl::_impl::biquad_section<cnl::transposed_direct_form_2_tag, q15, q14,
+                cnl::nearest_rounding_tag, cnl::saturated_overflow_tag>::state;
+        static_assert(std::is_same<scaled_integer<std::int64_t, power<-29>>, state>::value, "");
+    }
+
+    template<class Form>
+    void test_against_reference()
+    {
+        auto filter = biquad_cascade<q15, 2, Form, q14>(fixed_array<coefficients, 2>{{make_lowpass(), make_lowpass()}});
+        auto const input = make_signal(200);
+        auto const output = filter.process(input);
+
+        double state[2][4] = {};
+        for (std::size_t index = 0; index!=input.size(); ++index) {
+            auto sample = static_cast<double>(input[index]);
+            for (auto& s : state) {
+                auto const y = lowpass[0]*sample+lowpass[1]*s[0]+lowpass[2]*s[1]-lowpass[3]*s[2]-lowpass[4]*s[3];
+                s[1] = s[0];
+                s[0] = sample;
+                s[3] = s[2];
+                s[2] = y;
+                sample = y;
+            }
+            EXPECT_NEAR(sample, static_cast<double>(output[index]), 16./32768.) << "index=" << index;
+        }
+    }
+
+    TEST(biquad_cascade, direct_form_1)  // NOLINT
+    {
+        test_against_reference<cnl::direct_form_1_tag>();
+    }
+
+    TEST(biquad_cascade, direct_form_1_error_feedback)  // NOLINT
+    {
+        test_against_reference<cnl::direct_form_1_error_feedback_tag>();
+    }
+
+    TEST(biquad_cascade, transposed_direct_form_2)  // NOLINT
+    {
+        test_against_reference<cnl::transposed_direct_form_2_tag>();
+    }
+
+    template<class Form>
+    void test_interleaved()
+    {
+        auto const sections = fixed_array<coefficients, 3>{{
+                make_lowpass(),
+                coefficients{.5, -.25, .125, -.5, .25},
+                make_lowpass()}};
+        auto const input = make_signal(23);
+
+        auto sequential = biquad_cascade<q15, 3, Form, q14>(sections);
+        auto expected = fixed_vector<q15>(input.size());
+        for (std::size_t index = 0; index!=input.size(); ++index) {
+            expected[index] = sequential(input[index]);
+        }
+
+        // blocks which are shorter and longer than the number of sections
+        auto interleaved = biquad_cascade<q15, 3, Form, q14>(sections);
+        auto actual = fixed_vector<q15>(input.size());
+        interleaved.process(input.data(), actual.data(), 1);
+        interleaved.process(input.data()+1, actual.data()+1, 2);
+        interleaved.process(input.data()+3, actual.data()+3, 0);
+        interleaved.process(input.data()+3, actual.data()+3, input.size()-3);
+
+        for (std::size_t index = 0; index!=input.size(); ++index) {
+            EXPECT_EQ(expected[index], actual[index]) << "index=" << index;
+        }
+    }
+
+    TEST(biquad_cascade, interleaved)  // NOLINT
+    {
+        test_interleaved<cnl::direct_form_1_tag>();
+        test_interleaved<cnl::direct_form_1_error_feedback_tag>();
+        test_interleaved<cnl::transposed_direct_form_2_tag>();
+    }
+
+    TEST(biquad_cascade, saturated)  // NOLINT
+    {
+        auto filter = biquad_cascade<q15, 1, cnl::direct_form_1_tag, q14>(
+                fixed_array<coefficients, 1>{{coefficients{1.5, 0., 0., 0., 0.}}});
+        EXPECT_EQ(cnl::numeric_limits<q15>::max(), filter(q15{.75}));
+        EXPECT_EQ(cnl::numeric_limits<q15>::lowest(), filter(q15{-.75}));
+        EXPECT_EQ(q15{.75}, filter(q15{.5}));
+    }
+
+    TEST(biquad_cascade, error_feedback)  // NOLINT
+    {
+        // with truncation, the DC error of the output is reduced by feeding back the rounding error
+        auto const sections = fixed_array<coefficients, 1>{{make_lowpass()}};
+        auto plain = biquad_cascade<q15, 1, cnl::direct_form_1_tag, q14, cnl::native_rounding_tag>(sections);
+        auto shaped = biquad_cascade<q15, 1, cnl::direct_form_1_error_feedback_tag, q14, cnl::native_rounding_tag>(
+                sections);
+
+        auto const input = q15{.0001};
+        auto plain_error = 0.;
+        auto shaped_error = 0.;
+        for (auto index = 0; index!=1000; ++index) {
+            auto const plain_output = static_cast<double>(plain(input));
+            auto const shaped_output = static_cast<double>(shaped(input));
+            if (index>=500) {
+                plain_error += plain_output-static_cast<double>(input);
+                shaped_error += shaped_output-static_cast<double>(input);
+            }
+        }
+        EXPECT_LT(std::fabs(shaped_error), std::fabs(plain_error));
+        EXPECT_LT(std::fabs(shaped_error/500.), 1./32768.);
+    }
+}
@@ -0,0 +1,166 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/block_scaled_array.h>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+    using cnl::block_scaled_array;
+    using cnl::fixed_array;
+    using cnl::power;
+    using cnl::scaled_integer;
+
+    using q15 = scaled_integer<std::int16_t, power<-15>>;
+    using s15_16 = scaled_integer<std::int32_t, power<-16>>;
+
+    namespace test_block_scale {
+        // shifts of the full width of the integer, or more, are evaluated without undefined behavior
+        static_assert(0U==cnl::_impl::block_scale(0x80000000U, -32), "cnl::_impl::block_scale");
+        static_assert(0U==cnl::_impl::block_scale(0x80000000U, -41), "cnl::_impl::block_scale");
+        static_assert(0U==cnl::_impl::block_scale(0x80000000U, 32), "cnl::_impl::block_scale");
+        static_assert(0U==cnl::_impl::block_scale(0x80000000U, 41), "cnl::_impl::block_scale");
+        static_assert(1U==cnl::_impl::block_scale(0x80000000U, -31), "cnl::_impl::block_scale");
+        static_assert(-1==cnl::_impl::block_scale(-5, -32), "cnl::_impl::block_scale");
+        static_assert(-1==cnl::_impl::block_scale(-5, -41), "cnl::_impl::block_scale");
+        static_assert(0==cnl::_impl::block_scale(5, -31), "cnl::_impl::block_scale");
+        static_assert(0==cnl::_impl::block_scale(5, 32), "cnl::_impl::block_scale");
+        static_assert(-128==cnl::_impl::block_scale(std::int8_t{1}, 7), "cnl::_impl::block_scale");
+        static_assert(0==cnl::_impl::block_scale(std::int8_t{1}, 8), "cnl::_impl::block_scale");
+    }
+
+    template<typename T, std::size_t N>
+    std::vector<T> elements(fixed_array<T, N> const& array)
+    {
+        return std::vector<T>(array.begin(), array.end());
+    }
+
+    TEST(block_scaled_array, default_ctor)  // NOLINT
+    {
+        auto const block = block_scaled_array<std::int16_t, 4>{};
+        EXPECT_EQ(0, block.exponent());
+        EXPECT_EQ((std::vector<std::int16_t>{0, 0, 0, 0}), elements(block.mantissas()));
+    }
+
+    TEST(block_scaled_array, from_scaled_integer)  // NOLINT
+    {
+        auto const block = block_scaled_array<std::int16_t, 3>(fixed_array<q15, 3>{{.5, -.25, .75}});
+        EXPECT_EQ(-15, block.exponent());
+        EXPECT_EQ(16384, block[0]);
+        EXPECT_EQ(-8192, block[1]);
+        EXPECT_EQ(24576, block[2]);
+    }
+
+    TEST(block_scaled_array, from_wider_scaled_integer)  // NOLINT
+    {
+        // 1000.5 needs 26 digits at this exponent so the block is shifted right by 11 bits to fit int16_t
+        auto const block = block_scaled_array<std::int16_t, 2>(fixed_array<s15_16, 2>{{1000.5, -3.}});
+        EXPECT_EQ(-5, block.exponent());
+        EXPECT_EQ(32016, block[0]);
+        EXPECT_EQ(-96, block[1]);
+    }
+
+    TEST(block_scaled_array, to_scaled_integer)  // NOLINT
+    {
+        auto const block = block_scaled_array<std::int16_t, 3>(fixed_array<std::int16_t, 3>{{3, -5, 100}}, 4);
+        EXPECT_EQ(
+                (std::vector<s15_16>{48, -80, 1600}),
+                elements(static_cast<fixed_array<s15_16, 3>>(block)));
+
+        auto const fractions = block_scaled_array<std::int16_t, 2>(fixed_array<std::int16_t, 2>{{3, -3}}, -1);
+        EXPECT_EQ(
+                (std::vector<scaled_integer<std::int8_t>>{1, -2}),
+                elements(static_cast<fixed_array<scaled_integer<std::int8_t>, 2>>(fractions)));
+    }
+
+    TEST(block_scaled_array, normalize)  // NOLINT
+    {
+        auto block = block_scaled_array<std::int16_t, 3>(fixed_array<std::int16_t, 3>{{3, -5, 100}}, 4);
+        block.normalize();
+        EXPECT_EQ(-4, block.exponent());
+        EXPECT_EQ((std::vector<std::int16_t>{768, -1280, 25600}), elements(block.mantissas()));
+
+        auto zeros = block_scaled_array<std::int16_t, 2>(fixed_array<std::int16_t, 2>{{0, 0}}, 7);
+        zeros.normalize();
+        EXPECT_EQ(7, zeros.exponent());
+
+        auto minimum = block_scaled_array<std::int16_t, 2>(fixed_array<std::int16_t, 2>{{-1, 0}}, 0);
+        minimum.normalize();
+        EXPECT_EQ(-15, minimum.exponent());
+        EXPECT_EQ(-32768, minimum[0]);
+    }
+
+    TEST(block_scaled_array, add)  // NOLINT
+    {
+        auto const lhs = block_scaled_array<std::int16_t, 2>(fixed_array<std::int16_t, 2>{{20000, -3}}, 0);
+        auto const rhs = block_scaled_array<std::int16_t, 2>(fixed_array<std::int16_t, 2>{{5000, 12}}, 2);
+        auto const sum = lhs+rhs;
+
+        // 20000+20000 and -3+48 need 16 digits so the block is shifted right by one bit
+        EXPECT_EQ(1, sum.exponent());
+        EXPECT_EQ(20000, sum[0]);
+        EXPECT_EQ(22, sum[1]);
+    }
+
+    TEST(block_scaled_array, subtract)  // NOLINT
+    {
+        auto const lhs = block_scaled_array<std::int16_t, 2>(fixed_array<std::int16_t, 2>{{100, 7}}, -3);
+        auto const rhs = block_scaled_array<std::int16_t, 2>(fixed_array<std::int16_t, 2>{{10, -1}}, -2);
+        auto const difference = lhs-rhs;
+
+        EXPECT_EQ(-3, difference.exponent());
+        EXPECT_EQ(80, difference[0]);
+        EXPECT_EQ(9, difference[1]);
+    }
+
+    TEST(block_scaled_array, negate)  // NOLINT
+    {
+        auto const block = block_scaled_array<std::int16_t, 2>(fixed_array<std::int16_t, 2>{{-32768, 5}}, 3);
+        auto const negative = -block;
+        EXPECT_EQ(4, negative.exponent());
+        EXPECT_EQ(16384, negative[0]);
+        EXPECT_EQ(-3, negative[1]);
+    }
+
+    TEST(block_scaled_array, multiply)  // NOLINT
+    {
+        auto const lhs = block_scaled_array<std::int16_t, 2>(fixed_array<std::int16_t, 2>{{300, -2}}, -8);
+        auto const rhs = block_scaled_array<std::int16_t, 2>(fixed_array<std::int16_t, 2>{{200, 1000}}, 1);
+        auto const product = lhs*rhs;
+
+        // 60000 needs 16 digits
+        EXPECT_EQ(-6, product.exponent());
+        EXPECT_EQ(30000, product[0]);
+        EXPECT_EQ(-1000, product[1]);
+    }
+
+    TEST(block_scaled_array, shift)  // NOLINT
+    {
+        auto const block = block_scaled_array<std::int16_t, 2>(fixed_array<std::int16_t, 2>{{1, 2}}, 0);
+        EXPECT_EQ(5, (block << 5).exponent());
+        EXPECT_EQ(-5, (block >> 5).exponent());
+        EXPECT_EQ(elements(block.mantissas()), elements((block >> 5).mantissas()));
+    }
+
+    TEST(block_scaled_array, dynamic_range)  // NOLINT
+    {
+        // the values of two frames differ greatly in magnitude but each frame is represented with full precision
+        auto quiet = block_scaled_array<std::int16_t, 3>(
+                fixed_array<q15, 3>{{.0009765625, -.001953125, .00146484375}});
+        auto loud = block_scaled_array<std::int16_t, 3>(fixed_array<s15_16, 3>{{1024., -2048., 1536.}});
+        quiet.normalize();
+        loud.normalize();
+
+        EXPECT_EQ((std::vector<std::int16_t>{16384, -32768, 24576}), elements(quiet.mantissas()));
+        EXPECT_EQ(elements(quiet.mantissas()), elements(loud.mantissas()));
+        EXPECT_EQ(-24, quiet.exponent());
+        EXPECT_EQ(-4, loud.exponent());
+    }
+}
@@ -0,0 +1,152 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/bounded_integer.h>
+
+#include <cnl/_impl/type_traits/identical.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace {
+    using cnl::_impl::identical;
+    using cnl::bounded_integer;
+    using cnl::constant;
+
+    namespace test_rep {
+        static_assert(std::is_same<std::uint8_t, bounded_integer<0, 255>::rep>::value, "");
+        static_assert(std::is_same<std::int8_t, bounded_integer<-128, 127>::rep>::value, "");
+        static_assert(std::is_same<std::int16_t, bounded_integer<-129, 0>::rep>::value, "");
+        static_assert(std::is_same<std::uint16_t, bounded_integer<0, 256>::rep>::value, "");
+        static_assert(sizeof(bounded_integer<-1000, 1000>)==2, "");
+    }
+
+    namespace test_arithmetic {
+        using digit = bounded_integer<0, 9>;
+
+        static_assert(identical(bounded_integer<0, 18>{17}, digit{8}+digit{9}), "");
+        static_assert(identical(bounded_integer<-9, 9>{-1}, digit{8}-digit{9}), "");
+        static_assert(identical(bounded_integer<0, 81>{72}, digit{8}*digit{9}), "");
+        static_assert(identical(bounded_integer<-9, 0>{-7}, -digit{7}), "");
+        static_assert(identical(bounded_integer<-45, 36>{-20}, bounded_integer<-5, 4>{4}*bounded_integer<-5, 9>{-5}), "");
+    }
+
+    namespace test_divide {
+        static_assert(identical(bounded_integer<0, 50>{33}, bounded_integer<0, 100>{100}/bounded_integer<2, 3>{3}), "");
+        static_assert(identical(bounded_integer<-50, 0>{-33}, bounded_integer<0, 100>{100}/bounded_integer<-3, -2>{-3}), "");
+
+        static_assert(identical(
+                bounded_integer<-100, 100>{-25},
+                bounded_integer<-100, 100>{100}/bounded_integer<-4, -1>{-4}), "");
+
+        // a divisor whose range includes zero must first be converted to a range which excludes it
+        static_assert(identical(
+                bounded_integer<0, 100>{50},
+                bounded_integer<0, 100>{100}/bounded_integer<1, 7>{bounded_integer<0, 7>{2}}), "");
+    }
+
+    namespace test_constant {
+        static_assert(identical(bounded_integer<10, 19>{15}, bounded_integer<0, 9>{5}+constant<10>{}), "");
+        static_assert(identical(bounded_integer<-2, 7>{0}, constant<7>{}-bounded_integer<0, 9>{7}), "");
+        static_assert(identical(bounded_integer<-10, 0>{-6}, bounded_integer<0, 5>{3}*constant<-2>{}), "");
+        static_assert(identical(bounded_integer<5, 5>{5}, bounded_integer<5, 5>{constant<5>{}}), "");
+        static_assert(bounded_integer<0, 9>{5}==constant<5>{}, "");
+        static_assert(constant<4>{}<bounded_integer<0, 9>{5}, "");
+    }
+
+    namespace test_shift {
+        static_assert(identical(bounded_integer<-40, 24>{-16}, bounded_integer<-5, 3>{-2} << constant<3>{}), "");
+        static_assert(identical(bounded_integer<-3, 2>{-1}, bounded_integer<-5, 5>{-1} >> constant<1>{}), "");
+        static_assert(identical(bounded_integer<0, 255>{255}, bounded_integer<0, 65535>{65535} >> constant<8>{}), "");
+    }
+
+    namespace test_compare {
+        static_assert(bounded_integer<-5, 5>{-1}<bounded_integer<0, 255>{0}, "");
+        static_assert(bounded_integer<0, 1000>{1000}>bounded_integer<-128, 127>{127}, "");
+        static_assert(bounded_integer<-5, 5>{3}==bounded_integer<0, 70000>{3}, "");
+    }
+
+    namespace test_convert {
+        // conversions which are known to be safe are not checked and so may be evaluated at compile time
+        static_assert(identical(std::int8_t{-100}, static_cast<std::int8_t>(bounded_integer<-100, 100>{-100})), "");
+        static_assert(identical(
+                bounded_integer<-200, 200>{-100},
+                bounded_integer<-200, 200>{bounded_integer<-100, 100>{-100}}), "");
+        static_assert(identical(bounded_integer<0, 255>{200}, bounded_integer<0, 255>{std::uint8_t{200}}), "");
+        static_assert(identical(2.5, static_cast<double>(bounded_integer<0, 9>{5})/2), "");
+    }
+
+    namespace test_saturated {
+        using percentage = bounded_integer<0, 100, cnl::saturated_overflow_tag>;
+
+        static_assert(identical(percentage{100}, percentage{150}), "");
+        static_assert(identical(percentage{0}, percentage{-5}), "");
+        static_assert(identical(percentage{100}, percentage{bounded_integer<0, 9>{7}*constant<20>{}}), "");
+        static_assert(identical(
+                std::int8_t{127},
+                static_cast<std::int8_t>(bounded_integer<0, 1000, cnl::saturated_overflow_tag>{1000})), "");
+        static_assert(identical(
+                std::uint8_t{0},
+                static_cast<std::uint8_t>(bounded_integer<-10, 10, cnl::saturated_overflow_tag>{-10})), "");
+    }
+
+    TEST(bounded_integer, sticky)  // NOLINT
+    {
+        // the value returned by the overflow handler is clamped to the range, not to the limits of the rep
+        using percentage = bounded_integer<0, 100, cnl::sticky_overflow_tag>;
+        cnl::clear_overflow_status();
+        EXPECT_EQ(100, static_cast<int>(percentage{150}));
+        EXPECT_TRUE(cnl::overflow_status());
+
+        cnl::clear_overflow_status();
+        EXPECT_EQ(10, static_cast<int>(bounded_integer<10, 20, cnl::sticky_overflow_tag>{-5}));
+        EXPECT_TRUE(cnl::overflow_status());
+        cnl::clear_overflow_status();
+    }
+
+    TEST(bounded_integer, instrumented)  // NOLINT
+    {
+        using tag = cnl::instrumented_overflow_tag<cnl::saturated_overflow_tag, struct bounded_integer_bucket>;
+        using percentage = bounded_integer<0, 100, tag>;
+        EXPECT_EQ(100, static_cast<int>(percentage{150}));
+        EXPECT_EQ(0, static_cast<int>(percentage{-5}));
+    }
+
+    TEST(bounded_integer, run_time)  // NOLINT
+    {
+        auto const sum = [](bounded_integer<0, 255> a, bounded_integer<0, 255> b) { return a+b; };
+        auto const result = sum(200, 100);
+        static_assert(std::is_same<bounded_integer<0, 510>, decltype(sum(0, 0))>::value, "");
+        EXPECT_EQ(300, static_cast<int>(result));
+    }
+
+#if defined(CNL_EXCEPTIONS_ENABLED)
+    TEST(bounded_integer, throwing)  // NOLINT
+    {
+        using digit = bounded_integer<0, 9, cnl::throwing_overflow_tag>;
+        auto const ten = bounded_integer<0, 18, cnl::throwing_overflow_tag>{digit{5}+digit{5}};
+        EXPECT_THROW(digit{ten}, std::overflow_error);
+        EXPECT_THROW(digit{-1}, std::overflow_error);
+        EXPECT_EQ(7, static_cast<int>(digit{ten-digit{3}}));
+    }
+#endif
+
+#if !defined(CNL_UNREACHABLE_UB_ENABLED)
+    TEST(bounded_integer, trapping)  // NOLINT
+    {
+        auto const int_max = cnl::numeric_limits<int>::max();
+        ASSERT_DEATH((void)(bounded_integer<0, 1000>{int_max}), "positive overflow");
+        ASSERT_DEATH(
+                (void)static_cast<std::int8_t>(bounded_integer<-1000, 0>{-129}), "negative overflow");
+
+        // a zero divisor is caught when it is converted to a range which excludes zero
+        auto const divisor = bounded_integer<0, 7>{0};
+        ASSERT_DEATH((void)(bounded_integer<0, 100>{100}/bounded_integer<1, 7>{divisor}), "negative overflow");
+    }
+#endif
+}
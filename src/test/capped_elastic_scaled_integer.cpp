@@ -0,0 +1,98 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/capped_elastic_scaled_integer.h>
+
+#include <cnl/_impl/type_traits/identical.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace {
+    using cnl::_impl::identical;
+    using cnl::capped_elastic_scaled_integer;
+    using cnl::capped_elastic_tag;
+    using cnl::elastic_scaled_integer;
+
+    using q15 = capped_elastic_scaled_integer<15, -15>;
+
+    namespace test_construct {
+        static_assert(identical(elastic_scaled_integer<15, -15>{.5}, q15{.5}.value()), "");
+        static_assert(identical(.5, static_cast<double>(q15{.5})), "");
+    }
+
+    namespace test_below_cap {
+        // results which fit within the cap are exact, as with elastic_scaled_integer
+        static_assert(identical(
+                capped_elastic_scaled_integer<30, -30>{.25},
+                q15{.5}*q15{.5}), "");
+        static_assert(identical(
+                capped_elastic_scaled_integer<16, -15>{-1.25},
+                q15{-.5}-q15{.75}), "");
+        static_assert(identical(
+                capped_elastic_scaled_integer<15, -15>{-.5},
+                -q15{.5}), "");
+    }
+
+    namespace test_cap {
+        using q31 = capped_elastic_scaled_integer<31, -31>;
+
+        // the 62-digit product loses its 31 lowest digits
+        static_assert(identical(
+                capped_elastic_scaled_integer<31, -31>{.25},
+                q31{.5}*q31{.5}), "");
+
+        // the 32-digit sum loses one digit
+        static_assert(identical(
+                capped_elastic_scaled_integer<31, -30>{1.},
+                q31{.5}+q31{.5}), "");
+
+        // the lowest digit is rounded to nearest
+        static_assert(identical(
+                capped_elastic_scaled_integer<31, -30>{0x40000001/1073741824.},
+                q31{.5}+q31{.5000000009313225746154785}), "");
+    }
+
+    namespace test_assign {
+        static_assert(identical(q15{.5}, q15{capped_elastic_scaled_integer<30, -30>{.5}}), "");
+    }
+
+    namespace test_rounding_tag {
+        using tag = capped_elastic_tag<8, cnl::native_rounding_tag>;
+        using s3_4 = capped_elastic_scaled_integer<7, -4, tag>;
+
+        // 1.9375 * 1.875 = 3.6328125 is truncated to 3.5 rather than rounded to 3.75
+        static_assert(identical(
+                capped_elastic_scaled_integer<8, -2, tag>{3.5},
+                s3_4{1.9375}*s3_4{1.875}), "");
+        static_assert(identical(
+                capped_elastic_scaled_integer<8, -2, capped_elastic_tag<8>>{3.75},
+                capped_elastic_scaled_integer<7, -4, capped_elastic_tag<8>>{1.9375}
+                *capped_elastic_scaled_integer<7, -4, capped_elastic_tag<8>>{1.875}), "");
+    }
+
+    namespace test_compare {
+        static_assert(q15{.5}==capped_elastic_scaled_integer<30, -30>{.5}, "");
+        static_assert(q15{.5}!=q15{.25}, "");
+        static_assert(q15{.25}<q15{.5}, "");
+        static_assert(q15{.5}>=q15{.5}, "");
+    }
+
+    TEST(capped_elastic_scaled_integer, repeated_multiply)  // NOLINT
+    {
+        // an elastic_scaled_integer would grow by 31 digits with every multiplication
+        auto product = capped_elastic_scaled_integer<31, -30>{1.0000001};
+        auto expected = 1.0000001;
+        for (auto step = 0; step!=16; ++step) {
+            product = product*capped_elastic_scaled_integer<31, -30>{1.0000001};
+            expected *= 1.0000001;
+        }
+        static_assert(std::is_same<capped_elastic_scaled_integer<31, -29>, decltype(product*product)>::value, "");
+        EXPECT_NEAR(expected, static_cast<double>(product), 1e-8);
+    }
+}
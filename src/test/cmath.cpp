@@ -9,9 +9,18 @@
 
 #include <cnl/_impl/type_traits/identical.h>
 #include <cnl/cmath.h>
+#include <cnl/rounding_integer.h>
+#include <cnl/scaled_integer.h>
+#include <cnl/static_number.h>
+
+#include <gtest/gtest.h>
 
 namespace {
     using cnl::_impl::identical;
+    using cnl::power;
+    using cnl::rounding_integer;
+    using cnl::scaled_integer;
+    using cnl::static_number;
 
     namespace test_abs {
         static_assert(identical(cnl::abs(-302398479), 302398479), "cnl::abs(int)");
@@ -26,4 +35,87 @@ namespace {
         static_assert(identical(cnl::abs(-302398479.), 302398479.), "cnl::abs(double)");
         static_assert(identical(cnl::abs(302398479.F), 302398479.F), "cnl::abs(float)");
     }
+
+    namespace test_fma {
+        using q15 = scaled_integer<cnl::int16, power<-15>>;
+        using s7_8 = scaled_integer<cnl::int16, power<-8>>;
+
+        static_assert(identical(
+                scaled_integer<cnl::int64, power<-30>>{.25+.0078125},
+                cnl::fma(q15{.5}, q15{.5}, s7_8{.0078125})), "cnl::fma(scaled_integer)");
+        static_assert(identical(
+                scaled_integer<cnl::int64, power<-30>>{-127.75-.25},
+                cnl::fma(q15{-.5}, q15{.5}, s7_8{-127.75})), "cnl::fma(scaled_integer)");
+
+        // the low bits of the product survive until the single conversion to the result type:
+        // rounding 2^-16 to q15 and then adding -2^-20 would produce 2^-15
+        using q15_nearest = scaled_integer<rounding_integer<cnl::int16>, power<-15>>;
+        static_assert(identical(
+                q15_nearest{0},
+                static_cast<q15_nearest>(cnl::fma(
+                        q15{.00390625}, q15{.00390625}, scaled_integer<cnl::int32, power<-20>>{-.00000095367431640625}))),
+                "cnl::fma(scaled_integer) with single rounding");
+
+        static_assert(identical(
+                rounding_integer<cnl::int64>{-1000*1000+7},
+                cnl::fma(rounding_integer<cnl::int16>{1000}, rounding_integer<cnl::int16>{-1000},
+                        rounding_integer<cnl::int16>{7})), "cnl::fma(rounding_integer)");
+
+        static_assert(identical(
+                static_number<11, -3>{12.5*-2.25+100.25},
+                cnl::fma(static_number<6, -1>{12.5}, static_number<4, -2>{-2.25}, static_number<9, -2>{100.25})),
+                "cnl::fma(static_number)");
+
+        // wider than the widest fundamental integer when int128 is not available
+        using q31 = scaled_integer<cnl::int32, power<-31>>;
+        using fma_q31 = decltype(cnl::fma(q31{}, q31{}, scaled_integer<cnl::int32>{}));
+        static_assert(cnl::digits<fma_q31>::value>=94, "cnl::fma(scaled_integer)");
+        static_assert(cnl::_impl::exponent<fma_q31>::value==-62, "cnl::fma(scaled_integer)");
+    }
+
+    namespace test_fused_sum_of_products {
+        using q15 = scaled_integer<cnl::int16, power<-15>>;
+
+        static_assert(identical(
+                scaled_integer<cnl::int32, power<-30>>{.25},
+                cnl::fused_sum_of_products(q15{.5}, q15{.5})), "cnl::fused_sum_of_products(scaled_integer)");
+
+        // a sum which a 32-bit accumulator could not hold
+        static_assert(identical(
+                scaled_integer<cnl::int64, power<-30>>{2.},
+                cnl::fused_sum_of_products(q15{-1}, q15{-1}, q15{-1}, q15{-1})),
+                "cnl::fused_sum_of_products(scaled_integer)");
+
+        static_assert(identical(
+                scaled_integer<cnl::int64, power<-30>>{.25-.75+.0625},
+                cnl::fused_sum_of_products(
+                        q15{.5}, q15{.5},
+                        q15{.75}, q15{-1},
+                        scaled_integer<cnl::int8, power<-2>>{.25}, scaled_integer<cnl::int8, power<-2>>{.25})),
+                "cnl::fused_sum_of_products(scaled_integer)");
+
+        static_assert(identical(
+                rounding_integer<cnl::int64>{100*200-300*400+500*600},
+                cnl::fused_sum_of_products(
+                        rounding_integer<cnl::int16>{100}, rounding_integer<cnl::int16>{200},
+                        rounding_integer<cnl::int16>{-300}, rounding_integer<cnl::int16>{400},
+                        rounding_integer<cnl::int16>{500}, rounding_integer<cnl::int16>{600})),
+                "cnl::fused_sum_of_products(rounding_integer)");
+
+        static_assert(identical(
+                static_number<9, -3>{1.5*2.25+-3.5*.25},
+                cnl::fused_sum_of_products(
+                        static_number<4, -1>{1.5}, static_number<4, -2>{2.25},
+                        static_number<4, -1>{-3.5}, static_number<4, -2>{.25})),
+                "cnl::fused_sum_of_products(static_number)");
+    }
+
+    TEST(cmath, fma_wider_than_64_bits)  // NOLINT
+    {
+        using q31 = scaled_integer<cnl::int32, power<-31>>;
+        EXPECT_EQ(
+                scaled_integer<cnl::int64>{CNL_INTMAX_C(2147483648)},
+                static_cast<scaled_integer<cnl::int64>>(
+                        cnl::fma(q31{-1.}, q31{-1.}, scaled_integer<cnl::int32>{2147483647})));
+    }
 }
@@ -0,0 +1,204 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/dynamic_scaled_integer.h>
+
+#include <cnl/_impl/type_traits/identical.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+namespace {
+    using cnl::_impl::identical;
+    using cnl::dynamic_scaled_integer;
+    using cnl::power;
+    using cnl::scaled_integer;
+
+    namespace test_ctor {
+        static_assert(0==dynamic_scaled_integer<>{}.mantissa(), "cnl::dynamic_scaled_integer default ctor");
+        static_assert(0==dynamic_scaled_integer<>{}.exponent(), "cnl::dynamic_scaled_integer default ctor");
+
+        static_assert(
+                48==dynamic_scaled_integer<>(scaled_integer<int, power<-4>>{3.}).mantissa(),
+                "cnl::dynamic_scaled_integer from scaled_integer");
+        static_assert(
+                -4==dynamic_scaled_integer<>(scaled_integer<int, power<-4>>{3.}).exponent(),
+                "cnl::dynamic_scaled_integer from scaled_integer");
+    }
+
+    namespace test_to_scaled_integer {
+        static_assert(
+                identical(
+                        scaled_integer<int, power<-8>>{3.25},
+                        static_cast<scaled_integer<int, power<-8>>>(dynamic_scaled_integer<>{13, -2})),
+                "cnl::dynamic_scaled_integer to scaled_integer with a lower exponent");
+        static_assert(
+                identical(
+                        scaled_integer<std::int64_t, power<-1>>{-3.5},
+                        static_cast<scaled_integer<std::int64_t, power<-1>>>(dynamic_scaled_integer<>{-13, -2})),
+                "cnl::dynamic_scaled_integer to scaled_integer rounds toward negative infinity");
+    }
+
+    namespace test_rescaled {
+        static_assert(
+                52==dynamic_scaled_integer<>{13, -2}.rescaled(-4).mantissa(),
+                "cnl::dynamic_scaled_integer::rescaled");
+        static_assert(
+                3==dynamic_scaled_integer<>{13, -2}.rescaled(0).mantissa(),
+                "cnl::dynamic_scaled_integer::rescaled");
+        static_assert(
+                0U==dynamic_scaled_integer<unsigned>{0x80000000U, 0}.rescaled(41).mantissa(),
+                "cnl::dynamic_scaled_integer::rescaled");
+        static_assert(
+                0U==dynamic_scaled_integer<unsigned>{0x80000000U, 0}.rescaled(-41).mantissa(),
+                "cnl::dynamic_scaled_integer::rescaled");
+    }
+
+    namespace test_arithmetic {
+        // 3.25 + 0.125
+        static_assert(
+                27==(dynamic_scaled_integer<>{13, -2}+dynamic_scaled_integer<>{1, -3}).mantissa(),
+                "cnl::dynamic_scaled_integer addition");
+        static_assert(
+                -3==(dynamic_scaled_integer<>{13, -2}+dynamic_scaled_integer<>{1, -3}).exponent(),
+                "cnl::dynamic_scaled_integer addition");
+
+        static_assert(
+                dynamic_scaled_integer<>{-1, 0}==dynamic_scaled_integer<>{1, 0}-dynamic_scaled_integer<>{2, 0},
+                "cnl::dynamic_scaled_integer subtraction");
+
+        static_assert(
+                identical(
+                        dynamic_scaled_integer<std::int64_t>{-39, -1},
+                        dynamic_scaled_integer<std::int64_t>{-13, -2}*dynamic_scaled_integer<std::int64_t>{3, 1}),
+                "cnl::dynamic_scaled_integer multiplication");
+
+        static_assert(
+                identical(
+                        dynamic_scaled_integer<std::int64_t>{4, -4},
+                        dynamic_scaled_integer<std::int64_t>{13, -2}/dynamic_scaled_integer<std::int64_t>{3, 2}),
+                "cnl::dynamic_scaled_integer division");
+
+        static_assert(
+                dynamic_scaled_integer<>{-13, -2}==-dynamic_scaled_integer<>{13, -2},
+                "cnl::dynamic_scaled_integer negation");
+    }
+
+    namespace test_shift {
+        static_assert(
+                dynamic_scaled_integer<>{13, 3}.exponent()==(dynamic_scaled_integer<>{13, -2} << 5).exponent(),
+                "cnl::dynamic_scaled_integer left shift");
+        static_assert(
+                dynamic_scaled_integer<>{13, -40}.exponent()==(dynamic_scaled_integer<>{13, -2} >> 38).exponent(),
+                "cnl::dynamic_scaled_integer right shift does not lose precision");
+    }
+
+    namespace test_comparison {
+        static_assert(dynamic_scaled_integer<>{1, 0}==dynamic_scaled_integer<>{4, -2}, "cnl::dynamic_scaled_integer ==");
+        static_assert(dynamic_scaled_integer<>{1, 0}!=dynamic_scaled_integer<>{5, -2}, "cnl::dynamic_scaled_integer !=");
+        static_assert(dynamic_scaled_integer<>{1, 0}<dynamic_scaled_integer<>{5, -2}, "cnl::dynamic_scaled_integer <");
+        static_assert(dynamic_scaled_integer<>{-1, 3}<dynamic_scaled_integer<>{-5, 0}, "cnl::dynamic_scaled_integer <");
+        static_assert(dynamic_scaled_integer<>{3, 1}>=dynamic_scaled_integer<>{6, 0}, "cnl::dynamic_scaled_integer >=");
+    }
+
+    namespace test_large_exponent_gap {
+        using d = dynamic_scaled_integer<>;
+        constexpr auto int_min = cnl::numeric_limits<int>::lowest();
+
+        // values whose mantissas cannot be aligned within int
+        static_assert(d{1, 0}<d{1, 31}, "cnl::dynamic_scaled_integer < with exponent gap of 31");
+        static_assert(d{1, 0}<d{1, 32}, "cnl::dynamic_scaled_integer < with exponent gap of 32");
+        static_assert(d{1, 0}<d{1, 40}, "cnl::dynamic_scaled_integer < with exponent gap of 40");
+        static_assert(d{1, 1000}>d{1, 0}, "cnl::dynamic_scaled_integer > with exponent gap of 1000");
+        static_assert(d{-1, 40}<d{1, 0}, "cnl::dynamic_scaled_integer < of opposite signs");
+        static_assert(d{-1, 40}<d{-1, 0}, "cnl::dynamic_scaled_integer < of negative values");
+        static_assert(d{1, 0}!=d{1, 32}, "cnl::dynamic_scaled_integer != with exponent gap of 32");
+        static_assert(d{0, 40}==d{0, 0}, "cnl::dynamic_scaled_integer == of zeros");
+        static_assert(d{0, 40}<d{1, 0}, "cnl::dynamic_scaled_integer < of zero");
+
+        // values whose mantissas can be aligned only just
+        static_assert(d{1, 31}==d{2, 30}, "cnl::dynamic_scaled_integer == with exponent gap of 1");
+        static_assert(d{-1, 31}==d{int_min, 0}, "cnl::dynamic_scaled_integer == with exponent gap of 31");
+        static_assert(d{-1, 32}<d{int_min, 0}, "cnl::dynamic_scaled_integer < with exponent gap of 32");
+        static_assert(d{1 << 30, 0}<d{1, 31}, "cnl::dynamic_scaled_integer < with exponent gap of 31");
+
+        // the smaller operand is lost rather than the larger being wrapped
+        static_assert(d{1, 40}==d{1, 0}+d{1, 40}, "cnl::dynamic_scaled_integer + with exponent gap of 40");
+        static_assert(d{1, 40}==d{1, 40}+d{1, 0}, "cnl::dynamic_scaled_integer + with exponent gap of 40");
+        static_assert(d{1, 31}==d{1, 0}+d{1, 31}, "cnl::dynamic_scaled_integer + with exponent gap of 31");
+        static_assert(d{1, 32}==d{1, 32}+d{1, 0}, "cnl::dynamic_scaled_integer + with exponent gap of 32");
+        static_assert(d{-1, 40}==d{-1, 40}-d{1, 0}, "cnl::dynamic_scaled_integer - with exponent gap of 40");
+        static_assert(d{1, 1000}==d{1, 1000}-d{1, 0}, "cnl::dynamic_scaled_integer - with exponent gap of 1000");
+
+        // as many digits of the smaller operand as fit are kept, leaving one for the carry
+        static_assert(
+                identical(d{(1 << 29)+1, 0}, d{1, 0}+d{1, 29}), "cnl::dynamic_scaled_integer + with exponent gap of 29");
+        static_assert(
+                identical(d{(1 << 29)+1, 1}, d{3, 0}+d{1, 30}), "cnl::dynamic_scaled_integer + with exponent gap of 30");
+        static_assert(identical(d{int_min, 1}, d{int_min, 0}+d{int_min, 0}), "cnl::dynamic_scaled_integer + of lowest");
+        static_assert(identical(d{1 << 30, 1}, d{0, 0}-d{int_min, 0}), "cnl::dynamic_scaled_integer - of lowest");
+
+        static_assert(
+                dynamic_scaled_integer<std::int64_t>{1, 0}<dynamic_scaled_integer<std::int64_t>{1, 64},
+                "cnl::dynamic_scaled_integer < with exponent gap of 64");
+        static_assert(
+                dynamic_scaled_integer<std::int64_t>{1, 64}
+                        ==dynamic_scaled_integer<std::int64_t>{1, 0}+dynamic_scaled_integer<std::int64_t>{1, 64},
+                "cnl::dynamic_scaled_integer + with exponent gap of 64");
+
+        // a zero operand does not limit the alignment of the other
+        static_assert(identical(d{5, 0}, d{0, 40}+d{5, 0}), "cnl::dynamic_scaled_integer + of zero");
+    }
+
+    TEST(dynamic_scaled_integer, to_floating_point)  // NOLINT
+    {
+        EXPECT_EQ(3.25, static_cast<double>(dynamic_scaled_integer<>{13, -2}));
+        EXPECT_EQ(-1664.f, static_cast<float>(dynamic_scaled_integer<>{-13, 7}));
+    }
+
+    struct exponent_of {
+        template<typename Rep, int Exponent>
+        int operator()(scaled_integer<Rep, power<Exponent>> const&) const
+        {
+            return Exponent;
+        }
+    };
+
+    struct doubled {
+        template<typename Rep, int Exponent>
+        double operator()(scaled_integer<Rep, power<Exponent>> const& value) const
+        {
+            return static_cast<double>(value*2);
+        }
+    };
+
+    TEST(dynamic_scaled_integer, visit)  // NOLINT
+    {
+        for (auto exponent = -8; exponent<=8; ++exponent) {
+            EXPECT_EQ(exponent, (cnl::visit<-8, 8>(exponent_of{}, dynamic_scaled_integer<>{1, exponent})));
+        }
+    }
+
+    TEST(dynamic_scaled_integer, visit_value)  // NOLINT
+    {
+        auto const to_double = [](scaled_integer<int, power<-4>> const& value) {
+            return static_cast<double>(value);
+        };
+        EXPECT_EQ(3.25, (cnl::visit<-4, -4>(to_double, dynamic_scaled_integer<>{13, -2})));
+
+        EXPECT_EQ(-52., (cnl::visit<-2, 2>(doubled{}, dynamic_scaled_integer<>{-13, 1})));
+    }
+
+    TEST(dynamic_scaled_integer, visit_out_of_range)  // NOLINT
+    {
+        // lower exponents are rounded toward negative infinity; higher exponents are shifted left
+        EXPECT_EQ(-8, (cnl::visit<-8, 8>(exponent_of{}, dynamic_scaled_integer<>{1, -20})));
+        EXPECT_EQ(8, (cnl::visit<-8, 8>(exponent_of{}, dynamic_scaled_integer<>{1, 20})));
+        EXPECT_EQ(3., (cnl::visit<-1, -1>(doubled{}, dynamic_scaled_integer<>{13, -2}))/2);
+        EXPECT_EQ(-48., (cnl::visit<2, 2>(doubled{}, dynamic_scaled_integer<>{-3, 4}))/2);
+    }
+}
@@ -0,0 +1,148 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/elastic_expression.h>
+
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/elastic_scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+namespace {
+    using cnl::_impl::identical;
+    using cnl::elastic_integer;
+    using cnl::elastic_scaled_integer;
+    using cnl::evaluate;
+    using cnl::make_elastic_expression;
+
+    namespace test_leaf {
+        static_assert(identical(
+                elastic_integer<12>{-1234},
+                evaluate(make_elastic_expression(elastic_integer<12>{-1234}))), "");
+        static_assert(identical(
+                elastic_scaled_integer<12, -4>{-12.3125},
+                evaluate(make_elastic_expression(elastic_scaled_integer<12, -4>{-12.3125}))), "");
+    }
+
+    namespace test_negate {
+        static_assert(identical(
+                -elastic_integer<12, unsigned>{1234},
+                evaluate(-make_elastic_expression(elastic_integer<12, unsigned>{1234}))), "");
+    }
+
+    namespace test_add {
+        constexpr auto a = elastic_scaled_integer<12, -4>{-12.3125};
+        constexpr auto b = elastic_scaled_integer<6, 2>{100};
+        static_assert(identical(a+b, evaluate(make_elastic_expression(a)+b)), "");
+        static_assert(identical(b+a, evaluate(b+make_elastic_expression(a))), "");
+        static_assert(identical(a+a, evaluate(make_elastic_expression(a)+make_elastic_expression(a))), "");
+    }
+
+    namespace test_subtract {
+        constexpr auto a = elastic_integer<8, unsigned>{3};
+        constexpr auto b = elastic_integer<8, unsigned>{255};
+        static_assert(identical(a-b, evaluate(make_elastic_expression(a)-b)), "");
+    }
+
+    namespace test_multiply {
+        constexpr auto a = elastic_scaled_integer<12, -4>{-12.3125};
+        constexpr auto b = elastic_scaled_integer<6, 2>{-100};
+        static_assert(identical(a*b, evaluate(make_elastic_expression(a)*b)), "");
+    }
+
+    namespace test_expression {
+        // each operator of a*b+c*d-e produces a temporary of a different type;
+        // the expression produces the same result from a single type
+        constexpr auto a = elastic_scaled_integer<15, -15>{-.75};
+        constexpr auto b = elastic_scaled_integer<15, -15>{.5};
+        constexpr auto c = elastic_scaled_integer<31, -16>{-30000.25};
+        constexpr auto d = elastic_scaled_integer<7, -7>{-.5};
+        constexpr auto e = elastic_scaled_integer<20, -4>{65535.5};
+
+        using expression = decltype(make_elastic_expression(a)*b+make_elastic_expression(c)*d-e);
+        static_assert(std::is_same<
+                elastic_scaled_integer<47, -30>,
+                cnl::_impl::elastic_expression_result_t<expression>>::value, "");
+        static_assert(std::is_same<
+                cnl::int64,
+                cnl::_impl::elastic_expression_rep_t<expression>>::value, "");
+
+        static_assert(identical(
+                a*b+c*d-e,
+                evaluate(make_elastic_expression(a)*b+make_elastic_expression(c)*d-e)), "");
+    }
+
+    namespace test_exact_range {
+        // the temporaries of a*b+c*d-e reach 64 digits but the exact range of the expression needs only 63
+        constexpr auto a = elastic_integer<31>{2147483647};
+        constexpr auto b = elastic_integer<31>{2147483647};
+        constexpr auto c = elastic_integer<31>{-2147483647};
+        constexpr auto d = elastic_integer<31>{-2147483647};
+        constexpr auto e = elastic_integer<31>{-2147483647};
+
+        using expression = decltype(make_elastic_expression(a)*b+make_elastic_expression(c)*d-e);
+#if defined(CNL_INT128_ENABLED)
+        static_assert(std::is_same<elastic_integer<64>, decltype(a*b+c*d-e)>::value, "");
+#endif
+        static_assert(std::is_same<
+                elastic_integer<63>,
+                cnl::_impl::elastic_expression_result_t<expression>>::value, "");
+        static_assert(std::is_same<
+                cnl::int64,
+                cnl::_impl::elastic_expression_rep_t<expression>>::value, "");
+
+        static_assert(identical(
+                elastic_integer<63>{CNL_INTMAX_C(2147483647)*2147483647*2+2147483647},
+                evaluate(make_elastic_expression(a)*b+make_elastic_expression(c)*d-e)), "");
+
+        // a product of two non-positive ranges is non-negative
+        constexpr auto f = elastic_integer<8, unsigned>{200};
+        static_assert(identical(
+                elastic_integer<16, unsigned>{40000},
+                evaluate(-make_elastic_expression(f)*-make_elastic_expression(f))), "");
+
+        // an operand of one digit does not widen a product
+        static_assert(identical(
+                elastic_integer<31>{-2147483647},
+                evaluate(make_elastic_expression(elastic_integer<1>{-1})*b)), "");
+    }
+
+    namespace test_inexact_range {
+        // ranges which exceed intmax take the digits of the elastic_tag policy
+        constexpr auto digits = cnl::numeric_limits<cnl::intmax>::digits/2+1;
+        using expression = decltype(
+                make_elastic_expression(elastic_integer<digits>{})*elastic_integer<digits>{}-elastic_integer<digits>{});
+        static_assert(!cnl::_impl::elastic_range<expression>::exact, "");
+        static_assert(cnl::_impl::elastic_range<expression>::digits==digits*2+1, "");
+    }
+
+    TEST(elastic_expression, sum_of_products)  // NOLINT
+    {
+        using q15 = elastic_scaled_integer<15, -15>;
+        for (auto index = -20; index!=20; ++index) {
+            auto const a = q15{index/20.};
+            auto const b = q15{(20-index)/41.};
+            auto const c = elastic_scaled_integer<20, -4>{index*1000.5};
+            auto const expected = a*b-b*a*a+c;
+            auto const actual = evaluate(make_elastic_expression(a)*b-make_elastic_expression(b)*a*a+c);
+            static_assert(std::is_same<decltype(expected), decltype(actual)>::value, "");
+            EXPECT_EQ(expected, actual) << "index=" << index;
+        }
+    }
+
+    TEST(elastic_expression, extreme_sum_of_products)  // NOLINT
+    {
+        auto const max = elastic_integer<31>{2147483647};
+        for (auto sign = -1; sign!=3; sign += 2) {
+            auto const a = max*elastic_integer<1>{sign};
+            auto const expected = cnl::int64{2147483647}*2147483647*2-sign*2147483647;
+            auto const actual = evaluate(make_elastic_expression(a)*a+make_elastic_expression(max)*max-a);
+            EXPECT_EQ(expected, static_cast<cnl::int64>(actual)) << "sign=" << sign;
+        }
+    }
+}
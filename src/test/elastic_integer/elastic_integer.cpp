@@ -664,6 +664,39 @@ namespace {
                 "power_value test failed");
     }
 
+    namespace test_fast_rep {
+        using cnl::fast_rep_t;
+        using cnl::storage_rep_t;
+
+        static_assert(identical(int{}, fast_rep_t<>{}), "cnl::fast_rep test failed");
+        static_assert(identical(int{}, fast_rep_t<cnl::int8>{}), "cnl::fast_rep test failed");
+        static_assert(identical(unsigned{}, fast_rep_t<cnl::uint16>{}), "cnl::fast_rep test failed");
+        static_assert(identical(cnl::int64{}, fast_rep_t<cnl::int64>{}), "cnl::fast_rep test failed");
+
+        static_assert(identical(cnl::int8{}, storage_rep_t<>{}), "cnl::storage_rep test failed");
+        static_assert(identical(cnl::uint8{}, storage_rep_t<cnl::uint64>{}), "cnl::storage_rep test failed");
+
+        // intermediate results are held in registers no narrower than int
+        static_assert(
+                identical(
+                        elastic_integer<14, int>{-10000},
+                        elastic_integer<7, fast_rep_t<cnl::int8>>{100}*elastic_integer<7, fast_rep_t<cnl::int8>>{-100}),
+                "cnl::fast_rep test failed");
+
+        // values are stored in the fewest bytes
+        static_assert(sizeof(elastic_integer<7, storage_rep_t<>>)==1, "cnl::storage_rep test failed");
+        static_assert(sizeof(elastic_integer<12, storage_rep_t<unsigned>>)==2, "cnl::storage_rep test failed");
+
+        static_assert(
+                identical(elastic_integer<7, int>{-100}, cnl::to_fast_rep(elastic_integer<7, cnl::int8>{-100})),
+                "cnl::to_fast_rep test failed");
+        static_assert(
+                identical(
+                        elastic_integer<12, cnl::uint8>{4000},
+                        cnl::to_storage_rep(elastic_integer<12, unsigned>{4000})),
+                "cnl::to_storage_rep test failed");
+    }
+
     TEST(elastic_integer, to_rep_ref)  // NOLINT
     {
         auto i = 123;
@@ -0,0 +1,131 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/fft.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+
+namespace {
+    using cnl::fixed_array;
+    using cnl::power;
+    using cnl::scaled_integer;
+
+    using q15 = scaled_integer<std::int16_t, power<-15>>;
+    using q31 = scaled_integer<std::int32_t, power<-31>>;
+
+    namespace test_twiddles {
+        using twiddles = cnl::_impl::fft_twiddles<q15, 8>;
+        static_assert(twiddles::cosine[0]==cnl::numeric_limits<q15>::max(), "cos(0) saturates");
+        static_assert(twiddles::cosine[1]==cnl::_impl::from_rep<q15>(std::int16_t{23170}), "cos(pi/4)");
+        static_assert(twiddles::cosine[2]==q15{0}, "cos(pi/2)");
+        static_assert(twiddles::sine[0]==q15{0}, "sin(0)");
+        static_assert(twiddles::sine[2]==cnl::numeric_limits<q15>::max(), "sin(pi/2) saturates");
+        static_assert(twiddles::cosine[3]==cnl::_impl::from_rep<q15>(std::int16_t{-23170}), "cos(3*pi/4)");
+    }
+
+    namespace test_fold {
+        static_assert(5==cnl::_impl::fft_fold(5), "cnl::_impl::fft_fold");
+        static_assert(5==cnl::_impl::fft_fold(-6), "cnl::_impl::fft_fold");
+        static_assert(0x7fffffff==cnl::_impl::fft_fold(std::int32_t{-0x7fffffff-1}), "cnl::_impl::fft_fold");
+        static_assert(0x80000000U==cnl::_impl::fft_fold(0x80000000U), "cnl::_impl::fft_fold");
+    }
+
+    // compares the block-floating-point transform of the given signal with a direct evaluation;
+    // tolerance is in units of the least significant digit of the output
+    template<typename Rep, int Exponent, std::size_t N>
+    void test_against_dft(
+            fixed_array<scaled_integer<Rep, power<Exponent>>, N> const& real,
+            fixed_array<scaled_integer<Rep, power<Exponent>>, N> const& imag,
+            double tolerance_lsbs)
+    {
+        auto actual_real = real;
+        auto actual_imag = imag;
+        auto const block_exponent = cnl::fft(actual_real, actual_imag);
+        auto const scale = std::ldexp(1., block_exponent);
+        auto const tolerance = std::ldexp(tolerance_lsbs, block_exponent+Exponent);
+
+        for (std::size_t bin = 0; bin!=N; ++bin) {
+            auto expected_real = 0.;
+            auto expected_imag = 0.;
+            for (std::size_t index = 0; index!=N; ++index) {
+                auto const angle = -2.*3.14159265358979323846*static_cast<double>((bin*index)%N)/N;
+                auto const x_real = static_cast<double>(real[index]);
+                auto const x_imag = static_cast<double>(imag[index]);
+                expected_real += x_real*std::cos(angle)-x_imag*std::sin(angle);
+                expected_imag += x_real*std::sin(angle)+x_imag*std::cos(angle);
+            }
+            EXPECT_NEAR(expected_real, static_cast<double>(actual_real[bin])*scale, tolerance) << "bin=" << bin;
+            EXPECT_NEAR(expected_imag, static_cast<double>(actual_imag[bin])*scale, tolerance) << "bin=" << bin;
+        }
+    }
+
+    TEST(fft, impulse)  // NOLINT
+    {
+        auto real = fixed_array<q15, 16>{};
+        auto imag = fixed_array<q15, 16>{};
+        real[0] = .5;
+
+        auto const block_exponent = cnl::fft(real, imag);
+        for (std::size_t bin = 0; bin!=16; ++bin) {
+            EXPECT_NEAR(.5, std::ldexp(static_cast<double>(real[bin]), block_exponent), .0002) << "bin=" << bin;
+            EXPECT_NEAR(0., std::ldexp(static_cast<double>(imag[bin]), block_exponent), .0002) << "bin=" << bin;
+        }
+    }
+
+    TEST(fft, no_shift_when_not_needed)  // NOLINT
+    {
+        auto real = fixed_array<q15, 8>{};
+        auto imag = fixed_array<q15, 8>{};
+        for (auto& sample : real) {
+            sample = 1./1024;
+        }
+
+        EXPECT_EQ(0, cnl::fft(real, imag));
+        EXPECT_EQ(q15{8./1024}, real[0]);
+        EXPECT_EQ(q15{0}, real[1]);
+    }
+
+    TEST(fft, shift_when_needed)  // NOLINT
+    {
+        auto real = fixed_array<q15, 8>{};
+        auto imag = fixed_array<q15, 8>{};
+        for (auto& sample : real) {
+            sample = .75;
+        }
+
+        // the DC bin grows to 6 so at least three bits of shift are needed
+        auto const block_exponent = cnl::fft(real, imag);
+        EXPECT_LE(3, block_exponent);
+        EXPECT_NEAR(6., std::ldexp(static_cast<double>(real[0]), block_exponent), .01);
+    }
+
+    TEST(fft, q15_256)  // NOLINT
+    {
+        auto real = fixed_array<q15, 256>{};
+        auto imag = fixed_array<q15, 256>{};
+        for (std::size_t index = 0; index!=256; ++index) {
+            real[index] = .5*std::sin(static_cast<double>(index)*.37)+.25*std::cos(static_cast<double>(index)*1.9);
+            imag[index] = .125*std::sin(static_cast<double>(index)*2.3);
+        }
+
+        test_against_dft(real, imag, 8.);
+    }
+
+    TEST(fft, q31_1024)  // NOLINT
+    {
+        auto real = fixed_array<q31, 1024>{};
+        auto imag = fixed_array<q31, 1024>{};
+        for (std::size_t index = 0; index!=1024; ++index) {
+            real[index] = .9*std::sin(static_cast<double>(index*index)*.001);
+            imag[index] = -.9*std::cos(static_cast<double>(index)*.7);
+        }
+
+        test_against_dft(real, imag, 8.);
+    }
+}
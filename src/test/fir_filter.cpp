@@ -0,0 +1,166 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/fir_filter.h>
+
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace {
+    using cnl::fixed_array;
+    using cnl::fixed_vector;
+    using cnl::power;
+    using cnl::scaled_integer;
+
+    using q15 = scaled_integer<std::int16_t, power<-15>>;
+
+    namespace test_accumulator_type {
+        static_assert(std::is_same<
+                scaled_integer<std::int32_t, power<-30>>,
+                cnl::fir_filter<q15, q15, 2>::accumulator_type>::value, "");
+        static_assert(std::is_same<
+                scaled_integer<std::int64_t, power<-30>>,
+                cnl::fir_filter<q15, q15, 256>::accumulator_type>::value, "");
+
+        // wider than the widest fundamental integer when int128 is not available
+        static_assert(cnl::digits<cnl::fir_filter<std::int32_t, std::int32_t, 4>::accumulator_type>::value>=64, "");
+    }
+
+    TEST(fir_filter, impulse_response)  // NOLINT
+    {
+        auto const coefficients = fixed_array<q15, 3>{{.5, -.25, .125}};
+        auto filter = cnl::fir_filter<q15, q15, 3>(coefficients);
+
+        EXPECT_EQ(q15{.5}, filter(q15{.999969482421875}));
+        EXPECT_EQ(q15{-.25}, filter(q15{0}));
+        EXPECT_EQ(q15{.125}, filter(q15{0}));
+        EXPECT_EQ(q15{0}, filter(q15{0}));
+    }
+
+    TEST(fir_filter, moving_average)  // NOLINT
+    {
+        auto filter = cnl::fir_filter<q15, q15, 4>(fixed_array<q15, 4>{{.25, .25, .25, .25}});
+        auto const block = fixed_vector<q15>(8, q15{.5});
+
+        auto const output = filter.process(block);
+        ASSERT_EQ(8U, output.size());
+        EXPECT_EQ(q15{.125}, output[0]);
+        EXPECT_EQ(q15{.375}, output[2]);
+        EXPECT_EQ(q15{.5}, output[3]);
+        EXPECT_EQ(q15{.5}, output[7]);
+    }
+
+    TEST(fir_filter, rounded_once)  // NOLINT
+    {
+        // each product is a fraction of the least significant digit of q15
+        auto filter = cnl::fir_filter<q15, q15, 4>(fixed_array<q15, 4>{{.25, .25, .25, .25}});
+        auto const lsb = cnl::_impl::from_rep<q15>(std::int16_t{1});
+
+        EXPECT_EQ(q15{0}, filter(lsb));
+        EXPECT_EQ(q15{lsb}, filter(lsb));
+        EXPECT_EQ(q15{lsb}, filter(lsb));
+        EXPECT_EQ(q15{lsb}, filter(lsb));
+    }
+
+    TEST(fir_filter, no_overflow)  // NOLINT
+    {
+        auto coefficients = fixed_array<q15, 64>{};
+        for (auto& coefficient : coefficients) {
+            coefficient = cnl::numeric_limits<q15>::max();
+        }
+        auto filter = cnl::fir_filter<q15, q15, 64>(coefficients);
+        for (auto sample = 0; sample!=64; ++sample) {
+            (void) filter(cnl::numeric_limits<q15>::lowest());
+        }
+
+        auto const expected = -64.*(32767./32768.);
+        EXPECT_EQ(expected, static_cast<double>(filter.accumulate()));
+    }
+
+    TEST(fir_filter, streaming)  // NOLINT
+    {
+        auto const coefficients = fixed_array<q15, 5>{{.0625, .25, .375, .25, .0625}};
+        auto const input = fixed_vector<q15>{.5, -.5, .25, .75, -.125, 0., .875, -1., .5, .5, .25};
+
+        auto whole = cnl::fir_filter<q15, q15, 5>(coefficients);
+        auto const expected = whole.process(input);
+
+        auto blocks = cnl::fir_filter<q15, q15, 5>(coefficients);
+        auto actual = fixed_vector<q15>(input.size());
+        blocks.process(input.data(), actual.data(), 3);
+        blocks.process(input.data()+3, actual.data()+3, input.size()-3);
+
+        for (std::size_t index = 0; index!=input.size(); ++index) {
+            EXPECT_EQ(expected[index], actual[index]) << "index=" << index;
+        }
+
+        blocks.reset();
+        EXPECT_EQ(expected[0], blocks(input[0]));
+    }
+
+    TEST(convolve, one_dimensional)  // NOLINT
+    {
+        auto const actual = cnl::convolve(fixed_array<int, 3>{{1, 2, 3}}, fixed_array<int, 2>{{1, -1}});
+        static_assert(std::is_same<fixed_array<std::int64_t, 4>, std::remove_const<decltype(actual)>::type>::value, "");
+        EXPECT_EQ(1, actual[0]);
+        EXPECT_EQ(1, actual[1]);
+        EXPECT_EQ(1, actual[2]);
+        EXPECT_EQ(-3, actual[3]);
+    }
+
+    TEST(convolve, fixed_vector)  // NOLINT
+    {
+        auto const lhs = fixed_vector<q15>{.5, .5, -.5};
+        auto const rhs = fixed_vector<q15>{.25, .999969482421875};
+
+        auto const actual = cnl::convolve(lhs, rhs);
+        static_assert(std::is_same<
+                fixed_vector<scaled_integer<std::int64_t, power<-30>>>,
+                std::remove_const<decltype(actual)>::type>::value, "");
+        ASSERT_EQ(4U, actual.size());
+        EXPECT_EQ(.125, static_cast<double>(actual[0]));
+        EXPECT_EQ(.5*.999969482421875+.125, static_cast<double>(actual[1]));
+        EXPECT_EQ(.5*.999969482421875-.125, static_cast<double>(actual[2]));
+        EXPECT_EQ(-.5*.999969482421875, static_cast<double>(actual[3]));
+
+        EXPECT_TRUE(cnl::convolve(lhs, fixed_vector<q15>{}).empty());
+    }
+
+    TEST(convolve, two_dimensional)  // NOLINT
+    {
+        using matrix = fixed_array<fixed_array<int, 2>, 2>;
+        auto const lhs = matrix{{{{1, 2}}, {{3, 4}}}};
+        auto const rhs = matrix{{{{1, 0}}, {{0, -1}}}};
+
+        auto const actual = cnl::convolve(lhs, rhs);
+        EXPECT_EQ(1, actual[0][0]);
+        EXPECT_EQ(2, actual[0][1]);
+        EXPECT_EQ(0, actual[0][2]);
+        EXPECT_EQ(3, actual[1][0]);
+        EXPECT_EQ(3, actual[1][1]);
+        EXPECT_EQ(-2, actual[1][2]);
+        EXPECT_EQ(0, actual[2][0]);
+        EXPECT_EQ(-3, actual[2][1]);
+        EXPECT_EQ(-4, actual[2][2]);
+    }
+
+    TEST(convolve, wider_than_64_bits)  // NOLINT
+    {
+        using matrix = fixed_array<fixed_array<int, 2>, 2>;
+        auto const lowest = std::numeric_limits<int>::lowest();
+        auto const extremes = matrix{{{{lowest, lowest}}, {{lowest, lowest}}}};
+
+        auto const actual = cnl::convolve(extremes, extremes);
+        static_assert(cnl::digits<std::decay<decltype(actual[1][1])>::type>::value>=64, "");
+        EXPECT_EQ(18446744073709551616., static_cast<double>(actual[1][1]));
+        EXPECT_EQ(4611686018427387904., static_cast<double>(actual[0][0]));
+    }
+}
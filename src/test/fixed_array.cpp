@@ -0,0 +1,223 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/fixed_array.h>
+
+#include <cnl/elastic_integer.h>
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace {
+    using cnl::fixed_array;
+    using cnl::fixed_vector;
+    using cnl::power;
+    using cnl::scaled_integer;
+
+    template<class Expected, class Actual>
+    void expect_identical(Expected const& expected, Actual const& actual)
+    {
+        static_assert(std::is_same<Expected, Actual>::value, "expected and actual types are not the same");
+        ASSERT_EQ(expected.size(), actual.size());
+        for (std::size_t index = 0; index!=expected.size(); ++index) {
+            EXPECT_EQ(expected[index], actual[index]) << "index=" << index;
+        }
+    }
+
+    namespace test_alignment {
+        static_assert(alignof(fixed_array<std::int8_t, 3>)==1, "");
+        static_assert(sizeof(fixed_array<std::int8_t, 3>)==3, "");
+        static_assert(alignof(fixed_array<std::int16_t, 6>)==4, "");
+        static_assert(sizeof(fixed_array<std::int16_t, 6>)==12, "");
+        static_assert(alignof(fixed_array<std::int16_t, 32>)==cnl::_impl::fixed_array_alignment, "");
+        static_assert(alignof(fixed_array<std::int32_t, 1024>)==cnl::_impl::fixed_array_alignment, "");
+        static_assert(fixed_array<std::int8_t, 3>::size()==3, "");
+    }
+
+    namespace test_operator_constraints {
+        struct no_arithmetic {
+        };
+
+        template<class Lhs, class Rhs, class = void>
+        struct can_add : std::false_type {
+        };
+
+        template<class Lhs, class Rhs>
+        struct can_add<Lhs, Rhs, decltype(void(std::declval<Lhs>()+std::declval<Rhs>()))> : std::true_type {
+        };
+
+        static_assert(can_add<fixed_array<int, 2>, fixed_array<int, 2>>::value, "");
+        static_assert(can_add<fixed_array<int, 2>, int>::value, "");
+        static_assert(!can_add<fixed_array<no_arithmetic, 2>, fixed_array<no_arithmetic, 2>>::value, "");
+        static_assert(!can_add<fixed_array<int, 2>, no_arithmetic>::value, "");
+        static_assert(!can_add<fixed_array<int, 2>, fixed_array<int, 3>>::value, "");
+    }
+
+#if defined(CNL_EXCEPTIONS_ENABLED)
+    TEST(fixed_array, aligned_allocation_too_large)  // NOLINT
+    {
+        auto const allocator = cnl::_impl::aligned_allocator<std::int32_t, cnl::_impl::fixed_array_alignment>{};
+        EXPECT_THROW(
+                (void) allocator.allocate(std::numeric_limits<std::size_t>::max()/sizeof(std::int32_t)),
+                std::bad_array_new_length);
+    }
+
+    TEST(fixed_array, size_mismatch)  // NOLINT
+    {
+        auto const lhs = fixed_vector<int>(3, 1);
+        auto const rhs = fixed_vector<int>(4, 1);
+        EXPECT_THROW((void) (lhs+rhs), std::length_error);
+        EXPECT_THROW((void) cnl::dot(lhs, rhs), std::length_error);
+
+        auto out = fixed_vector<int>(2, 1);
+        EXPECT_THROW(out += rhs, std::length_error);
+    }
+#endif
+
+    TEST(fixed_array, aligned_allocation)  // NOLINT
+    {
+        for (auto size = 1U; size!=100U; size += 11) {
+            auto const v = fixed_vector<std::int16_t>(size, std::int16_t{7});
+            EXPECT_EQ(0U, reinterpret_cast<std::uintptr_t>(v.data()) % cnl::_impl::fixed_array_alignment);
+            EXPECT_EQ(size, v.size());
+            EXPECT_EQ(7, v[size-1]);
+        }
+    }
+
+    TEST(fixed_array, add_fundamental)  // NOLINT
+    {
+        auto const lhs = fixed_array<int, 4>{{1, 2, 3, 4}};
+        auto const rhs = fixed_array<int, 4>{{10, 20, 30, 40}};
+        expect_identical(fixed_array<int, 4>{{11, 22, 33, 44}}, lhs+rhs);
+    }
+
+    TEST(fixed_array, mixed_exponent_add)  // NOLINT
+    {
+        using lhs_type = scaled_integer<int, power<-8>>;
+        using rhs_type = scaled_integer<int, power<-4>>;
+        auto const lhs = fixed_array<lhs_type, 3>{{.5, 1.25, -2.}};
+        auto const rhs = fixed_array<rhs_type, 3>{{.25, 3., 1.5}};
+
+        auto const expected = fixed_array<scaled_integer<int, power<-8>>, 3>{{.75, 4.25, -.5}};
+        expect_identical(expected, lhs+rhs);
+    }
+
+    TEST(fixed_array, mixed_exponent_multiply)  // NOLINT
+    {
+        using lhs_type = scaled_integer<std::int16_t, power<-8>>;
+        using rhs_type = scaled_integer<std::int16_t, power<-4>>;
+        auto const lhs = fixed_vector<lhs_type>{.5, 1.25, -2.};
+        auto const rhs = fixed_vector<rhs_type>{.25, 3., 1.5};
+
+        auto const expected = fixed_vector<scaled_integer<int, power<-12>>>{.125, 3.75, -3.};
+        expect_identical(expected, lhs*rhs);
+    }
+
+    TEST(fixed_array, divide)  // NOLINT
+    {
+        auto const lhs = fixed_vector<scaled_integer<int, power<-16>>>{1., 3., -4.5};
+        auto const rhs = fixed_vector<scaled_integer<int, power<-8>>>{2., .5, 1.5};
+
+        auto const expected = fixed_vector<scaled_integer<int, power<-8>>>{.5, 6., -3.};
+        expect_identical(expected, lhs/rhs);
+    }
+
+    TEST(fixed_array, scalar)  // NOLINT
+    {
+        using element_type = scaled_integer<int, power<-8>>;
+        auto const v = fixed_vector<element_type>{1.5, -.25};
+        expect_identical(fixed_vector<element_type>{3., -.5}, v*2);
+        expect_identical(fixed_vector<element_type>{-.5, -2.25}, element_type{-2}+v);
+    }
+
+    TEST(fixed_array, shift)  // NOLINT
+    {
+        auto const v = fixed_array<std::int32_t, 2>{{3, -12}};
+        expect_identical(fixed_array<std::int32_t, 2>{{24, -96}}, v << 3);
+        expect_identical(fixed_array<std::int32_t, 2>{{0, -3}}, v >> 2);
+
+        using element_type = scaled_integer<int, power<-8>>;
+        auto const s = fixed_vector<element_type>{1.5, -.25};
+        auto const shifted = s << cnl::constant<2>{};
+        EXPECT_EQ(6., static_cast<double>(shifted[0]));
+        EXPECT_EQ(-1., static_cast<double>(shifted[1]));
+    }
+
+    TEST(fixed_array, negate)  // NOLINT
+    {
+        auto const v = fixed_vector<scaled_integer<int, power<-8>>>{1.5, -.25};
+        expect_identical(fixed_vector<scaled_integer<int, power<-8>>>{-1.5, .25}, -v);
+    }
+
+    TEST(fixed_array, compound_assignment)  // NOLINT
+    {
+        using element_type = scaled_integer<int, power<-8>>;
+        auto v = fixed_vector<element_type>{1.5, -.25, 8.};
+        v += fixed_vector<element_type>{.5, .5, .5};
+        v *= 2;
+        v >>= 1;
+        expect_identical(fixed_vector<element_type>{2., .25, 8.5}, v);
+    }
+
+    TEST(fixed_array, sum)  // NOLINT
+    {
+        using element_type = scaled_integer<std::int16_t, power<-8>>;
+        auto const a = fixed_array<element_type, 4>{{127., 127., 127., -.5}};
+
+        auto const total = cnl::sum(a);
+        static_assert(std::is_same<scaled_integer<std::int32_t, power<-8>>, decltype(cnl::sum(a))>::value, "");
+        EXPECT_EQ(380.5, static_cast<double>(total));
+    }
+
+    TEST(fixed_array, sum_elastic)  // NOLINT
+    {
+        auto const v = fixed_vector<cnl::elastic_integer<8>>(1000, 255);
+        auto const total = cnl::sum(v);
+        static_assert(std::is_same<cnl::elastic_integer<39>, decltype(cnl::sum(v))>::value, "");
+        EXPECT_EQ(255000, total);
+    }
+
+    TEST(fixed_array, dot)  // NOLINT
+    {
+        using lhs_type = scaled_integer<std::int16_t, power<-8>>;
+        using rhs_type = scaled_integer<std::int16_t, power<-4>>;
+        auto const lhs = fixed_array<lhs_type, 3>{{127., -.5, 3.}};
+        auto const rhs = fixed_array<rhs_type, 3>{{2047., 4., .0625}};
+
+        auto const product = cnl::dot(lhs, rhs);
+        static_assert(std::is_same<scaled_integer<std::int64_t, power<-12>>, decltype(cnl::dot(lhs, rhs))>::value, "");
+        EXPECT_EQ(127.*2047.-2.+.1875, static_cast<double>(product));
+    }
+
+    TEST(fixed_array, sum_wider_than_64_bits)  // NOLINT
+    {
+        using element_type = scaled_integer<std::int64_t, power<-40>>;
+        auto const extreme = cnl::_impl::from_rep<element_type>(std::numeric_limits<std::int64_t>::max());
+        auto const v = fixed_vector<element_type>(4, extreme);
+
+        auto const total = cnl::sum(v);
+        static_assert(cnl::digits<decltype(cnl::sum(v))>::value>=94, "");
+        EXPECT_EQ(4.*static_cast<double>(extreme), static_cast<double>(total));
+    }
+
+    TEST(fixed_array, dot_wider_than_64_bits)  // NOLINT
+    {
+        using element_type = scaled_integer<std::int32_t, power<-16>>;
+        auto const extreme = cnl::_impl::from_rep<element_type>(std::numeric_limits<std::int32_t>::min());
+        auto const v = fixed_vector<element_type>(4, extreme);
+
+        auto const product = cnl::dot(v, v);
+        static_assert(cnl::digits<decltype(cnl::dot(v, v))>::value>=93, "");
+        EXPECT_EQ(4.*32768.*32768., static_cast<double>(product));
+    }
+}
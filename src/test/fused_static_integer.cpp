@@ -0,0 +1,170 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/fused_static_integer.h>
+#include <cnl/static_integer.h>
+
+#include <cnl/_impl/config.h>
+#include <cnl/_impl/type_traits/identical.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+namespace {
+    using cnl::_impl::identical;
+    using cnl::fused_static_integer;
+    using cnl::static_integer;
+
+    // true iff the fused and composed integers have the same value and the same number of digits
+    template<int FusedDigits, int ComposedDigits, class RoundingTag, class OverflowTag>
+    constexpr bool equivalent(
+            fused_static_integer<FusedDigits, RoundingTag, OverflowTag> const& fused,
+            static_integer<ComposedDigits, RoundingTag, OverflowTag> const& composed)
+    {
+        return FusedDigits==ComposedDigits && static_cast<long long>(fused)==static_cast<long long>(composed);
+    }
+
+    namespace test_rep {
+        static_assert(std::is_same<int, fused_static_integer<7>::rep>::value, "");
+        static_assert(std::is_same<std::int64_t, fused_static_integer<40>::rep>::value, "");
+        static_assert(sizeof(fused_static_integer<7>)==sizeof(static_integer<7>), "");
+    }
+
+    namespace test_convert {
+        static_assert(equivalent(fused_static_integer<7>{2.7}, static_integer<7>{2.7}), "");
+        static_assert(equivalent(fused_static_integer<7>{-2.5}, static_integer<7>{-2.5}), "");
+        static_assert(equivalent(
+                fused_static_integer<7, cnl::native_rounding_tag>{2.7},
+                static_integer<7, cnl::native_rounding_tag>{2.7}), "");
+        static_assert(identical(fused_static_integer<3>{5}, fused_static_integer<3>{fused_static_integer<7>{5}}), "");
+        static_assert(identical(std::int8_t{-100}, static_cast<std::int8_t>(fused_static_integer<7>{-100})), "");
+        static_assert(identical(-2., static_cast<double>(fused_static_integer<7>{-2})), "");
+    }
+
+    namespace test_arithmetic {
+        static_assert(equivalent(
+                fused_static_integer<6>{7}*fused_static_integer<13>{321},
+                static_integer<6>{7}*static_integer<13>{321}), "");
+        static_assert(equivalent(
+                fused_static_integer<7>{100}-fused_static_integer<5>{-20},
+                static_integer<7>{100}-static_integer<5>{-20}), "");
+        static_assert(equivalent(fused_static_integer<7>{3}*5, static_integer<7>{3}*5), "");
+        static_assert(equivalent(5U+fused_static_integer<7>{3}, 5U+static_integer<7>{3}), "");
+        static_assert(equivalent(
+                fused_static_integer<7>{3}+cnl::constant<100>{},
+                static_integer<7>{3}+cnl::constant<100>{}), "");
+        static_assert(equivalent(
+                fused_static_integer<7>{100}%fused_static_integer<5>{7},
+                static_integer<7>{100}%static_integer<5>{7}), "");
+        static_assert(equivalent(-fused_static_integer<7>{3}, -static_integer<7>{3}), "");
+        static_assert(equivalent(
+                fused_static_integer<7>{3}&fused_static_integer<3>{5},
+                static_integer<7>{3}&static_integer<3>{5}), "");
+    }
+
+    namespace test_divide {
+        static_assert(equivalent(
+                fused_static_integer<7>{7}/fused_static_integer<5>{2},
+                static_integer<7>{7}/static_integer<5>{2}), "");
+        static_assert(equivalent(
+                fused_static_integer<7>{-7}/fused_static_integer<5>{2},
+                static_integer<7>{-7}/static_integer<5>{2}), "");
+        static_assert(equivalent(
+                -9/fused_static_integer<4>{10},
+                -9/static_integer<4>{10}), "");
+        static_assert(equivalent(
+                fused_static_integer<2, cnl::native_rounding_tag>{3}
+                / fused_static_integer<3, cnl::native_rounding_tag>{4},
+                static_integer<2, cnl::native_rounding_tag>{3}/static_integer<3, cnl::native_rounding_tag>{4}), "");
+    }
+
+    namespace test_shift {
+        static_assert(equivalent(
+                fused_static_integer<7>{0x57} >> cnl::constant<2>{},
+                static_integer<7>{0x57} >> cnl::constant<2>{}), "");
+        static_assert(equivalent(
+                fused_static_integer<7>{-0x57} >> cnl::constant<2>{},
+                static_integer<7>{-0x57} >> cnl::constant<2>{}), "");
+        static_assert(equivalent(
+                fused_static_integer<7>{3} << cnl::constant<4>{},
+                static_integer<7>{3} << cnl::constant<4>{}), "");
+        static_assert(identical(fused_static_integer<11>{-48}, fused_static_integer<7>{-3} << cnl::constant<4>{}), "");
+        static_assert(equivalent(fused_static_integer<7>{3} << 4, static_integer<7>{3} << 4), "");
+        static_assert(equivalent(fused_static_integer<4>{15} >> 2, static_integer<4>{15} >> 2), "");
+    }
+
+    namespace test_compare {
+        static_assert(fused_static_integer<7>{3}==fused_static_integer<40>{3}, "");
+        static_assert(fused_static_integer<7>{-3}<0, "");
+        static_assert(cnl::constant<5>{}>fused_static_integer<7>{3}, "");
+    }
+
+    namespace test_saturated {
+        using saturated = fused_static_integer<5, cnl::nearest_rounding_tag, cnl::saturated_overflow_tag>;
+        static_assert(identical(saturated{31}, saturated{32}), "");
+        static_assert(identical(saturated{-31}, saturated{-1000}), "");
+        static_assert(equivalent(
+                fused_static_integer<7, cnl::nearest_rounding_tag, cnl::saturated_overflow_tag>{100} << 4,
+                static_integer<7, cnl::nearest_rounding_tag, cnl::saturated_overflow_tag>{100} << 4), "");
+    }
+
+    namespace test_unsigned {
+        // as with elastic_integer, results are unsigned unless the operation can produce a negative value
+        template<int Digits, class Narrowest>
+        using fused = fused_static_integer<Digits, cnl::nearest_rounding_tag, cnl::undefined_overflow_tag, Narrowest>;
+
+        static_assert(identical(fused<9, unsigned>{300}, fused<8, unsigned>{200}+fused<8, unsigned>{100}), "");
+        static_assert(identical(fused<16, unsigned>{20000}, fused<8, unsigned>{200}*fused<8, unsigned>{100}), "");
+        static_assert(identical(fused<8, int>{-2}, fused<8, unsigned>{3}-fused<8, unsigned>{5}), "");
+        static_assert(identical(fused<8, int>{-5}, -fused<8, unsigned>{5}), "");
+        static_assert(identical(
+                std::uint8_t{255}, static_cast<std::uint8_t>(fused<8, unsigned>{std::int16_t{255}})), "");
+        static_assert(identical(
+                fused_static_integer<8, cnl::nearest_rounding_tag, cnl::saturated_overflow_tag, unsigned>{0},
+                fused_static_integer<8, cnl::nearest_rounding_tag, cnl::saturated_overflow_tag, unsigned>{-5}), "");
+    }
+
+    namespace test_variable_shift {
+        // shifting by at least the number of digits is not undefined
+        static_assert(identical(fused_static_integer<7>{0}, fused_static_integer<7>{0} << 7), "");
+        static_assert(identical(fused_static_integer<7>{0}, fused_static_integer<7>{0} << 40), "");
+        static_assert(identical(fused_static_integer<7>{64}, fused_static_integer<7>{1} << 6), "");
+    }
+
+    TEST(fused_static_integer, compound_assignment)  // NOLINT
+    {
+        auto a = fused_static_integer<7>{3};
+        a += fused_static_integer<7>{4};
+        EXPECT_EQ(7, a);
+        a *= 2;
+        EXPECT_EQ(14, a);
+        EXPECT_EQ(14, a++);
+        EXPECT_EQ(16, ++a);
+        EXPECT_EQ(15, --a);
+    }
+
+#if !defined(CNL_UNREACHABLE_UB_ENABLED)
+    TEST(fused_static_integer, overflow)  // NOLINT
+    {
+        using trapping = fused_static_integer<3, cnl::nearest_rounding_tag, cnl::trapping_overflow_tag>;
+        ASSERT_DEATH(trapping{8}, "positive overflow");
+        ASSERT_DEATH(trapping{-8}, "negative overflow");
+
+        auto a = fused_static_integer<3>{7};
+        ASSERT_DEATH(++a, "positive overflow");
+        ASSERT_DEATH((void)(fused_static_integer<7>{100} << 4), "positive overflow");
+        ASSERT_DEATH((void)(fused_static_integer<7>{1} << 7), "positive overflow");
+        ASSERT_DEATH((void)(fused_static_integer<7>{1} << 40), "positive overflow");
+        ASSERT_DEATH((void)(fused_static_integer<7>{-1} << 40), "negative overflow");
+
+        using unsigned_trapping = fused_static_integer<
+                8, cnl::nearest_rounding_tag, cnl::trapping_overflow_tag, unsigned>;
+        ASSERT_DEATH(unsigned_trapping{-1}, "negative overflow");
+        ASSERT_DEATH((void)(unsigned_trapping{1} << 8), "positive overflow");
+    }
+#endif
+}
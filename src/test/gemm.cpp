@@ -0,0 +1,188 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/gemm.h>
+
+#include <cnl/overflow_integer.h>
+#include <cnl/rounding_integer.h>
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace {
+    using cnl::power;
+    using cnl::scaled_integer;
+
+    using q7 = scaled_integer<std::int8_t, power<-7>>;
+    using q15 = scaled_integer<std::int16_t, power<-15>>;
+    using s3_4 = scaled_integer<std::int8_t, power<-4>>;
+
+    namespace test_accumulator_type {
+        static_assert(std::is_same<
+                scaled_integer<std::int32_t, power<-14>>,
+                cnl::_impl::gemm_accumulator_t<q7, q7>>::value, "");
+        static_assert(std::is_same<
+                scaled_integer<std::int32_t, power<-11>>,
+                cnl::_impl::gemm_accumulator_t<s3_4, q7>>::value, "");
+        static_assert(std::is_same<
+                scaled_integer<std::int64_t, power<-30>>,
+                cnl::_impl::gemm_accumulator_t<q15, q15>>::value, "");
+    }
+
+    // deterministic sequence of values spanning the range of T
+    template<typename T>
+    std::vector<T> make_matrix(std::size_t size, unsigned seed)
+    {
+        auto matrix = std::vector<T>(size);
+        for (auto& element : matrix) {
+            seed = seed*1103515245U+12345U;
+            element = cnl::_impl::from_rep<T>(static_cast<cnl::_impl::gemm_rep_t<T>>(seed >> 16U));
+        }
+        return matrix;
+    }
+
+    // multiplies matrices one element at a time
+    template<typename Result, typename Lhs, typename Rhs>
+    std::vector<Result> reference_gemm(
+            std::size_t rows, std::size_t columns, std::size_t depth,
+            std::vector<Lhs> const& lhs, std::vector<Rhs> const& rhs)
+    {
+        auto result = std::vector<Result>(rows*columns);
+        for (std::size_t row = 0; row!=rows; ++row) {
+            for (std::size_t column = 0; column!=columns; ++column) {
+                auto sum = cnl::_impl::gemm_accumulator_t<Lhs, Rhs>{0};
+                for (std::size_t k = 0; k!=depth; ++k) {
+                    sum += cnl::_impl::exact_multiply(lhs[row*depth+k], rhs[k*columns+column]);
+                }
+                result[row*columns+column] = static_cast<Result>(sum);
+            }
+        }
+        return result;
+    }
+
+    TEST(gemm, small)  // NOLINT
+    {
+        auto const lhs = std::vector<s3_4>{1, 2, 3, -4, .5, -.25};
+        auto const rhs = std::vector<s3_4>{.5, 1, -1, 2, 7, .0625};
+        auto result = std::vector<scaled_integer<std::int32_t, power<-8>>>(4);
+        cnl::gemm(2, 2, 3, lhs.data(), rhs.data(), result.data());
+
+        EXPECT_EQ(19.5, static_cast<double>(result[0]));
+        EXPECT_EQ(5.1875, static_cast<double>(result[1]));
+        EXPECT_EQ(-4.25, static_cast<double>(result[2]));
+        EXPECT_EQ(-3.015625, static_cast<double>(result[3]));
+    }
+
+    TEST(gemm, empty_depth)  // NOLINT
+    {
+        auto result = std::vector<q15>(6, q15{.5});
+        cnl::gemm(2, 3, 0, static_cast<q7 const*>(nullptr), static_cast<q7 const*>(nullptr), result.data());
+
+        EXPECT_EQ(std::vector<q15>(6, q15{0}), result);
+    }
+
+    TEST(gemm, crosses_blocks)  // NOLINT
+    {
+        using result_type = scaled_integer<std::int32_t, power<-11>>;
+        constexpr auto rows = std::size_t{67};
+        constexpr auto columns = std::size_t{270};
+        constexpr auto depth = std::size_t{300};
+        auto const lhs = make_matrix<s3_4>(rows*depth, 1);
+        auto const rhs = make_matrix<q7>(depth*columns, 2);
+
+        auto actual = std::vector<result_type>(rows*columns);
+        cnl::gemm(rows, columns, depth, lhs.data(), rhs.data(), actual.data(), 1);
+
+        EXPECT_EQ((reference_gemm<result_type>(rows, columns, depth, lhs, rhs)), actual);
+    }
+
+    TEST(gemm, int16)  // NOLINT
+    {
+        constexpr auto rows = std::size_t{9};
+        constexpr auto columns = std::size_t{21};
+        constexpr auto depth = std::size_t{33};
+        auto const lhs = make_matrix<q15>(rows*depth, 3);
+        auto const rhs = make_matrix<q15>(depth*columns, 4);
+
+        auto actual = std::vector<q15>(rows*columns);
+        cnl::gemm(rows, columns, depth, lhs.data(), rhs.data(), actual.data());
+
+        EXPECT_EQ((reference_gemm<q15>(rows, columns, depth, lhs, rhs)), actual);
+    }
+
+    TEST(gemm, concurrency_does_not_affect_result)  // NOLINT
+    {
+        constexpr auto rows = std::size_t{300};
+        constexpr auto columns = std::size_t{40};
+        constexpr auto depth = std::size_t{50};
+        auto const lhs = make_matrix<q7>(rows*depth, 5);
+        auto const rhs = make_matrix<q7>(depth*columns, 6);
+
+        auto single = std::vector<q7>(rows*columns);
+        cnl::gemm(rows, columns, depth, lhs.data(), rhs.data(), single.data(), 1);
+
+        for (auto concurrency : {2U, 3U, 4U, 16U}) {
+            auto multiple = std::vector<q7>(rows*columns);
+            cnl::gemm(rows, columns, depth, lhs.data(), rhs.data(), multiple.data(), concurrency);
+            EXPECT_EQ(single, multiple) << "concurrency=" << concurrency;
+        }
+    }
+
+    TEST(gemm, result_rounding_and_overflow)  // NOLINT
+    {
+        using result_type = scaled_integer<
+                cnl::rounding_integer<cnl::overflow_integer<std::int8_t, cnl::saturated_overflow_tag>>,
+                power<-4>>;
+        constexpr auto rows = std::size_t{5};
+        constexpr auto columns = std::size_t{17};
+        constexpr auto depth = std::size_t{64};
+        auto const lhs = make_matrix<q7>(rows*depth, 7);
+        auto const rhs = make_matrix<s3_4>(depth*columns, 8);
+
+        auto actual = std::vector<result_type>(rows*columns);
+        cnl::gemm(rows, columns, depth, lhs.data(), rhs.data(), actual.data());
+
+        auto const expected = reference_gemm<result_type>(rows, columns, depth, lhs, rhs);
+        EXPECT_EQ(expected, actual);
+
+        auto const saturated = std::count_if(actual.begin(), actual.end(), [](result_type const& element) {
+            return element==cnl::numeric_limits<result_type>::max()
+                    || element==cnl::numeric_limits<result_type>::lowest();
+        });
+        EXPECT_LT(0, saturated);
+    }
+
+    TEST(gemm, deeper_than_accumulator)  // NOLINT
+    {
+        // 2^16+5 products of -1 and -1 overflow a 32-bit sum of q14 products
+        constexpr auto depth = cnl::_impl::gemm_max_depth+5;
+        auto const lhs = std::vector<q7>(2*depth, q7{-1.});
+        auto const rhs = std::vector<q7>(depth, q7{-1.});
+        auto result = std::vector<scaled_integer<std::int64_t, power<-14>>>(2);
+        cnl::gemm(2, 1, depth, lhs.data(), rhs.data(), result.data());
+
+        EXPECT_EQ(static_cast<double>(depth), static_cast<double>(result[0]));
+        EXPECT_EQ(static_cast<double>(depth), static_cast<double>(result[1]));
+    }
+
+    TEST(gemm, rounds_to_nearest)  // NOLINT
+    {
+        using result_type = scaled_integer<cnl::rounding_integer<std::int8_t>, power<-1>>;
+        auto const lhs = std::vector<s3_4>{.375, .125};
+        auto const rhs = std::vector<s3_4>{1};
+        auto result = std::vector<result_type>(2);
+        cnl::gemm(2, 1, 1, lhs.data(), rhs.data(), result.data());
+
+        EXPECT_EQ(.5, static_cast<double>(result[0]));
+        EXPECT_EQ(0., static_cast<double>(result[1]));
+    }
+}
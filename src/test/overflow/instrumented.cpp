@@ -0,0 +1,115 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/overflow.h>
+#include <cnl/overflow_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+    using instrumented_saturated_tag = cnl::instrumented_overflow_tag<cnl::saturated_overflow_tag>;
+
+    template<typename Rep>
+    using instrumented_saturated_integer = cnl::overflow_integer<Rep, instrumented_saturated_tag>;
+
+    static_assert(cnl::_impl::is_overflow_tag<instrumented_saturated_tag>::value, "");
+    static_assert(
+            cnl::_impl::overflow_operation_of<cnl::_impl::multiply_op>::value==cnl::overflow_operation::multiply,
+            "");
+    static_assert(
+            cnl::_impl::overflow_operation_of<cnl::_impl::modulo_op>::value==cnl::overflow_operation::other,
+            "");
+
+    // conversions which do not overflow are constant expressions
+    static_assert(cnl::_impl::to_rep(instrumented_saturated_integer<std::int8_t>{100})==100, "");
+
+    TEST(instrumented_overflow, no_overflow)  // NOLINT
+    {
+        auto& counters = cnl::instrumented_overflow_counters<instrumented_saturated_tag>();
+        counters.reset();
+
+        ASSERT_EQ(7, cnl::add<instrumented_saturated_tag>(3, 4));
+        ASSERT_EQ(12, cnl::multiply<instrumented_saturated_tag>(3, 4));
+        ASSERT_EQ(0U, counters.total());
+    }
+
+    TEST(instrumented_overflow, saturated)  // NOLINT
+    {
+        auto& counters = cnl::instrumented_overflow_counters<instrumented_saturated_tag>();
+        counters.reset();
+
+        ASSERT_EQ(INT32_MAX, cnl::add<instrumented_saturated_tag>(INT32_MAX, 1));
+        ASSERT_EQ(INT32_MIN, cnl::subtract<instrumented_saturated_tag>(INT32_MIN, 1));
+        ASSERT_EQ(INT32_MIN, cnl::multiply<instrumented_saturated_tag>(INT32_MAX, -2));
+        ASSERT_EQ(INT32_MAX, cnl::multiply<instrumented_saturated_tag>(INT32_MIN, -2));
+        ASSERT_EQ(127, instrumented_saturated_integer<std::int8_t>{1000});
+
+        ASSERT_EQ(1U, counters.count(cnl::overflow_operation::add, true));
+        ASSERT_EQ(0U, counters.count(cnl::overflow_operation::add, false));
+        ASSERT_EQ(1U, counters.count(cnl::overflow_operation::subtract, false));
+        ASSERT_EQ(2U, counters.count(cnl::overflow_operation::multiply));
+        ASSERT_EQ(1U, counters.count(cnl::overflow_operation::convert, true));
+        ASSERT_EQ(5U, counters.total());
+    }
+
+    TEST(instrumented_overflow, bucket)  // NOLINT
+    {
+        struct site_a;
+        struct site_b;
+        using tag_a = cnl::instrumented_overflow_tag<cnl::native_overflow_tag, site_a>;
+        using tag_b = cnl::instrumented_overflow_tag<cnl::native_overflow_tag, site_b>;
+
+        ASSERT_EQ(0U, cnl::add<tag_a>(UINT32_MAX, 1U));
+        ASSERT_EQ(0U, cnl::add<tag_a>(UINT32_MAX, 1U));
+        ASSERT_EQ(UINT32_MAX, cnl::subtract<tag_b>(0U, 1U));
+
+        ASSERT_EQ(2U, cnl::instrumented_overflow_counters<tag_a>().total());
+        ASSERT_EQ(1U, cnl::instrumented_overflow_counters<tag_b>().total());
+    }
+
+    TEST(instrumented_overflow, threads)  // NOLINT
+    {
+        struct site;
+        using tag = cnl::instrumented_overflow_tag<cnl::saturated_overflow_tag, site>;
+
+        std::vector<std::thread> threads;
+        for (auto t = 0; t!=4; ++t) {
+            threads.emplace_back([] {
+                for (auto i = 0; i!=1000; ++i) {
+                    (void)cnl::add<tag>(INT32_MAX, i+1);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        ASSERT_EQ(4000U, cnl::instrumented_overflow_counters<tag>().count(cnl::overflow_operation::add));
+    }
+
+    TEST(instrumented_overflow, to_json)  // NOLINT
+    {
+        struct site;
+        using tag = cnl::instrumented_overflow_tag<cnl::saturated_overflow_tag, site>;
+        (void)cnl::multiply<tag>(INT32_MIN, 2);
+
+        ASSERT_EQ(
+                "{\"convert\":{\"positive\":0,\"negative\":0},"
+                "\"negate\":{\"positive\":0,\"negative\":0},"
+                "\"add\":{\"positive\":0,\"negative\":0},"
+                "\"subtract\":{\"positive\":0,\"negative\":0},"
+                "\"multiply\":{\"positive\":0,\"negative\":1},"
+                "\"divide\":{\"positive\":0,\"negative\":0},"
+                "\"shift_left\":{\"positive\":0,\"negative\":0},"
+                "\"other\":{\"positive\":0,\"negative\":0},"
+                "\"total\":1}",
+                cnl::to_json(cnl::instrumented_overflow_counters<tag>()));
+    }
+}
@@ -0,0 +1,153 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/elastic_integer.h>
+#include <cnl/overflow.h>
+#include <cnl/overflow_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+namespace {
+    using cnl::_impl::identical;
+
+    namespace test_saturated_binary_operator {
+        static_assert(cnl::_impl::saturated_binary_operator<cnl::_impl::add_op, int, int>::value,
+                "cnl::_impl::saturated_binary_operator test failed");
+        static_assert(!cnl::_impl::saturated_binary_operator<cnl::_impl::divide_op, int, int>::value,
+                "cnl::_impl::saturated_binary_operator test failed");
+
+        static_assert(identical(INT32_MAX, cnl::add<cnl::saturated_overflow_tag>(INT32_MAX, 1)),
+                "cnl::_impl::saturated_binary_operator test failed");
+        static_assert(identical(INT32_MIN, cnl::add<cnl::saturated_overflow_tag>(INT32_MIN, -1)),
+                "cnl::_impl::saturated_binary_operator test failed");
+        static_assert(identical(0U, cnl::subtract<cnl::saturated_overflow_tag>(1U, 2U)),
+                "cnl::_impl::saturated_binary_operator test failed");
+        static_assert(identical(INT32_MIN, cnl::multiply<cnl::saturated_overflow_tag>(65536, -65536)),
+                "cnl::_impl::saturated_binary_operator test failed");
+        static_assert(identical(UINT32_MAX, cnl::multiply<cnl::saturated_overflow_tag>(65536U, 65536U)),
+                "cnl::_impl::saturated_binary_operator test failed");
+        static_assert(identical(-46340*46340, cnl::multiply<cnl::saturated_overflow_tag>(46340, -46340)),
+                "cnl::_impl::saturated_binary_operator test failed");
+#if defined(CNL_BUILTIN_OVERFLOW_ENABLED)
+        static_assert(identical(INT64_MAX, cnl::add<cnl::saturated_overflow_tag>(INT64_MAX, INT64_C(1))),
+                "cnl::_impl::saturated_binary_operator test failed");
+        static_assert(identical(INT64_MAX, cnl::subtract<cnl::saturated_overflow_tag>(INT64_C(0), INT64_MIN)),
+                "cnl::_impl::saturated_binary_operator test failed");
+        static_assert(identical(INT64_MIN, cnl::multiply<cnl::saturated_overflow_tag>(INT64_MIN, INT64_C(2))),
+                "cnl::_impl::saturated_binary_operator test failed");
+        static_assert(identical(INT64_MAX, cnl::multiply<cnl::saturated_overflow_tag>(INT64_MIN, INT64_C(-1))),
+                "cnl::_impl::saturated_binary_operator test failed");
+        static_assert(identical(UINT64_MAX, cnl::multiply<cnl::saturated_overflow_tag>(UINT64_MAX, UINT64_C(2))),
+                "cnl::_impl::saturated_binary_operator test failed");
+#endif
+    }
+
+    namespace test_saturated_convert_operator {
+        static_assert(identical(std::int16_t{32767}, cnl::convert<cnl::saturated_overflow_tag, cnl::_impl::native_tag, std::int16_t>(40000)),
+                "cnl::_impl::saturated_convert_operator test failed");
+        static_assert(identical(std::int16_t{-32768}, cnl::convert<cnl::saturated_overflow_tag, cnl::_impl::native_tag, std::int16_t>(-40000)),
+                "cnl::_impl::saturated_convert_operator test failed");
+        static_assert(identical(std::uint8_t{0}, cnl::convert<cnl::saturated_overflow_tag, cnl::_impl::native_tag, std::uint8_t>(-1)),
+                "cnl::_impl::saturated_convert_operator test failed");
+        static_assert(identical(INT32_MAX, cnl::convert<cnl::saturated_overflow_tag, cnl::_impl::native_tag, std::int32_t>(UINT32_MAX)),
+                "cnl::_impl::saturated_convert_operator test failed");
+        static_assert(identical(UINT32_C(7), cnl::convert<cnl::saturated_overflow_tag, cnl::_impl::native_tag, std::uint32_t>(7)),
+                "cnl::_impl::saturated_convert_operator test failed");
+
+        // elastic_integer
+        using saturated_elastic = cnl::overflow_integer<cnl::elastic_integer<7>, cnl::saturated_overflow_tag>;
+        static_assert(identical(saturated_elastic{127}, saturated_elastic{cnl::elastic_integer<15>{1000}}),
+                "cnl::_impl::saturated_convert_operator test failed");
+        static_assert(identical(saturated_elastic{-127}, saturated_elastic{cnl::elastic_integer<15>{-1000}}),
+                "cnl::_impl::saturated_convert_operator test failed");
+        static_assert(identical(saturated_elastic{-100}, saturated_elastic{cnl::elastic_integer<15>{-100}}),
+                "cnl::_impl::saturated_convert_operator test failed");
+    }
+
+    template<typename Rep>
+    void test_batch()
+    {
+        constexpr auto size = 67;
+        std::array<Rep, size> lhs{};
+        std::array<Rep, size> rhs{};
+        for (auto index = 0; index!=size; ++index) {
+            lhs[index] = static_cast<Rep>(static_cast<std::uint64_t>(index)*UINT64_C(0x9e3779b97f4a7c15));
+            rhs[index] = static_cast<Rep>(static_cast<std::uint64_t>(index)*UINT64_C(0xc2b2ae3d27d4eb4f));
+        }
+        lhs[0] = cnl::numeric_limits<Rep>::max();
+        rhs[0] = cnl::numeric_limits<Rep>::max();
+        lhs[1] = cnl::numeric_limits<Rep>::lowest();
+        rhs[1] = cnl::numeric_limits<Rep>::max();
+
+        std::array<Rep, size> sum{};
+        cnl::saturated_add(lhs.data(), rhs.data(), sum.data(), size);
+        std::array<Rep, size> difference{};
+        cnl::saturated_subtract(lhs.data(), rhs.data(), difference.data(), size);
+        std::array<Rep, size> product{};
+        cnl::saturated_multiply(lhs.data(), rhs.data(), product.data(), size);
+
+        using saturated = cnl::overflow_integer<Rep, cnl::saturated_overflow_tag>;
+        for (auto index = 0; index!=size; ++index) {
+            ASSERT_EQ(saturated{saturated{lhs[index]}+saturated{rhs[index]}}, sum[index]) << index;
+            ASSERT_EQ(saturated{saturated{lhs[index]}-saturated{rhs[index]}}, difference[index]) << index;
+            ASSERT_EQ(saturated{saturated{lhs[index]}*saturated{rhs[index]}}, product[index]) << index;
+        }
+    }
+
+    TEST(saturated_batch, int8)  // NOLINT
+    {
+        test_batch<std::int8_t>();
+    }
+
+    TEST(saturated_batch, uint8)  // NOLINT
+    {
+        test_batch<std::uint8_t>();
+    }
+
+    TEST(saturated_batch, int16)  // NOLINT
+    {
+        test_batch<std::int16_t>();
+    }
+
+    TEST(saturated_batch, uint16)  // NOLINT
+    {
+        test_batch<std::uint16_t>();
+    }
+
+    TEST(saturated_batch, int32)  // NOLINT
+    {
+        test_batch<std::int32_t>();
+    }
+
+    TEST(saturated_batch, uint32)  // NOLINT
+    {
+        test_batch<std::uint32_t>();
+    }
+
+    TEST(saturated_batch, int64)  // NOLINT
+    {
+        test_batch<std::int64_t>();
+    }
+
+    TEST(saturated_batch, uint64)  // NOLINT
+    {
+        test_batch<std::uint64_t>();
+    }
+
+    TEST(saturated_batch, convert)  // NOLINT
+    {
+        std::array<std::int32_t, 5> const from{{-100000, -32769, 0, 32768, 100}};
+        std::array<std::int16_t, 5> result{};
+        cnl::saturated_convert(from.data(), result.data(), from.size());
+
+        std::array<std::int16_t, 5> const expected{{-32768, -32768, 0, 32767, 100}};
+        ASSERT_EQ(expected, result);
+    }
+}
@@ -0,0 +1,99 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/overflow.h>
+#include <cnl/overflow_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+
+namespace {
+    template<typename Rep>
+    using sticky_integer = cnl::overflow_integer<Rep, cnl::sticky_overflow_tag>;
+
+    static_assert(cnl::_impl::is_overflow_tag<cnl::sticky_overflow_tag>::value, "");
+
+    // conversions which do not overflow are constant expressions
+    static_assert(cnl::_impl::to_rep(sticky_integer<std::int8_t>{100})==100, "");
+
+    TEST(sticky_overflow, add)  // NOLINT
+    {
+        cnl::clear_overflow_status();
+        ASSERT_EQ(7, cnl::add<cnl::sticky_overflow_tag>(3, 4));
+        ASSERT_FALSE(cnl::overflow_status());
+
+        (void)cnl::add<cnl::sticky_overflow_tag>(INT32_C(0x7fffffff), INT32_C(1));
+        ASSERT_TRUE(cnl::overflow_status());
+
+        // flag is sticky
+        ASSERT_EQ(7, cnl::add<cnl::sticky_overflow_tag>(3, 4));
+        ASSERT_TRUE(cnl::overflow_status());
+
+        cnl::clear_overflow_status();
+        ASSERT_FALSE(cnl::overflow_status());
+    }
+
+    TEST(sticky_overflow, subtract)  // NOLINT
+    {
+        cnl::clear_overflow_status();
+        (void)cnl::subtract<cnl::sticky_overflow_tag>(UINT32_C(0), UINT32_C(1));
+        ASSERT_TRUE(cnl::overflow_status());
+        cnl::clear_overflow_status();
+    }
+
+    TEST(sticky_overflow, multiply)  // NOLINT
+    {
+        cnl::clear_overflow_status();
+        ASSERT_EQ(INT64_C(0x100000000), cnl::multiply<cnl::sticky_overflow_tag>(INT64_C(0x10000), INT64_C(0x10000)));
+        ASSERT_FALSE(cnl::overflow_status());
+
+        (void)cnl::multiply<cnl::sticky_overflow_tag>(INT64_C(0x100000000), INT64_C(0x100000000));
+        ASSERT_TRUE(cnl::overflow_status());
+        cnl::clear_overflow_status();
+    }
+
+    TEST(sticky_overflow, convert)  // NOLINT
+    {
+        cnl::clear_overflow_status();
+        ASSERT_EQ(100, (sticky_integer<std::int8_t>{100}));
+        ASSERT_FALSE(cnl::overflow_status());
+
+        ASSERT_EQ(127, (sticky_integer<std::int8_t>{1000}));
+        ASSERT_TRUE(cnl::overflow_status());
+        cnl::clear_overflow_status();
+    }
+
+    TEST(sticky_overflow, overflow_integer)  // NOLINT
+    {
+        cnl::clear_overflow_status();
+        auto sum = sticky_integer<int>{0};
+        for (auto i = 0; i!=1000; ++i) {
+            sum = sum+sticky_integer<int>{i};
+        }
+        ASSERT_EQ(499500, sum);
+        ASSERT_FALSE(cnl::overflow_status());
+
+        auto product = sticky_integer<int>{1};
+        for (auto i = 1; i!=20; ++i) {
+            product = product*sticky_integer<int>{i};
+        }
+        ASSERT_TRUE(cnl::overflow_status());
+        cnl::clear_overflow_status();
+    }
+
+    TEST(sticky_overflow, thread_local_status)  // NOLINT
+    {
+        cnl::clear_overflow_status();
+        std::thread([] {
+            (void)cnl::add<cnl::sticky_overflow_tag>(UINT8_C(255), 1U);
+            (void)cnl::add<cnl::sticky_overflow_tag>(UINT32_C(0xffffffff), UINT32_C(1));
+            ASSERT_TRUE(cnl::overflow_status());
+        }).join();
+        ASSERT_FALSE(cnl::overflow_status());
+    }
+}
@@ -0,0 +1,165 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/parallel.h>
+
+#include <cnl/elastic_integer.h>
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace {
+    using cnl::elastic_integer;
+    using cnl::power;
+    using cnl::scaled_integer;
+
+    using q15 = scaled_integer<std::int16_t, power<-15>>;
+    using e24 = elastic_integer<24>;
+
+    namespace test_accumulator_type {
+        static_assert(std::is_same<
+                scaled_integer<std::int64_t, power<-15>>,
+                cnl::_impl::parallel_sum_t<q15>>::value, "");
+        static_assert(std::is_same<
+                elastic_integer<55>,
+                cnl::_impl::parallel_sum_t<e24>>::value, "");
+        static_assert(std::is_same<
+                scaled_integer<std::int64_t, power<-30>>,
+                cnl::_impl::parallel_product_sum_t<q15, q15>>::value, "");
+    }
+
+    // numbers of threads over which every result must be identical
+    constexpr unsigned concurrencies[] = {1, 2, 3, 4, 7, 16, 64};  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+
+    // enough elements to be divided between several threads
+    constexpr std::size_t large_size = std::size_t{7} << 15;
+
+    // deterministic sequence of values spanning the range of T
+    template<typename T>
+    std::vector<T> make_values(std::size_t size, unsigned seed, std::int32_t bits)
+    {
+        auto values = std::vector<T>(size);
+        for (auto& element : values) {
+            seed = seed*1103515245U+12345U;
+            element = cnl::_impl::from_rep<T>(static_cast<std::int32_t>(seed) >> (32-bits));
+        }
+        return values;
+    }
+
+    template<typename T>
+    std::int64_t reference_reduce(std::vector<T> const& values)
+    {
+        auto total = std::int64_t{0};
+        for (auto const& element : values) {
+            total += cnl::_impl::to_rep(element);
+        }
+        return total;
+    }
+
+    TEST(parallel, reduce_scaled_integer)  // NOLINT
+    {
+        auto const values = make_values<q15>(large_size, 1, 16);
+        auto const expected = reference_reduce(values);
+        for (auto concurrency : concurrencies) {
+            auto const actual = cnl::reduce(values.data(), values.size(), concurrency);
+            EXPECT_EQ(expected, cnl::_impl::to_rep(actual)) << "concurrency=" << concurrency;
+        }
+    }
+
+    TEST(parallel, reduce_elastic_integer)  // NOLINT
+    {
+        auto const values = make_values<e24>(large_size, 2, 24);
+        auto const expected = reference_reduce(values);
+        for (auto concurrency : concurrencies) {
+            auto const actual = cnl::reduce(values.data(), values.size(), concurrency);
+            EXPECT_EQ(expected, cnl::_impl::to_rep(actual)) << "concurrency=" << concurrency;
+        }
+    }
+
+    TEST(parallel, reduce_extremes)  // NOLINT
+    {
+        auto const values = std::vector<q15>(large_size, cnl::numeric_limits<q15>::lowest());
+        auto const expected = scaled_integer<std::int64_t, power<-15>>{-static_cast<double>(large_size)};
+        for (auto concurrency : concurrencies) {
+            EXPECT_EQ(expected, cnl::reduce(values.data(), values.size(), concurrency));
+        }
+    }
+
+    TEST(parallel, reduce_small)  // NOLINT
+    {
+        auto const values = std::vector<e24>{1, -2, 3, 8388607};
+        EXPECT_EQ(elastic_integer<55>{8388609}, cnl::reduce(values.data(), values.size(), 16));
+        EXPECT_EQ(elastic_integer<55>{0}, cnl::reduce(values.data(), 0, 16));
+    }
+
+    TEST(parallel, dot)  // NOLINT
+    {
+        auto const lhs = make_values<q15>(large_size, 3, 16);
+        auto const rhs = make_values<q15>(large_size, 4, 16);
+
+        auto expected = std::int64_t{0};
+        for (std::size_t index = 0; index!=large_size; ++index) {
+            expected += std::int64_t{cnl::_impl::to_rep(lhs[index])}*cnl::_impl::to_rep(rhs[index]);
+        }
+
+        for (auto concurrency : concurrencies) {
+            auto actual = cnl::dot(lhs.data(), rhs.data(), large_size, concurrency);
+            static_assert(std::is_same<scaled_integer<std::int64_t, power<-30>>, decltype(actual)>::value, "");
+            EXPECT_EQ(expected, cnl::_impl::to_rep(actual)) << "concurrency=" << concurrency;
+        }
+    }
+
+    TEST(parallel, dot_elastic_integer)  // NOLINT
+    {
+        auto const lhs = make_values<e24>(large_size, 5, 24);
+        auto const rhs = make_values<elastic_integer<7>>(large_size, 6, 8);
+
+        auto expected = std::int64_t{0};
+        for (std::size_t index = 0; index!=large_size; ++index) {
+            expected += std::int64_t{cnl::_impl::to_rep(lhs[index])}*cnl::_impl::to_rep(rhs[index]);
+        }
+
+        for (auto concurrency : concurrencies) {
+            auto actual = cnl::dot(lhs.data(), rhs.data(), large_size, concurrency);
+            static_assert(std::is_same<elastic_integer<62>, decltype(actual)>::value, "");
+            EXPECT_EQ(expected, cnl::_impl::to_rep(actual)) << "concurrency=" << concurrency;
+        }
+    }
+
+    TEST(parallel, inclusive_scan)  // NOLINT
+    {
+        using accumulator = cnl::_impl::parallel_sum_t<q15>;
+
+        auto const values = make_values<q15>(large_size, 7, 16);
+        auto expected = std::vector<std::int64_t>(large_size);
+        auto total = std::int64_t{0};
+        for (std::size_t index = 0; index!=large_size; ++index) {
+            expected[index] = total += cnl::_impl::to_rep(values[index]);
+        }
+
+        for (auto concurrency : concurrencies) {
+            auto actual = std::vector<accumulator>(large_size);
+            cnl::inclusive_scan(values.data(), values.size(), actual.data(), concurrency);
+            for (std::size_t index = 0; index!=large_size; ++index) {
+                ASSERT_EQ(expected[index], cnl::_impl::to_rep(actual[index]))
+                        << "concurrency=" << concurrency << " index=" << index;
+            }
+        }
+    }
+
+    TEST(parallel, inclusive_scan_elastic_integer)  // NOLINT
+    {
+        auto const values = std::vector<e24>{5, -7, 11, -13};
+        auto actual = std::vector<elastic_integer<55>>(values.size());
+        cnl::inclusive_scan(values.data(), values.size(), actual.data(), 4);
+        EXPECT_EQ((std::vector<elastic_integer<55>>{5, -2, 9, -4}), actual);
+    }
+}
@@ -7,6 +7,8 @@
 #include <cnl/_impl/type_traits/identical.h>
 #include <cnl/scaled_integer.h>
 
+#include <gtest/gtest.h>
+
 template<typename Rep, int Exponent>
 using decimal_scaled_integer = cnl::scaled_integer<Rep, cnl::power<Exponent, 10>>;
 
@@ -95,3 +97,77 @@ namespace test_remainder {
             decimal_scaled_integer<int, -3>{2}%decimal_scaled_integer<int, 0>{3},
             decimal_scaled_integer<int, -3>{0.002}), "");
 }
+
+#if defined(CNL_INT128_ENABLED)
+namespace test_decimal_divide {
+    static_assert(
+            cnl::uint128{12345678901234567890u}==cnl::_impl::decimal_divide<3>(
+                    cnl::uint128{12345678901234567890u}*1000+999),
+            "cnl::_impl::decimal_divide");
+    static_assert(
+            cnl::uint128{1}==cnl::_impl::decimal_divide<19>(cnl::uint128{10000000000000000000u}),
+            "cnl::_impl::decimal_divide by largest tabulated power");
+    static_assert(
+            cnl::uint128{34}==cnl::_impl::decimal_divide<37>(~cnl::uint128{0}),
+            "cnl::_impl::decimal_divide by power beyond table");
+
+    static_assert(
+            identical(cnl::int128{-123}, cnl::_impl::scale<-2, 10>(cnl::int128{-12399})),
+            "cnl::scale<-2, 10, cnl::int128> truncates toward zero");
+}
+
+namespace test_int128_rescale {
+    static_assert(identical(
+            decimal_scaled_integer<cnl::int128, -4>{-1.2345},
+            decimal_scaled_integer<cnl::int128, -4>{decimal_scaled_integer<cnl::int128, -8>{-1.23456789}}), "");
+}
+#endif
+
+namespace test_binary_conversion {
+    template<typename Rep, int Exponent>
+    using binary_scaled_integer = cnl::scaled_integer<Rep, cnl::power<Exponent>>;
+
+    // without int128, the intermediate is a wide_integer, which divides at compile time from C++14
+#if defined(CNL_INT128_ENABLED) || (__cpp_constexpr >= 201304L)
+    static_assert(identical(
+            binary_scaled_integer<std::int64_t, -32>{-2.25},
+            binary_scaled_integer<std::int64_t, -32>{decimal_scaled_integer<std::int64_t, -4>{-2.25}}), "");
+    static_assert(identical(
+            decimal_scaled_integer<std::int64_t, -4>{1.5},
+            decimal_scaled_integer<std::int64_t, -4>{binary_scaled_integer<std::int64_t, -32>{1.5}}), "");
+#endif
+
+    // truncates toward zero
+    static_assert(identical(
+            decimal_scaled_integer<int, -1>{-.3},
+            decimal_scaled_integer<int, -1>{binary_scaled_integer<int, -8>{-.375}}), "");
+    static_assert(identical(
+            decimal_scaled_integer<unsigned, -1>{.3},
+            decimal_scaled_integer<unsigned, -1>{binary_scaled_integer<unsigned, -8>{.375}}), "");
+    static_assert(identical(
+            binary_scaled_integer<int, -2>{.25},
+            binary_scaled_integer<int, -2>{decimal_scaled_integer<int, -2>{.37}}), "");
+
+    static_assert(identical(
+            decimal_scaled_integer<int, 2>{800},
+            decimal_scaled_integer<int, 2>{binary_scaled_integer<int, 3>{800}}), "");
+}
+
+// the intermediate result of scaling up exceeds the widest fundamental integer
+TEST(scaled_integer_decimal, binary_conversion_wider_than_64_bits)  // NOLINT
+{
+    using binary = cnl::scaled_integer<std::int64_t, cnl::power<-40>>;
+    EXPECT_EQ(
+            (decimal_scaled_integer<std::int64_t, -4>{1000000.5}),
+            (decimal_scaled_integer<std::int64_t, -4>{binary{1000000.5}}));
+}
+
+#if defined(CNL_INT128_ENABLED)
+TEST(scaled_integer_decimal, binary_conversion_wider_than_128_bits)  // NOLINT
+{
+    using binary = cnl::scaled_integer<cnl::int128, cnl::power<-100>>;
+    EXPECT_EQ(
+            (decimal_scaled_integer<std::int64_t, -10>{-100000000.5}),
+            (decimal_scaled_integer<std::int64_t, -10>{binary{-100000000.5}}));
+}
+#endif
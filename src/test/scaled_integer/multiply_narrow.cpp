@@ -0,0 +1,133 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+namespace {
+    using cnl::_impl::identical;
+    using q15 = cnl::scaled_integer<std::int16_t, cnl::power<-15>>;
+    using q31 = cnl::scaled_integer<std::int32_t, cnl::power<-31>>;
+
+    namespace test_narrow_product_rep {
+        static_assert(
+                std::is_same<std::int32_t, cnl::_impl::narrow_product_rep<std::int16_t, std::int16_t>>::value,
+                "cnl::_impl::narrow_product_rep test failed");
+        static_assert(
+                std::is_same<std::int64_t, cnl::_impl::narrow_product_rep<std::int32_t, std::int32_t>>::value,
+                "cnl::_impl::narrow_product_rep test failed");
+        static_assert(
+                std::is_same<std::uint32_t, cnl::_impl::narrow_product_rep<std::uint16_t, std::uint16_t>>::value,
+                "cnl::_impl::narrow_product_rep test failed");
+        static_assert(
+                std::is_same<std::int32_t, cnl::_impl::narrow_product_rep<std::int16_t, std::uint16_t>>::value,
+                "cnl::_impl::narrow_product_rep test failed");
+    }
+
+    namespace test_narrow_product {
+        // the greatest shift, which discards every digit of the product
+        static_assert(identical(1, cnl::_impl::narrow_product<31>{}.operator()<int>(std::int32_t{1} << 30)),
+                "cnl::_impl::narrow_product test failed");
+        static_assert(identical(0, cnl::_impl::narrow_product<31>{}.operator()<int>((std::int32_t{1} << 30)-1)),
+                "cnl::_impl::narrow_product test failed");
+        static_assert(identical(-1, cnl::_impl::narrow_product<31>{}.operator()<int>(INT32_MIN)),
+                "cnl::_impl::narrow_product test failed");
+    }
+
+    namespace test_multiply_narrow {
+        static_assert(identical(q15{.25}, cnl::multiply_narrow<q15>(q15{.5}, q15{.5})),
+                "cnl::multiply_narrow test failed");
+        static_assert(identical(q15{-.25}, cnl::multiply_narrow<q15>(q15{-.5}, q15{.5})),
+                "cnl::multiply_narrow test failed");
+        static_assert(identical(q31{.375}, cnl::multiply_narrow<q31>(q31{.75}, q31{.5})),
+                "cnl::multiply_narrow test failed");
+
+        // different output format
+        static_assert(
+                identical(
+                        cnl::scaled_integer<std::int8_t, cnl::power<-4>>{.375},
+                        cnl::multiply_narrow<cnl::scaled_integer<std::int8_t, cnl::power<-4>>>(q15{.5}, q15{.75})),
+                "cnl::multiply_narrow test failed");
+
+        // result wider than product
+        static_assert(
+                identical(
+                        cnl::scaled_integer<std::int32_t, cnl::power<-20>>{.125},
+                        cnl::multiply_narrow<cnl::scaled_integer<std::int32_t, cnl::power<-20>>>(
+                                cnl::scaled_integer<std::int8_t, cnl::power<-4>>{.25},
+                                cnl::scaled_integer<std::int8_t, cnl::power<-4>>{.5})),
+                "cnl::multiply_narrow test failed");
+        static_assert(
+                identical(
+                        cnl::scaled_integer<std::int32_t, cnl::power<-20>>{-.125},
+                        cnl::multiply_narrow<cnl::scaled_integer<std::int32_t, cnl::power<-20>>>(
+                                cnl::scaled_integer<std::int8_t, cnl::power<-4>>{-.25},
+                                cnl::scaled_integer<std::int8_t, cnl::power<-4>>{.5})),
+                "cnl::multiply_narrow test failed");
+
+        // as with pmulhrsw, the one Q15 product which overflows, -1 * -1, wraps to -1
+        static_assert(identical(q15{-1}, cnl::multiply_narrow<q15>(q15{-1}, q15{-1})),
+                "cnl::multiply_narrow test failed");
+        static_assert(identical(q15{-1}, cnl::rounding_multiply(q15{-1}, q15{-1})),
+                "cnl::rounding_multiply test failed");
+
+        // rounds to nearest, unlike operator*
+        static_assert(
+                identical(
+                        cnl::_impl::from_rep<q15>(std::int16_t{1}),
+                        cnl::multiply_narrow<q15>(
+                                cnl::_impl::from_rep<q15>(std::int16_t{1}),
+                                cnl::_impl::from_rep<q15>(std::int16_t{16384}))),
+                "cnl::multiply_narrow test failed");
+        static_assert(
+                identical(
+                        cnl::_impl::from_rep<q15>(std::int16_t{0}),
+                        cnl::multiply_narrow<q15>(
+                                cnl::_impl::from_rep<q15>(std::int16_t{1}),
+                                cnl::_impl::from_rep<q15>(std::int16_t{16383}))),
+                "cnl::multiply_narrow test failed");
+        static_assert(
+                identical(
+                        cnl::_impl::from_rep<q15>(std::int16_t{0}),
+                        cnl::multiply_narrow<q15>(
+                                cnl::_impl::from_rep<q15>(std::int16_t{-1}),
+                                cnl::_impl::from_rep<q15>(std::int16_t{16384}))),
+                "cnl::multiply_narrow test failed");
+    }
+
+    namespace test_rounding_multiply {
+        static_assert(identical(q15{.125}, cnl::rounding_multiply(q15{.25}, q15{.5})),
+                "cnl::rounding_multiply test failed");
+        static_assert(identical(q15{-.125}, cnl::rounding_multiply(q15{.25}, q15{-.5})),
+                "cnl::rounding_multiply test failed");
+    }
+
+    TEST(multiply_narrow, batch)  // NOLINT
+    {
+        constexpr auto size = 67;
+        std::array<q15, size> lhs{};
+        std::array<q15, size> rhs{};
+        std::array<q15, size> result{};
+        for (auto index = 0; index!=size; ++index) {
+            lhs[index] = cnl::_impl::from_rep<q15>(static_cast<std::int16_t>(index*487-16000));
+            rhs[index] = cnl::_impl::from_rep<q15>(static_cast<std::int16_t>(12345-index*331));
+        }
+
+        cnl::rounding_multiply(lhs.data(), rhs.data(), result.data(), size);
+
+        for (auto index = 0; index!=size; ++index) {
+            auto const expected = static_cast<std::int16_t>(
+                    (cnl::_impl::to_rep(lhs[index])*cnl::_impl::to_rep(rhs[index])+0x4000) >> 15);
+            ASSERT_EQ(expected, cnl::_impl::to_rep(result[index])) << index;
+            ASSERT_EQ(cnl::rounding_multiply(lhs[index], rhs[index]), result[index]) << index;
+        }
+    }
+}
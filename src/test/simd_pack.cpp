@@ -0,0 +1,341 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/simd_pack.h>
+
+#include <cnl/elastic_integer.h>
+#include <cnl/overflow_integer.h>
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+namespace {
+    using cnl::simd_pack;
+
+    template<class Expected, class Actual>
+    bool simd_identical(Expected const& expected, Actual const& actual)
+    {
+        static_assert(std::is_same<Expected, Actual>::value, "expected and actual types are not the same");
+        return cnl::all_of(expected==actual);
+    }
+
+    namespace test_storage {
+#if defined(CNL_VECTOR_EXTENSIONS_ENABLED)
+        static_assert(cnl::_impl::is_simd_vectorizable<std::int16_t, 8>::value, "");
+        static_assert(cnl::_impl::is_simd_vectorizable<float, 4>::value, "");
+#endif
+        static_assert(!cnl::_impl::is_simd_vectorizable<std::int32_t, 3>::value, "");
+        static_assert(!cnl::_impl::is_simd_vectorizable<bool, 4>::value, "");
+        static_assert(simd_pack<std::int32_t, 4>::size()==4, "");
+    }
+
+    namespace test_numeric_limits {
+        static_assert(cnl::numeric_limits<simd_pack<int, 4>>::is_integer, "");
+        static_assert(!cnl::numeric_limits<simd_pack<int, 4>>::is_iec559, "");
+
+        static_assert(!cnl::numeric_limits<simd_pack<float, 4>>::is_integer, "");
+        static_assert(cnl::numeric_limits<simd_pack<float, 4>>::is_iec559, "");
+    }
+
+    namespace test_digits {
+        static_assert(cnl::digits<simd_pack<std::int16_t, 8>>::value==15, "");
+        static_assert(cnl::digits<simd_pack<std::uint32_t, 4>>::value==32, "");
+    }
+
+    namespace test_set_digits {
+        static_assert(std::is_same<
+                simd_pack<std::int16_t, 8>,
+                cnl::set_digits_t<simd_pack<signed, 8>, 15>>::value, "");
+        static_assert(std::is_same<
+                simd_pack<std::uint64_t, 2>,
+                cnl::set_digits_t<simd_pack<std::uint8_t, 2>, 33>>::value, "");
+    }
+
+    namespace test_operator_constraints {
+        template<typename Lhs, typename Rhs, class Enable = void>
+        struct can_add : std::false_type {
+        };
+
+        template<typename Lhs, typename Rhs>
+        struct can_add<Lhs, Rhs, decltype(void(std::declval<Lhs>()+std::declval<Rhs>()))> : std::true_type {
+        };
+
+        static_assert(can_add<simd_pack<int, 4>, simd_pack<int, 4>>::value, "");
+        static_assert(can_add<simd_pack<int, 4>, int>::value, "");
+        static_assert(can_add<short, simd_pack<int, 4>>::value, "");
+        static_assert(!can_add<simd_pack<int, 4>, simd_pack<int, 8>>::value, "");
+        static_assert(!can_add<simd_pack<int, 4>, int*>::value, "");
+        static_assert(!can_add<simd_pack<int, 4>, cnl::simd_mask<int, 4>>::value, "");
+    }
+
+    namespace test_signedness {
+        static_assert(cnl::is_signed<simd_pack<std::int16_t, 2>>::value, "");
+        static_assert(!cnl::is_signed<simd_pack<std::uint16_t, 2>>::value, "");
+        static_assert(std::is_same<
+                simd_pack<std::uint16_t, 2>,
+                cnl::remove_signedness_t<simd_pack<std::int16_t, 2>>>::value, "");
+        static_assert(std::is_same<
+                simd_pack<signed, 8>,
+                cnl::add_signedness_t<simd_pack<unsigned, 8>>>::value, "");
+    }
+
+    TEST(simd_pack, broadcast)  // NOLINT
+    {
+        auto const pack = simd_pack<std::int16_t, 8>{7};
+        for (auto lane = 0U; lane!=pack.size(); ++lane) {
+            ASSERT_EQ(7, pack[lane]);
+        }
+    }
+
+    TEST(simd_pack, load_store)  // NOLINT
+    {
+        std::int32_t const input[] = {1, -2, 3, -4, 5};  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        auto const pack = simd_pack<std::int32_t, 4>::load(input+1);
+        ASSERT_TRUE(simd_identical(simd_pack<std::int32_t, 4>{-2, 3, -4, 5}, pack));
+
+        std::int32_t output[4]{};  // NOLINT(cppcoreguidelines-avoid-c-arrays)
+        pack.store(output);
+        ASSERT_EQ(-4, output[2]);
+    }
+
+    TEST(simd_pack, add)  // NOLINT
+    {
+        auto const expected = simd_pack<std::int32_t, 4>{4, 1, -2, 1003};
+        auto const actual = simd_pack<std::int32_t, 4>{1, 2, 3, 4}+simd_pack<std::int32_t, 4>{3, -1, -5, 999};
+        ASSERT_TRUE(simd_identical(expected, actual));
+    }
+
+    TEST(simd_pack, multiply_without_promotion)  // NOLINT
+    {
+        auto const expected = simd_pack<std::uint8_t, 4>{6, 0, 255, 1};
+        auto const actual = simd_pack<std::uint8_t, 4>{2, 16, 255, 1}*simd_pack<std::uint8_t, 4>{3, 16, 1, 1};
+        ASSERT_TRUE(simd_identical(expected, actual));
+    }
+
+    TEST(simd_pack, mixed_types)  // NOLINT
+    {
+        auto const expected = simd_pack<std::int32_t, 4>{100001, 2, 3, 4};
+        auto const actual = simd_pack<std::int16_t, 4>{1, 2, 3, 4}+simd_pack<std::int32_t, 4>{100000, 0, 0, 0};
+        ASSERT_TRUE(simd_identical(expected, actual));
+    }
+
+    TEST(simd_pack, scalar)  // NOLINT
+    {
+        auto const expected = simd_pack<std::int64_t, 2>{-10, 30};
+        auto const actual = simd_pack<std::int64_t, 2>{-1, 3}*10;
+        ASSERT_TRUE(simd_identical(expected, actual));
+    }
+
+    TEST(simd_pack, shift)  // NOLINT
+    {
+        auto const expected = simd_pack<std::int32_t, 4>{8, -8, 16, 0};
+        auto const actual = simd_pack<std::int32_t, 4>{1, -1, 2, 0} << 3;
+        ASSERT_TRUE(simd_identical(expected, actual));
+        ASSERT_TRUE(simd_identical(simd_pack<std::int32_t, 4>{1, -1, 2, 0}, actual >> cnl::constant<3>{}));
+    }
+
+    TEST(simd_pack, compound_assignment)  // NOLINT
+    {
+        auto pack = simd_pack<float, 4>{1.f, 2.f, 3.f, 4.f};
+        pack *= 2.f;
+        pack -= simd_pack<float, 4>{1.f, 1.f, 1.f, 1.f};
+        ASSERT_TRUE(simd_identical(simd_pack<float, 4>{1.f, 3.f, 5.f, 7.f}, pack));
+    }
+
+    TEST(simd_pack, compare)  // NOLINT
+    {
+        auto const mask = simd_pack<std::int16_t, 8>{1, 2, 3, 4, 5, 6, 7, 8}>4;
+        ASSERT_FALSE(mask[3]);
+        ASSERT_TRUE(mask[4]);
+        ASSERT_TRUE(cnl::any_of(mask));
+        ASSERT_FALSE(cnl::all_of(mask));
+        ASSERT_FALSE(cnl::none_of(mask));
+        ASSERT_TRUE(cnl::all_of(mask || !mask));
+        ASSERT_TRUE(cnl::none_of(mask && !mask));
+    }
+
+    TEST(simd_pack, select)  // NOLINT
+    {
+        auto const lhs = simd_pack<double, 2>{1.5, -2.};
+        auto const rhs = simd_pack<double, 2>{-1., 7.};
+        ASSERT_TRUE(simd_identical(simd_pack<double, 2>{1.5, 7.}, cnl::select(lhs>rhs, lhs, rhs)));
+    }
+
+    TEST(simd_pack, odd_size)  // NOLINT
+    {
+        auto const expected = simd_pack<std::int32_t, 3>{5, 7, 9};
+        auto const actual = simd_pack<std::int32_t, 3>{1, 2, 3}+simd_pack<std::int32_t, 3>{4, 5, 6};
+        ASSERT_TRUE(simd_identical(expected, actual));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // scaled_integer
+
+    template<typename T, std::size_t N, int Exponent>
+    using scaled_pack = cnl::scaled_integer<simd_pack<T, N>, cnl::power<Exponent>>;
+
+    TEST(simd_pack, scaled_integer_conversion)  // NOLINT
+    {
+        auto const scaled = scaled_pack<std::int32_t, 4, -16>{simd_pack<float, 4>{1.5f, -8.f, 0.f, .125f}};
+        ASSERT_TRUE(simd_identical(
+                simd_pack<std::int32_t, 4>{98304, -524288, 0, 8192},
+                cnl::_impl::to_rep(scaled)));
+        ASSERT_TRUE(simd_identical(
+                simd_pack<float, 4>{1.5f, -8.f, 0.f, .125f},
+                static_cast<simd_pack<float, 4>>(scaled)));
+    }
+
+    TEST(simd_pack, scaled_integer_add)  // NOLINT
+    {
+        using operand = scaled_pack<std::int32_t, 4, -16>;
+        using initializer = simd_pack<float, 4>;
+
+        auto const expected = operand{initializer{7.9375f+-1.f, -8.f+.125f, 0.f+-5.f, 3.5f+-3.5f}};
+        auto const augend = operand{initializer{7.9375f, -8.f, 0.f, 3.5f}};
+        auto const addend = operand{initializer{-1.f, .125f, -5.f, -3.5f}};
+        auto const sum = augend+addend;
+        ASSERT_TRUE(simd_identical(expected, sum));
+    }
+
+    TEST(simd_pack, scaled_integer_multiply)  // NOLINT
+    {
+        using operand = scaled_pack<std::int16_t, 8, -4>;
+        using result = scaled_pack<std::int16_t, 8, -8>;
+        using initializer = simd_pack<float, 8>;
+
+        auto const expected = result{initializer{-7.9375f, -1.f, 0.f, 1.f, 2.25f, -.5f, 4.f, 0.f}};
+        auto const multiplier = operand{initializer{7.9375f, -8.f, 0.f, 1.f, 1.5f, -.5f, 2.f, 0.f}};
+        auto const multiplicand = operand{initializer{-1.f, .125f, 0.f, 1.f, 1.5f, 1.f, 2.f, 3.f}};
+        auto const product = multiplier*multiplicand;
+        ASSERT_TRUE(simd_identical(expected, product));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // elastic_integer
+
+    TEST(simd_pack, elastic_integer_multiply)  // NOLINT
+    {
+        using operand = cnl::elastic_integer<15, simd_pack<std::int16_t, 8>>;
+        auto const lanes = simd_pack<std::int16_t, 8>{32767, -32767, 2, 3, 4, 5, 6, 7};
+        auto const product = operand{lanes}*operand{lanes};
+
+        static_assert(std::is_same<cnl::elastic_integer<30, simd_pack<std::int16_t, 8>>, std::remove_const<decltype(product)>::type>::value, "");
+        static_assert(std::is_same<simd_pack<std::int32_t, 8>, cnl::_impl::rep_t<std::remove_const<decltype(product)>::type>>::value, "");
+        ASSERT_TRUE(simd_identical(
+                simd_pack<std::int32_t, 8>{1073676289, 1073676289, 4, 9, 16, 25, 36, 49},
+                cnl::_impl::to_rep(product)));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // overflow_integer
+
+    TEST(simd_pack, saturated_add)  // NOLINT
+    {
+        using saturated = cnl::overflow_integer<simd_pack<std::int16_t, 8>, cnl::saturated_overflow_tag>;
+        auto const augend = saturated{simd_pack<std::int16_t, 8>{32000, -32000, 5, 6, 7, 8, 9, 10}};
+        auto const addend = saturated{simd_pack<std::int16_t, 8>{1000, -1000, 1, 1, 1, 1, 1, -20}};
+        ASSERT_TRUE(simd_identical(
+                simd_pack<std::int16_t, 8>{32767, -32768, 6, 7, 8, 9, 10, -10},
+                cnl::_impl::to_rep(augend+addend)));
+    }
+
+    TEST(simd_pack, saturated_convert)  // NOLINT
+    {
+        using saturated = cnl::overflow_integer<simd_pack<std::uint8_t, 4>, cnl::saturated_overflow_tag>;
+        auto const converted = saturated{simd_pack<int, 4>{-1, 0, 255, 256}};
+        ASSERT_TRUE(simd_identical(
+                simd_pack<std::uint8_t, 4>{0, 0, 255, 255},
+                cnl::_impl::to_rep(converted)));
+    }
+
+    static_assert(cnl::_impl::has_simd_overflow<cnl::saturated_overflow_tag, std::int16_t>::value, "");
+    static_assert(cnl::_impl::has_simd_overflow<cnl::native_overflow_tag, float>::value, "");
+    static_assert(!cnl::_impl::has_simd_overflow<cnl::saturated_overflow_tag, float>::value, "");
+    static_assert(!cnl::_impl::has_simd_overflow<cnl::trapping_overflow_tag, std::int16_t>::value, "");
+
+    TEST(simd_pack, saturated_arithmetic)  // NOLINT
+    {
+        using saturated = cnl::overflow_integer<simd_pack<std::int8_t, 8>, cnl::saturated_overflow_tag>;
+        auto const lhs = saturated{simd_pack<std::int8_t, 8>{100, -100, 20, -20, -128, -128, 127, 6}};
+        auto const rhs = saturated{simd_pack<std::int8_t, 8>{100, 100, -7, 7, -1, 1, -1, 3}};
+        ASSERT_TRUE(simd_identical(
+                simd_pack<std::int8_t, 8>{0, -128, 27, -27, -127, -128, 127, 3},
+                cnl::_impl::to_rep(lhs-rhs)));
+        ASSERT_TRUE(simd_identical(
+                simd_pack<std::int8_t, 8>{127, -128, -128, -128, 127, -128, -127, 18},
+                cnl::_impl::to_rep(lhs*rhs)));
+        ASSERT_TRUE(simd_identical(
+                simd_pack<std::int8_t, 8>{1, -1, -2, -2, 127, -128, -127, 2},
+                cnl::_impl::to_rep(lhs/rhs)));
+        ASSERT_TRUE(simd_identical(
+                simd_pack<std::int8_t, 8>{-100, 100, -20, 20, 127, 127, -127, -6},
+                cnl::_impl::to_rep(-lhs)));
+        ASSERT_TRUE(simd_identical(
+                simd_pack<std::int8_t, 8>{127, -128, 80, -80, -128, -128, 127, 24},
+                cnl::_impl::to_rep(lhs << 2)));
+    }
+
+    // lanes which are not stored in a vector
+    TEST(simd_pack, saturated_arithmetic_array)  // NOLINT
+    {
+        using saturated = cnl::overflow_integer<simd_pack<std::uint16_t, 3>, cnl::saturated_overflow_tag>;
+        auto const lhs = saturated{simd_pack<std::uint16_t, 3>{65000, 5, 300}};
+        auto const rhs = saturated{simd_pack<std::uint16_t, 3>{1000, 6, 300}};
+        ASSERT_TRUE(simd_identical(
+                simd_pack<std::uint16_t, 3>{65535, 11, 600},
+                cnl::_impl::to_rep(lhs+rhs)));
+        ASSERT_TRUE(simd_identical(
+                simd_pack<std::uint16_t, 3>{64000, 0, 0},
+                cnl::_impl::to_rep(lhs-rhs)));
+        ASSERT_TRUE(simd_identical(
+                simd_pack<std::uint16_t, 3>{65535, 30, 65535},
+                cnl::_impl::to_rep(lhs*rhs)));
+        ASSERT_TRUE(simd_identical(
+                simd_pack<std::uint16_t, 3>{0, 0, 0},
+                cnl::_impl::to_rep(-lhs)));
+    }
+
+    TEST(simd_pack, saturated_convert_narrowing)  // NOLINT
+    {
+        using saturated = cnl::overflow_integer<simd_pack<std::int8_t, 4>, cnl::saturated_overflow_tag>;
+        auto const converted = saturated{simd_pack<std::uint16_t, 4>{0, 127, 128, 65535}};
+        ASSERT_TRUE(simd_identical(
+                simd_pack<std::int8_t, 4>{0, 127, 127, 127},
+                cnl::_impl::to_rep(converted)));
+    }
+
+    TEST(simd_pack, select_integer)  // NOLINT
+    {
+        auto const lhs = simd_pack<std::int32_t, 4>{1, -2, 3, -4};
+        auto const rhs = simd_pack<std::int32_t, 4>{0, 0, 5, -5};
+        ASSERT_TRUE(simd_identical(simd_pack<std::int32_t, 4>{1, 0, 5, -4}, cnl::select(lhs>rhs, lhs, rhs)));
+    }
+
+#if defined(CNL_EXCEPTIONS_ENABLED)
+    TEST(simd_pack, throwing_add)  // NOLINT
+    {
+        using throwing = cnl::overflow_integer<simd_pack<std::int16_t, 4>, cnl::throwing_overflow_tag>;
+        auto const lhs = throwing{simd_pack<std::int16_t, 4>{1, 2, 32767, 4}};
+        ASSERT_TRUE(simd_identical(
+                simd_pack<std::int16_t, 4>{2, 4, 32767, 8},
+                cnl::_impl::to_rep(lhs+throwing{simd_pack<std::int16_t, 4>{1, 2, 0, 4}})));
+        EXPECT_THROW((void) (lhs+throwing{1}), std::overflow_error);
+    }
+#endif
+
+    TEST(simd_pack, native_multiply)  // NOLINT
+    {
+        using native = cnl::overflow_integer<simd_pack<std::int32_t, 4>, cnl::native_overflow_tag>;
+        auto const product = native{simd_pack<std::int32_t, 4>{1, 2, 3, 4}}*native{7};
+        ASSERT_TRUE(simd_identical(
+                simd_pack<std::int32_t, 4>{7, 14, 21, 28},
+                cnl::_impl::to_rep(product)));
+    }
+}
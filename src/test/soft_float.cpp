@@ -0,0 +1,182 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/soft_float.h>
+
+#include <cnl/_impl/type_traits/identical.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+
+namespace {
+    using cnl::_impl::identical;
+    using cnl::power;
+    using cnl::scaled_integer;
+    using cnl::soft_float;
+
+    using binary32 = soft_float<24, 8>;
+    using binary64 = soft_float<53, 11>;
+    using binary32_truncated = soft_float<24, 8, cnl::native_rounding_tag>;
+
+    namespace test_ctor {
+        static_assert(!binary32{}, "cnl::soft_float default ctor");
+        static_assert(!binary32{}.negative(), "cnl::soft_float default ctor");
+
+        static_assert(0x800000u==binary32{1}.mantissa(), "cnl::soft_float ctor from int");
+        static_assert(-23==binary32{1}.exponent(), "cnl::soft_float ctor from int");
+        static_assert(binary32{-6}.negative(), "cnl::soft_float ctor from negative int");
+        static_assert(0xc00000u==binary32{-6}.mantissa(), "cnl::soft_float ctor from negative int");
+
+        // 2^24+1 has 25 digits
+        static_assert(
+                binary32{16777218}==binary32{16777217},
+                "cnl::soft_float ctor from int rounds to nearest, ties away from zero");
+        static_assert(
+                binary32_truncated{16777216}==binary32_truncated{16777217},
+                "cnl::soft_float ctor from int rounds toward zero");
+
+        static_assert(
+                binary64{-13}==binary64{scaled_integer<std::int16_t, power<-2>>{-3.25}}*4,
+                "cnl::soft_float ctor from scaled_integer");
+        static_assert(
+                !binary32{scaled_integer<int, power<-4>>{0}},
+                "cnl::soft_float ctor from scaled_integer");
+    }
+
+    namespace test_to_integer {
+        static_assert(identical(-7, static_cast<int>(binary32{-7})), "cnl::soft_float conversion to int");
+        static_assert(
+                identical(std::uint64_t{1} << 40, static_cast<std::uint64_t>(binary64{std::int64_t{1} << 40})),
+                "cnl::soft_float conversion to std::uint64_t");
+        static_assert(identical(2, static_cast<int>(binary32{3}/2)), "cnl::soft_float conversion to int rounds");
+        static_assert(
+                identical(1, static_cast<int>(binary32_truncated{3}/2)),
+                "cnl::soft_float conversion to int truncates");
+    }
+
+    namespace test_to_scaled_integer {
+        static_assert(
+                identical(
+                        scaled_integer<int, power<-4>>{-2.6875},
+                        static_cast<scaled_integer<int, power<-4>>>(binary32{-43}/16)),
+                "cnl::soft_float conversion to scaled_integer");
+        static_assert(
+                identical(
+                        scaled_integer<int, power<-1>>{-1.5},
+                        static_cast<scaled_integer<int, power<-1>>>(binary32{-5}/4)),
+                "cnl::soft_float conversion to scaled_integer rounds to nearest, ties away from zero");
+        static_assert(
+                identical(
+                        scaled_integer<int, power<-1>>{-1.},
+                        static_cast<scaled_integer<int, power<-1>>>(binary32_truncated{-5}/4)),
+                "cnl::soft_float conversion to scaled_integer rounds toward zero");
+    }
+
+    namespace test_arithmetic {
+        static_assert(binary32{5}==binary32{2}+binary32{3}, "cnl::soft_float addition");
+        static_assert(binary32{-1}==binary32{2}-binary32{3}, "cnl::soft_float subtraction");
+        static_assert(!(binary32{3}-binary32{3}).negative(), "cnl::soft_float has no negative zero");
+        static_assert(binary32{-6}==binary32{2}*binary32{-3}, "cnl::soft_float multiplication");
+        static_assert(binary32{-2}==binary32{-6}/binary32{3}, "cnl::soft_float division");
+        static_assert(binary32{3}==-binary32{-3}, "cnl::soft_float negation");
+
+        static_assert(binary32{8}==binary32{4}+4, "cnl::soft_float addition of int");
+        static_assert(binary32{1}/2==1/binary32{2}, "cnl::soft_float division of int");
+
+        // 2^24+1 lies halfway between two binary32 values
+        static_assert(binary32{16777218}==binary32{16777216}+1, "cnl::soft_float addition rounds");
+        static_assert(
+                binary32_truncated{16777216}==binary32_truncated{16777216}+1, "cnl::soft_float addition rounds");
+        static_assert(binary32{16777218}==binary32{16777216}+2, "cnl::soft_float addition rounds");
+
+        // one third
+        static_assert(0xaaaaabu==(binary32{1}/3).mantissa(), "cnl::soft_float division rounds to nearest");
+        static_assert(0xaaaaaau==(binary32_truncated{1}/3).mantissa(), "cnl::soft_float division rounds toward zero");
+    }
+
+    namespace test_comparison {
+        static_assert(binary32{-3}<binary32{-2}, "cnl::soft_float <");
+        static_assert(binary32{-3}<binary32{0}, "cnl::soft_float <");
+        static_assert(binary32{0}<binary32{1}/4, "cnl::soft_float <");
+        static_assert(binary32{1024}>binary32{1023}, "cnl::soft_float >");
+        static_assert(binary32{1}<=1, "cnl::soft_float <=");
+        static_assert(binary32{1}!=-1, "cnl::soft_float !=");
+    }
+
+    namespace test_numeric_limits {
+        static_assert(
+                std::numeric_limits<double>::max_exponent10==cnl::numeric_limits<binary64>::max_exponent10,
+                "cnl::numeric_limits<cnl::soft_float>::max_exponent10");
+        static_assert(
+                std::numeric_limits<float>::min_exponent10==cnl::numeric_limits<binary32>::min_exponent10,
+                "cnl::numeric_limits<cnl::soft_float>::min_exponent10");
+    }
+
+    TEST(soft_float, numeric_limits)  // NOLINT
+    {
+        EXPECT_EQ(binary32{std::numeric_limits<float>::max()}, cnl::numeric_limits<binary32>::max());
+        EXPECT_EQ(binary32{std::numeric_limits<float>::lowest()}, cnl::numeric_limits<binary32>::lowest());
+        EXPECT_EQ(binary32{std::numeric_limits<float>::min()}, cnl::numeric_limits<binary32>::min());
+        EXPECT_EQ(binary64{std::numeric_limits<double>::epsilon()}, cnl::numeric_limits<binary64>::epsilon());
+    }
+
+    TEST(soft_float, from_floating_point)  // NOLINT
+    {
+        EXPECT_EQ(0x920000u, binary32{-.5703125}.mantissa());
+        EXPECT_EQ(-24, binary32{-.5703125}.exponent());
+        EXPECT_TRUE(binary32{-.5703125}.negative());
+        EXPECT_EQ(binary32{1}/3, binary32{1./3});
+    }
+
+    TEST(soft_float, to_floating_point)  // NOLINT
+    {
+        EXPECT_EQ(-.5703125, static_cast<double>(binary32{-.5703125}));
+        EXPECT_EQ(1.f/3, static_cast<float>(binary32{1}/3));
+        EXPECT_EQ(.1, static_cast<double>(binary64{1}/10));
+    }
+
+    TEST(soft_float, matches_binary64)  // NOLINT
+    {
+        auto const a = 1234.5678;
+        auto const b = -0.000987654321;
+        EXPECT_EQ(a+b, static_cast<double>(binary64{a}+binary64{b}));
+        EXPECT_EQ(a-b, static_cast<double>(binary64{a}-binary64{b}));
+        EXPECT_EQ(a*b, static_cast<double>(binary64{a}*binary64{b}));
+        EXPECT_EQ(a/b, static_cast<double>(binary64{a}/binary64{b}));
+    }
+
+    TEST(soft_float, overflow_saturates)  // NOLINT
+    {
+        auto const max = cnl::numeric_limits<binary32>::max();
+        EXPECT_EQ(max, max*2);
+        EXPECT_EQ(-max, max*-2);
+        EXPECT_EQ(max, binary32{1}/0);
+        EXPECT_EQ(std::numeric_limits<float>::max(), static_cast<float>(max+max));
+    }
+
+    TEST(soft_float, underflow_flushes_to_zero)  // NOLINT
+    {
+        auto const min = cnl::numeric_limits<binary32>::min();
+        EXPECT_EQ(binary32{}, min/2);
+        EXPECT_EQ(binary32{}, -min/2);
+        EXPECT_EQ(binary32{}, min-min);
+    }
+
+    TEST(soft_float, compound_assignment)  // NOLINT
+    {
+        auto value = binary32{10};
+        value += 5;
+        EXPECT_EQ(binary32{15}, value);
+        value -= binary32{.5};
+        EXPECT_EQ(binary32{14.5}, value);
+        value *= 2;
+        EXPECT_EQ(binary32{29}, value);
+        value /= -4;
+        EXPECT_EQ(binary32{-7.25}, value);
+    }
+}
@@ -0,0 +1,91 @@
+
+//          Copyright John McFarlane 2019.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief Quantized Matrix Multiplication Using cnl::gemm
+///
+/// Checks that cnl::gemm gives the same results as a hand-written integer kernel;
+/// bm_gemm_raw_integer and bm_gemm_scaled_integer in src/benchmark compare their speed.
+
+#include <cnl/gemm.h>
+#include <cnl/overflow_integer.h>
+#include <cnl/rounding_integer.h>
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+using namespace cnl;
+
+// multiply 1:7 matrices into a 3:4 matrix using native types
+void gemm_integer(
+        std::size_t rows, std::size_t columns, std::size_t depth,
+        int8_t const* lhs, int8_t const* rhs, int8_t* result)
+{
+    for (std::size_t row = 0; row!=rows; ++row) {
+        for (std::size_t column = 0; column!=columns; ++column) {
+            // user must remember to widen the sum to avoid overflow
+            auto sum = int32_t{0};
+            for (std::size_t k = 0; k!=depth; ++k) {
+                sum += int32_t{lhs[row*depth+k]}*rhs[k*columns+column];
+            }
+
+            // user must remember that the product has 14 fractional digits and the result has 4
+            // and must round and saturate by hand
+            auto const rounded = (sum+(sum<0 ? -512 : 512))/1024;
+            result[row*columns+column] = static_cast<int8_t>(std::max(-128, std::min(127, rounded)));
+        }
+    }
+}
+
+// the same function using cnl::gemm
+using q1_7 = scaled_integer<int8_t, power<-7>>;
+using q3_4 = scaled_integer<rounding_integer<overflow_integer<int8_t, saturated_overflow_tag>>, power<-4>>;
+
+void gemm_scaled_integer(
+        std::size_t rows, std::size_t columns, std::size_t depth,
+        q1_7 const* lhs, q1_7 const* rhs, q3_4* result)
+{
+    // scaling, widening, rounding and saturation follow from the types;
+    // the sums are computed in a blocked, vectorized kernel
+    gemm(rows, columns, depth, lhs, rhs, result, 1);
+}
+
+TEST(zero_cost_gemm, same_result_as_raw_integer)  // NOLINT
+{
+    constexpr auto rows = std::size_t{13};
+    constexpr auto columns = std::size_t{29};
+    constexpr auto depth = std::size_t{71};
+
+    auto lhs = std::vector<int8_t>(rows*depth);
+    auto rhs = std::vector<int8_t>(depth*columns);
+    auto seed = 1U;
+    for (auto& element : lhs) {
+        element = static_cast<int8_t>((seed = seed*1103515245U+12345U) >> 16U);
+    }
+    for (auto& element : rhs) {
+        element = static_cast<int8_t>((seed = seed*1103515245U+12345U) >> 16U);
+    }
+
+    auto expected = std::vector<int8_t>(rows*columns);
+    gemm_integer(rows, columns, depth, lhs.data(), rhs.data(), expected.data());
+
+    auto const from_integer = [](int8_t element) { return _impl::from_rep<q1_7>(element); };
+    auto scaled_lhs = std::vector<q1_7>(lhs.size());
+    auto scaled_rhs = std::vector<q1_7>(rhs.size());
+    std::transform(lhs.begin(), lhs.end(), scaled_lhs.begin(), from_integer);
+    std::transform(rhs.begin(), rhs.end(), scaled_rhs.begin(), from_integer);
+
+    auto actual = std::vector<q3_4>(rows*columns);
+    gemm_scaled_integer(rows, columns, depth, scaled_lhs.data(), scaled_rhs.data(), actual.data());
+
+    for (std::size_t index = 0; index!=expected.size(); ++index) {
+        EXPECT_EQ(expected[index]/16., static_cast<double>(actual[index])) << "index=" << index;
+    }
+}